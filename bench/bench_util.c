@@ -0,0 +1,34 @@
+#include "bench_util.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+double now_us(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec * 1e6 + ts.tv_nsec * 1e-3;
+}
+
+int compare_long(const void *a, const void *b) {
+    long x = *(const long *)a, y = *(const long *)b;
+    return (x > y) - (x < y);
+}
+
+long percentile(const long *sorted, int n, double p) {
+    int rank = (int)((p / 100.0) * n + 0.999999);
+    if (rank < 1) rank = 1;
+    if (rank > n) rank = n;
+    return sorted[rank - 1];
+}
+
+char *read_file(const char *path, size_t *len, size_t extra) {
+    FILE *f = fopen(path, "rb");
+    if (!f) return NULL;
+    fseek(f, 0, SEEK_END);
+    long size = ftell(f);
+    fseek(f, 0, SEEK_SET);
+    char *data = malloc((size > 0 ? size : 0) + extra + 1);
+    *len = fread(data, 1, size > 0 ? size : 0, f);
+    fclose(f);
+    return data;
+}
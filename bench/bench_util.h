@@ -0,0 +1,21 @@
+#pragma once
+
+#include <stddef.h>
+
+// 基准测试程序（loadgen、editbench、perfgate）共用的计时、统计与文件读取
+
+// 单调时钟的当前时间（微秒）
+double now_us(void);
+
+// qsort 比较函数，long 升序
+int compare_long(const void *a, const void *b);
+
+// 已排序数组的第 p 百分位（最近秩法）
+long percentile(const long *sorted, int n, double p);
+
+/**
+ * 读入整个文件，失败返回 NULL，由调用者释放
+ * @param len 输出：文件长度
+ * @param extra 在内容之后额外预留的字节数（另外总会多留 1 字节）
+ */
+char *read_file(const char *path, size_t *len, size_t extra);
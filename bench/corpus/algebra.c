@@ -0,0 +1,12 @@
+// 代数化简：宏展开式的冗余模式（x + 0、x * 1、x - x、0 - (0 - x)、常量链、自比较）
+int lerp(int a, int b, int t) { return a * (1 - t) + b * t + 0 * (a - b); }
+int norm(int x, int y) { return (x - 0) * (x * 1) + (0 - (0 - y)) * (y / 1) - (x - x) * y; }
+int step(int x, int lo, int hi) { return ((x + 3) - 1 + -2) * ((lo <= lo) && (x >= lo)) * !!(x < hi); }
+int mix(int a, int b, int c) {
+  return (a + -b) - (c - -a) + (b % 1) + (a * -1) * (c == c) + ((a - 1) - 1 + 2) * (b != b || 1)
+         + !!(a > b) * (c * 0 + c / c) - (-(-(a)));
+}
+int main() {
+  return lerp(3, 9, 2) + norm(4, 5) * step(7, 1, 9) - mix(11, 6, 5) + mix(norm(1, 2), lerp(0, 8, 1), 3)
+         + (1 * 2 + 0) * (3 - 3 + 4);
+}
@@ -0,0 +1,4 @@
+// 四则运算与取模，包含大立即数
+int main() {
+  return (1 + 2) * 3 - 4 / 2 % 3 + 4096 * 7 - -(123456 - 65536) / 17 + 0x7ff * 010;
+}
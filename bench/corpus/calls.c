@@ -0,0 +1,12 @@
+// 多函数与调用：小的辅助函数被内联，较大的函数保留调用，含超过 8 个参数的栈上传参
+int sq(int x) { return x * x; }
+int clamp_pos(int x) { return x * (x > 0); }
+int dist2(int x0, int y0, int x1, int y1) { return sq(x1 - x0) + sq(y1 - y0); }
+int poly(int a, int b, int c, int d, int e, int f, int g, int h, int i, int j) {
+  return ((((((((a * 3 + b) * 3 + c) * 3 + d) * 3 + e) * 3 + f) * 3 + g) * 3 + h) * 3 + i) * 3 + j
+         + clamp_pos(a - j) * dist2(a, b, i, j) - sq(e - f) * (g != h) + (c % 7) * (d / 3);
+}
+int main() {
+  return poly(1, 2, 3, 4, 5, 6, 7, 8, 9, 10) - poly(dist2(0, 0, 3, 4), 9, 8, 7, 6, 5, 4, 3, 2, 1)
+         + poly(sq(2), sq(3), clamp_pos(-4), 0, 1, 0, 1, 0, 1, 0) % 1000;
+}
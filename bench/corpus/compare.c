@@ -0,0 +1,4 @@
+// 关系与相等比较
+int main() {
+  return (1 < 2) + (3 > 4) * 2 + (5 <= 5) * 4 + (6 >= 7) * 8 + (9 == 9) * 16 + (10 != 10) * 32;
+}
@@ -0,0 +1,4 @@
+// 深层嵌套的左结合表达式
+int main() {
+  return ((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((1 + 1) - 2) * 3) && 4) || 5) < 6) + 7) - 8) * 9) && 10) || 11) < 12) + 13) - 1) * 2) && 3) || 4) < 5) + 6) - 7) * 8) && 9) || 10) < 11) + 12) - 13) * 1) && 2) || 3) < 4) + 5) - 6) * 7) && 8) || 9) < 10) + 11) - 12) * 13) && 1) || 2) < 3) + 4) - 5) * 6) && 7) || 8) < 9) + 10) - 11) * 12) && 13) || 1) < 2) + 3) - 4) * 5) && 6) || 7) < 8) + 9) - 10) * 11) && 12) || 13) < 1) + 2) - 3) * 4) && 5) || 6) < 7) + 8) - 9) * 10) && 11) || 12) < 13) + 1) - 2) * 3) && 4) || 5) < 6) + 7) - 8) * 9) && 10) || 11) < 12) + 13) - 1) * 2) && 3) || 4) < 5) + 6) - 7) * 8) && 9) || 10) < 11) + 12) - 13) * 1) && 2) || 3) < 4) + 5) - 6) * 7) && 8) || 9) < 10) + 11) - 12) * 13) && 1) || 2) < 3) + 4) - 5) * 6) && 7) || 8) < 9) + 10) - 11) * 12) && 13) || 1) < 2) + 3) - 4) * 5) && 6) || 7) < 8) + 9) - 10) * 11) && 12) || 13) < 1) + 2) - 3) * 4) && 5) || 6) < 7) + 8) - 9) * 10) && 11) || 12) < 13) + 1) - 2) * 3) && 4) || 5) < 6) + 7) - 8) * 9) && 10) || 11) < 12) + 13) - 1) * 2) && 3) || 4) < 5) + 6) - 7) * 8) && 9) || 10) < 11) + 12) - 13) * 1) && 2) || 3) < 4) + 5) - 6) * 7) && 8) || 9) < 10) + 11) - 12) * 13) && 1) || 2) < 3) + 4) - 5) * 6) && 7) || 8) < 9) + 10) - 11) * 12) && 13) || 1) < 2) + 3) - 4) * 5) && 6) || 7) < 8) + 9) - 10) * 11) && 12) || 13) < 1) + 2) - 3) * 4) && 5) || 6) < 7) + 8) - 9) * 10) && 11) || 12) < 13) + 1) - 2) * 3) && 4) || 5) < 6) + 7) - 8) * 9) && 10) || 11) < 12) + 13) - 1) * 2) && 3) || 4) < 5) + 6) - 7) * 8) && 9) || 10) < 11) + 12) - 13) * 1) && 2) || 3) < 4) + 5) - 6) * 7) && 8) || 9) < 10) + 11) - 12) * 13) && 1) || 2) < 3) + 4) - 5) * 6) && 7) || 8) < 9) + 10) - 11) * 12) && 13) || 1) < 2) + 3) - 4) * 5) && 6) || 7) < 8) + 9) - 10) * 11) && 12) || 13) < 1);
+}
@@ -0,0 +1,4 @@
+// 逻辑与、或、非的组合
+int main() {
+  return !(1 && 0) || (2 && !3) && (0 || 5) || !!7 && (8 || 0 && 9);
+}
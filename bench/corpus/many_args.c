@@ -0,0 +1,87 @@
+// 超过 263 个参数的调用：RV64 上栈上传参与被调函数读取参数的偏移超出 12 位立即数
+int mix(int a0, int a1, int a2, int a3, int a4, int a5, int a6, int a7, int a8, int a9, int a10, int a11, int
+        a12, int a13, int a14, int a15, int a16, int a17, int a18, int a19, int a20, int a21, int a22, int
+        a23, int a24, int a25, int a26, int a27, int a28, int a29, int a30, int a31, int a32, int a33, int
+        a34, int a35, int a36, int a37, int a38, int a39, int a40, int a41, int a42, int a43, int a44, int
+        a45, int a46, int a47, int a48, int a49, int a50, int a51, int a52, int a53, int a54, int a55, int
+        a56, int a57, int a58, int a59, int a60, int a61, int a62, int a63, int a64, int a65, int a66, int
+        a67, int a68, int a69, int a70, int a71, int a72, int a73, int a74, int a75, int a76, int a77, int
+        a78, int a79, int a80, int a81, int a82, int a83, int a84, int a85, int a86, int a87, int a88, int
+        a89, int a90, int a91, int a92, int a93, int a94, int a95, int a96, int a97, int a98, int a99, int
+        a100, int a101, int a102, int a103, int a104, int a105, int a106, int a107, int a108, int a109, int
+        a110, int a111, int a112, int a113, int a114, int a115, int a116, int a117, int a118, int a119, int
+        a120, int a121, int a122, int a123, int a124, int a125, int a126, int a127, int a128, int a129, int
+        a130, int a131, int a132, int a133, int a134, int a135, int a136, int a137, int a138, int a139, int
+        a140, int a141, int a142, int a143, int a144, int a145, int a146, int a147, int a148, int a149, int
+        a150, int a151, int a152, int a153, int a154, int a155, int a156, int a157, int a158, int a159, int
+        a160, int a161, int a162, int a163, int a164, int a165, int a166, int a167, int a168, int a169, int
+        a170, int a171, int a172, int a173, int a174, int a175, int a176, int a177, int a178, int a179, int
+        a180, int a181, int a182, int a183, int a184, int a185, int a186, int a187, int a188, int a189, int
+        a190, int a191, int a192, int a193, int a194, int a195, int a196, int a197, int a198, int a199, int
+        a200, int a201, int a202, int a203, int a204, int a205, int a206, int a207, int a208, int a209, int
+        a210, int a211, int a212, int a213, int a214, int a215, int a216, int a217, int a218, int a219, int
+        a220, int a221, int a222, int a223, int a224, int a225, int a226, int a227, int a228, int a229, int
+        a230, int a231, int a232, int a233, int a234, int a235, int a236, int a237, int a238, int a239, int
+        a240, int a241, int a242, int a243, int a244, int a245, int a246, int a247, int a248, int a249, int
+        a250, int a251, int a252, int a253, int a254, int a255, int a256, int a257, int a258, int a259, int
+        a260, int a261, int a262, int a263, int a264, int a265, int a266, int a267, int a268, int a269, int
+        a270, int a271, int a272, int a273, int a274, int a275, int a276, int a277, int a278, int a279, int
+        a280, int a281, int a282, int a283, int a284, int a285, int a286, int a287, int a288, int a289, int
+        a290, int a291, int a292, int a293, int a294, int a295, int a296, int a297, int a298, int a299) {
+  return (a0 + a1 * 2 + a2 * 3 + a3 + a4 * 5 + a5 * 6 + a6 + a7 * 1 + a8 * 2 + a9 + a10 * 4 + a11 * 5 + a12 +
+          a13 * 7 + a14 * 1 + a15 + a16 * 3 + a17 * 4 + a18 + a19 * 6 + a20 * 7 + a21 + a22 * 2 + a23 * 3 +
+          a24 + a25 * 5 + a26 * 6 + a27 + a28 * 1 + a29 * 2 + a30 + a31 * 4 + a32 * 5 + a33 + a34 * 7 + a35 *
+          1 + a36 + a37 * 3 + a38 * 4 + a39 + a40 * 6 + a41 * 7 + a42 + a43 * 2 + a44 * 3 + a45 + a46 * 5 +
+          a47 * 6 + a48 + a49 * 1 + a50 * 2 + a51 + a52 * 4 + a53 * 5 + a54 + a55 * 7 + a56 * 1 + a57 + a58 *
+          3 + a59 * 4 + a60 + a61 * 6 + a62 * 7 + a63 + a64 * 2 + a65 * 3 + a66 + a67 * 5 + a68 * 6 + a69 +
+          a70 * 1 + a71 * 2 + a72 + a73 * 4 + a74 * 5 + a75 + a76 * 7 + a77 * 1 + a78 + a79 * 3 + a80 * 4 +
+          a81 + a82 * 6 + a83 * 7 + a84 + a85 * 2 + a86 * 3 + a87 + a88 * 5 + a89 * 6 + a90 + a91 * 1 + a92 *
+          2 + a93 + a94 * 4 + a95 * 5 + a96 + a97 * 7 + a98 * 1 + a99 + a100 * 3 + a101 * 4 + a102 + a103 * 6
+          + a104 * 7 + a105 + a106 * 2 + a107 * 3 + a108 + a109 * 5 + a110 * 6 + a111 + a112 * 1 + a113 * 2 +
+          a114 + a115 * 4 + a116 * 5 + a117 + a118 * 7 + a119 * 1 + a120 + a121 * 3 + a122 * 4 + a123 + a124 *
+          6 + a125 * 7 + a126 + a127 * 2 + a128 * 3 + a129 + a130 * 5 + a131 * 6 + a132 + a133 * 1 + a134 * 2
+          + a135 + a136 * 4 + a137 * 5 + a138 + a139 * 7 + a140 * 1 + a141 + a142 * 3 + a143 * 4 + a144 + a145
+          * 6 + a146 * 7 + a147 + a148 * 2 + a149 * 3 + a150 + a151 * 5 + a152 * 6 + a153 + a154 * 1 + a155 *
+          2 + a156 + a157 * 4 + a158 * 5 + a159 + a160 * 7 + a161 * 1 + a162 + a163 * 3 + a164 * 4 + a165 +
+          a166 * 6 + a167 * 7 + a168 + a169 * 2 + a170 * 3 + a171 + a172 * 5 + a173 * 6 + a174 + a175 * 1 +
+          a176 * 2 + a177 + a178 * 4 + a179 * 5 + a180 + a181 * 7 + a182 * 1 + a183 + a184 * 3 + a185 * 4 +
+          a186 + a187 * 6 + a188 * 7 + a189 + a190 * 2 + a191 * 3 + a192 + a193 * 5 + a194 * 6 + a195 + a196 *
+          1 + a197 * 2 + a198 + a199 * 4 + a200 * 5 + a201 + a202 * 7 + a203 * 1 + a204 + a205 * 3 + a206 * 4
+          + a207 + a208 * 6 + a209 * 7 + a210 + a211 * 2 + a212 * 3 + a213 + a214 * 5 + a215 * 6 + a216 + a217
+          * 1 + a218 * 2 + a219 + a220 * 4 + a221 * 5 + a222 + a223 * 7 + a224 * 1 + a225 + a226 * 3 + a227 *
+          4 + a228 + a229 * 6 + a230 * 7 + a231 + a232 * 2 + a233 * 3 + a234 + a235 * 5 + a236 * 6 + a237 +
+          a238 * 1 + a239 * 2 + a240 + a241 * 4 + a242 * 5 + a243 + a244 * 7 + a245 * 1 + a246 + a247 * 3 +
+          a248 * 4 + a249 + a250 * 6 + a251 * 7 + a252 + a253 * 2 + a254 * 3 + a255 + a256 * 5 + a257 * 6 +
+          a258 + a259 * 1 + a260 * 2 + a261 + a262 * 4 + a263 * 5 + a264 + a265 * 7 + a266 * 1 + a267 + a268 *
+          3 + a269 * 4 + a270 + a271 * 6 + a272 * 7 + a273 + a274 * 2 + a275 * 3 + a276 + a277 * 5 + a278 * 6
+          + a279 + a280 * 1 + a281 * 2 + a282 + a283 * 4 + a284 * 5 + a285 + a286 * 7 + a287 * 1 + a288 + a289
+          * 3 + a290 * 4 + a291 + a292 * 6 + a293 * 7 + a294 + a295 * 2 + a296 * 3 + a297 + a298 * 5 + a299 *
+          6) % 10007 + a299 - a0;
+}
+int main() {
+  return mix(-50, -13, 24, -40, -3, 34, -30, 7, 44, -20, 17, -47, -10, 27, -37, 0, 37, -27, 10, 47, -17, 20,
+             -44, -7, 30, -34, 3, 40, -24, 13, 50, -14, 23, -41, -4, 33, -31, 6, 43, -21, 16, -48, -11, 26,
+             -38, -1, 36, -28, 9, 46, -18, 19, -45, -8, 29, -35, 2, 39, -25, 12, 49, -15, 22, -42, -5, 32,
+             -32, 5, 42, -22, 15, -49, -12, 25, -39, -2, 35, -29, 8, 45, -19, 18, -46, -9, 28, -36, 1, 38,
+             -26, 11, 48, -16, 21, -43, -6, 31, -33, 4, 41, -23, 14, -50, -13, 24, -40, -3, 34, -30, 7, 44,
+             -20, 17, -47, -10, 27, -37, 0, 37, -27, 10, 47, -17, 20, -44, -7, 30, -34, 3, 40, -24, 13, 50,
+             -14, 23, -41, -4, 33, -31, 6, 43, -21, 16, -48, -11, 26, -38, -1, 36, -28, 9, 46, -18, 19, -45,
+             -8, 29, -35, 2, 39, -25, 12, 49, -15, 22, -42, -5, 32, -32, 5, 42, -22, 15, -49, -12, 25, -39,
+             -2, 35, -29, 8, 45, -19, 18, -46, -9, 28, -36, 1, 38, -26, 11, 48, -16, 21, -43, -6, 31, -33, 4,
+             41, -23, 14, -50, -13, 24, -40, -3, 34, -30, 7, 44, -20, 17, -47, -10, 27, -37, 0, 37, -27, 10,
+             47, -17, 20, -44, -7, 30, -34, 3, 40, -24, 13, 50, -14, 23, -41, -4, 33, -31, 6, 43, -21, 16,
+             -48, -11, 26, -38, -1, 36, -28, 9, 46, -18, 19, -45, -8, 29, -35, 2, 39, -25, 12, 49, -15, 22,
+             -42, -5, 32, -32, 5, 42, -22, 15, -49, -12, 25, -39, -2, 35, -29, 8, 45, -19, 18, -46, -9, 28,
+             -36, 1, 38, -26, 11, 48, -16, 21, -43, -6, 31, -33, 4)
+         - mix(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 0, 1, 2, 3,
+               4, 5, 6, 7, 8, 9, 10, 11, 12, 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 0, 1, 2, 3, 4, 5, 6, 7,
+               8, 9, 10, 11, 12, 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10,
+               11, 12, 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 0,
+               1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 0, 1, 2, 3, 4,
+               5, 6, 7, 8, 9, 10, 11, 12, 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 0, 1, 2, 3, 4, 5, 6, 7, 8,
+               9, 10, 11, 12, 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11,
+               12, 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 0, 1,
+               2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 0, 1, 2, 3, 4, 5,
+               6, 7, 8, 9, 10, 11, 12, 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 0, 1, 2, 3, 4, 5, 6, 7, 8, 9,
+               10, 11, 12, 0);
+}
@@ -0,0 +1,7 @@
+// 深层嵌套的右结合表达式：每层左侧的乘积须在右侧子树求值期间保留
+int f(int a, int b, int c, int d) {
+  return a * c + (b * d - (c * a + (d * b + (a * c - (b * d + (c * a + (d * b - (a * c + (b * d + (c * a - (d * b + (a * c + (b * d - (c * a + (d * b + (a * c - (b * d + (c * a + (d * b - (a * c + (b * d + (c * a - (d * b + (a * c + (b * d - (c * a + (d * b + (a * c - (b * d + (c * a + (d * b - (a * c + (b * d + (c * a - (d * b + (a * c + (b * d - (c * a + (d * b + (a * b))))))))))))))))))))))))))))))))))))))));
+}
+int main() {
+  return f(1, 2, 3, 4);
+}
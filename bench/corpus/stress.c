@@ -0,0 +1,83 @@
+// 编译时间压力测试：上万个运算
+int main() {
+  return 1 +
+    (1 >= (0 != 3)) +
+    ((0 || ((((((100 * 3) * (0 - 65536)) <= ((3 < 017) / (7 < 0x10))) > ((!(2) >= (017 % 1)) * ((1 != 2047) % (3 - 2048)))) / ((1 != 3) / (((7 < 0x10) <= -(2048)) * ((0 % 2048) || (3 + 1))))) > (((((7 && 2) >= (65536 && 65536)) > ((2048 < 2) < 100)) && ((017 - (3 > 7)) / ((7 && 0) + (7 % 65536)))) / (!(((100 - 3) - (2048 <= 2048))) != (2048 * (0 % (7 / 0x10))))))) % (((+(+(((7 % 2047) > (3 || 2047)))) + (!(((0 < 3) && (2 || 0))) % !((!(2048) <= (017 != 0))))) != ((100 + (((0 != 2048) + (2047 * 65536)) < ((2 == 7) && (2047 <= 3)))) % ((((2 != 3) % (1 || 1)) && ((1 >= 1) < (2048 <= 100))) * (0x10 < ((1 && 0x10) && (0x10 == 2)))))) % 7)) +
+    (((0x10 * 2) <= ((((((3 <= 100) + (3 && 2)) <= ((0x10 <= 100) * +(0x10))) % -(((1 < 2047) > !(2047)))) - 2047) * (1 >= 7))) || ((((((+(3) / (0x10 != 017)) - ((2048 * 7) <= (7 != 100))) != (((2047 == 65536) && 2048) >= ((1 >= 0x10) && (2048 <= 65536)))) >= -(!(((2048 / 2) <= (017 <= 3))))) * ((((2047 > 017) >= 1) >= (((2 == 7) < (2 % 0x10)) - 3)) <= 65536)) <= (0x10 > -((65536 - 1))))) +
+    ((((((((017 / 0x10) >= -(0x10)) < ((0 <= 2) == (1 && 65536))) > (((65536 == 2047) >= (0 * 100)) + ((3 != 100) == (100 + 7)))) != ((((017 > 0x10) < (65536 * 017)) || ((0 >= 7) < (0x10 || 7))) % (+((3 <= 0x10)) < 017))) % (!(017) + ((((2 - 0x10) && 0x10) - ((2048 != 7) >= (65536 != 3))) > (((0 && 100) == (2047 >= 65536)) && 0x10)))) < ((((((0x10 % 3) <= 0) && ((7 >= 2047) - (3 != 2048))) + 2048) + (((!(3) != (100 % 2047)) * (65536 || (3 < 7))) || (((7 >= 0) % -(3)) < ((0 - 3) + (2047 + 017))))) > (((((7 == 2) * (2048 + 2047)) >= ((100 && 65536) + (1 < 0x10))) % (3 < ((0 || 017) || +(65536)))) != ((((3 + 1) > (2 || 1)) == ((0x10 >= 7) + (0 > 65536))) != (((100 <= 017) == (65536 * 100)) >= ((1 && 2) / (1 && 017))))))) / (100 != -(((-(((65536 <= 0x10) != (0 + 0))) <= (((2047 - 65536) % +(0x10)) % ((2047 % 100) * (0x10 + 2047)))) != +((((1 && 3) / (1 / 65536)) / (2048 <= 100))))))) +
+    ((((017 % +((((7 != 65536) / (1 - 3)) >= 100))) <= (((((0 > 2) + (100 * 3)) < ((2 || 2047) || (0x10 <= 2047))) + 100) == ((0 / ((0 != 7) != (100 - 0))) >= (0 <= ((3 * 2048) || (100 < 3)))))) + (((((7 && (100 * 0)) * (2 <= (2 || 3))) < !(((7 == 3) != 1))) == ((((017 >= 2) && (017 && 017)) >= ((017 <= 2) > (2047 * 65536))) * (((1 != 0x10) && 0x10) || ((1 % 2048) > (100 % 017))))) != (((2 < (2047 || 017)) <= (!((2047 || 7)) <= (1 != 65536))) <= 3))) >= (017 && ((0 + (((-(100) % (100 <= 1)) / (-(65536) != (7 < 3))) > (((2047 - 2047) / (2048 || 017)) > ((65536 + 7) % (0x10 != 1))))) / (((((2048 - 100) > (0 == 1)) * ((65536 / 7) != (0x10 % 100))) > (((2047 || 2048) - 0x10) % ((65536 / 7) < 100))) == ((((7 > 2048) % !(2048)) + 2048) < (-(2) + ((0 != 2047) == 7))))))) +
+    (((2047 / (((((017 < 3) * -(0x10)) <= ((7 >= 017) + (3 == 1))) >= (65536 % 2)) + 2048)) || (((((2047 - (0 - 0x10)) % +(1)) != (((7 == 2048) / (017 * 100)) + ((2 > 017) && 0))) <= ((((3 == 017) <= (2048 <= 2047)) || ((65536 >= 100) < (1 && 2))) != (((017 < 2048) - (2 - 7)) * 3))) <= 3)) + 100) +
+    ((1 && ((((((2048 >= 100) <= -(0)) == ((0x10 >= 017) > (1 % 0))) && ((-(017) || (1 != 0x10)) / ((0 / 100) * (7 % 2)))) * ((((0 * 2) - (0 != 2047)) != (1 < (3 >= 100))) - (((100 / 017) == (100 <= 2048)) - 100))) == ((((1 / (017 && 65536)) >= ((1 * 1) <= 3)) - +(((3 >= 017) < (0 || 017)))) % ((((1 && 7) > (2048 % 1)) >= (100 && !(100))) != (((2 < 100) + (2047 < 65536)) > ((7 % 0x10) <= (2047 * 100))))))) >= (7 <= ((017 - (!(!(100)) != 3)) && (100 - 100)))) +
+    2047 +
+    (3 > (((((((2 * 2) / 0) == 017) || (((65536 % 2047) / (100 || 0x10)) <= ((0x10 && 65536) == (3 >= 7)))) && 0) / (((((65536 * 2047) + (2048 && 3)) / !((0 % 7))) % (((2048 >= 2047) >= (65536 < 100)) > (2047 != (2048 || 65536)))) + 2048)) >= (2047 == ((((2 > (2 == 65536)) == ((0 || 100) * (0 < 100))) != (((1 < 3) == 0x10) > ((1 != 2048) || (7 != 65536)))) >= ((((7 == 3) + 017) < (100 < (2048 - 0))) != (((3 >= 100) - (0 + 2)) % ((0x10 && 0x10) % -(0x10)))))))) +
+    ((((((((65536 == 0x10) != (2047 >= 100)) == 1) * 100) % 017) <= ((((100 && (7 + 2)) && ((65536 > 3) < (100 <= 3))) <= (((0x10 - 2) + 2048) / 2047)) <= 7)) || (2048 / (((((1 || 3) - (3 >= 3)) >= 1) / (((017 <= 7) >= (3 || 2)) * ((0x10 >= 017) * (017 != 017)))) == ((((2 % 1) % (2048 / 0x10)) || 1) - (((2048 < 7) != (0x10 * 2)) - 7))))) != (-((3 > 2048)) > (((+((+(1) < (017 + 65536))) || ((-(2048) == (017 >= 65536)) == ((7 * 7) * (0x10 >= 100)))) && (((1 < (2047 <= 2047)) <= 0x10) + (-((65536 <= 0x10)) != (-(0) * (2047 - 65536))))) || ((100 || ((0 * (100 * 7)) % ((1 % 7) * (1 <= 3)))) >= (1 == (((2 + 2047) > (7 == 100)) == ((2 > 2048) / (3 && 100)))))))) +
+    ((((2047 != 2047) % +((((2 - (3 != 3)) || ((65536 > 100) || (0x10 / 0))) % 1))) / (((-((7 || 2048)) == 017) >= (((7 < 017) >= ((2 + 3) * (3 != 100))) % 2047)) || (((((2048 != 017) > (2048 > 0x10)) - (2047 != (100 < 65536))) / (0 > (!(2) <= (0x10 == 1)))) % 100))) > (((((((100 / 7) >= (017 % 100)) >= (0x10 > (2048 < 2))) < +(((7 < 017) != (1 || 0)))) >= ((((0 + 017) == (0x10 >= 3)) / (!(0x10) < (2 != 1))) * 1)) >= 2048) - +(7))) +
+    (65536 != ((((+(+((0x10 != 3))) || (((017 % 100) < 0) % ((2048 >= 100) % (2047 > 7)))) % 2047) != (0x10 >= 017)) / ((((((017 / 7) == (1 * 0x10)) - ((7 - 3) < (1 >= 0x10))) > (((7 || 017) && (0x10 % 2047)) <= ((0x10 + 7) || (017 / 3)))) && (((-(0x10) && +(2)) - 1) / (((3 || 2048) + -(017)) + ((0 % 2) % -(3))))) != !(((((0 && 2047) >= (65536 / 7)) || ((1 && 2047) >= (2048 / 3))) >= (((2048 == 0x10) * (2047 != 3)) + ((0x10 || 2047) > (3 >= 2)))))))) +
+    (((((((7 <= -(65536)) >= 0x10) >= 100) < ((((100 != 017) / (0x10 != 1)) <= (!(3) >= (017 > 100))) + ((+(3) == (2047 || 0)) >= !((2048 >= 100))))) - 2048) + +((+(0x10) + (2047 - (0x10 < ((7 / 65536) + (0 % 2))))))) < 100) +
+    ((((((((7 + 100) && 65536) % ((2 != 017) && 2048)) && (((2048 == 2) && (1 <= 2)) - ((7 - 2048) % (3 <= 65536)))) - ((((0x10 + 65536) + (3 > 65536)) % ((2048 - 2048) || (0x10 >= 2))) > ((1 % (2047 + 1)) && (0 != (2047 != 017))))) * ((((-(0x10) && 3) && (-(2048) != !(7))) * (((017 < 0) && (100 / 017)) > ((3 || 1) < (017 && 2)))) && +((0 >= (!(65536) == !(100)))))) && 65536) >= ((((65536 && -(((65536 % 1) > (0x10 / 65536)))) * ((((100 < 3) >= (3 == 7)) && ((017 * 100) * (0 < 0x10))) <= (0 && ((3 >= 7) == (2 < 2047))))) * 2) || 2)) +
+    (((((7 / (!((100 < 0x10)) - ((2047 - 0) <= 3))) % (7 || (((100 / 3) <= (1 * 2)) >= ((017 != 0x10) && (7 || 100))))) < (1 != 017)) / ((((((65536 >= 0) > (2047 * 100)) == ((65536 || 1) >= (1 >= 2047))) < ((0 >= (0 % 2048)) % -((2048 && 0)))) + ((((100 % 0x10) != 2) < ((1 == 2) >= (0x10 > 2048))) * (((017 * 7) >= (2 == 0x10)) > ((7 - 0x10) <= -(2047))))) + (((((017 == 1) < (0x10 * 017)) <= ((1 * 017) - (0 <= 3))) || (((1 * 0) <= (7 != 0)) < -((1 / 100)))) * 7))) >= (((((((2 >= 2047) <= (017 || 100)) + 0) < -((2 < (65536 >= 7)))) - 1) && -(((!((2 > 0)) - ((2 % 2047) != (0 != 2048))) || 0))) - 65536)) +
+    ((((2 / 7) + +(((((100 != 1) / (1 < 017)) % ((017 % 65536) == (2048 < 100))) >= (((3 <= 7) && 0x10) % ((2 && 0x10) != 100))))) != 2047) <= (((((1 % ((0 < 2048) == (017 == 100))) + (2047 < ((100 <= 2047) && (3 >= 0)))) == ((2 > ((2048 >= 3) / 7)) + (((2048 / 100) && 7) && ((0x10 % 0x10) / 2047)))) - 1) + (((7 < (((2048 || 7) != (65536 || 1)) || (+(1) + (1 * 100)))) - ((((0x10 - 2) < (0 >= 2047)) * (0x10 || (0 > 2))) == (((7 != 0x10) % (100 / 65536)) || !((2 && 0x10))))) % (((((0 + 0) < (7 && 0x10)) > ((100 < 65536) < (2047 * 2))) <= ((0x10 && (0x10 - 0)) % ((017 - 3) > (2048 < 0x10)))) + ((((7 > 100) != (2 != 0x10)) < 2) == +(((0 == 0) >= 017))))))) +
+    (((((0x10 > 017) > (((7 != (1 < 0x10)) == (1 && 1)) > (((2048 <= 0x10) || 100) <= 2))) == (((1 < (65536 >= 2)) / (!(+(2047)) <= -(0))) / ((((2048 && 2047) && 2047) <= ((2048 + 7) || (1 / 0))) > (+((017 / 3)) >= ((2047 || 7) || !(017)))))) / (2 >= 0x10)) - (((((((0 - 0) || (2 != 65536)) || 0) || (((2 / 2048) - +(0x10)) == ((2 < 3) >= (0 > 3)))) >= -((((3 <= 0x10) > (7 < 7)) || 3))) % (0x10 != ((((2048 % 65536) >= (0x10 * 3)) < ((100 > 017) < (0 < 3))) % (1 == ((017 > 65536) != 017))))) * ((((65536 % 2) != 3) - (1 || 2)) >= (!((((2048 != 2047) < (0x10 > 0)) % ((2048 < 100) / (100 && 2048)))) == ((((2048 != 2048) || (2 / 0x10)) != 2048) % (2048 < 017)))))) +
+    (((3 % (+((((0x10 * 3) && -(100)) < 3)) < 017)) <= 2) + ((((3 != (((0x10 + 100) >= (65536 * 100)) / 0x10)) % ((7 * ((100 == 100) || 0x10)) >= ((1 && (0 / 2048)) / ((1 % 2) || (0x10 - 2))))) && (2048 >= ((((017 - 2) / (65536 != 100)) != +((100 >= 2047))) / (((2047 && 3) <= 2048) / 0x10)))) / ((((((7 <= 7) >= (0x10 > 7)) && ((65536 - 65536) * (2047 > 2048))) <= (((65536 / 3) <= (65536 && 7)) < ((2048 * 2048) > (100 || 2047)))) * ((7 < (+(017) == (1 != 3))) < ((2048 > (1 > 1)) == ((0 != 2) > (0x10 < 7))))) + (65536 < (100 < (((2 && 3) >= (3 > 017)) >= ((65536 > 65536) / (100 + 0)))))))) +
+    (!((017 * (((((100 >= 65536) - +(2047)) % +((0x10 - 1))) <= (((2 > 1) / 2048) || ((65536 != 0) <= (100 > 100)))) == ((!((2047 >= 1)) % ((0 + 2048) > (65536 / 65536))) + ((017 * (2048 || 2047)) % ((2048 / 2) > (0x10 / 65536))))))) >= ((((((-(2) % (2048 && 017)) >= !((2048 / 0x10))) + (((0x10 % 7) - 2048) || +((0 % 2047)))) != ((((0x10 || 017) != (3 <= 1)) % ((100 - 017) < (2048 == 0))) + -(((2048 - 7) + (0 == 2047))))) == (((1 && ((2048 < 017) < (7 <= 1))) * (((0 % 017) * (0x10 + 3)) - (!(2) == (017 / 0)))) == ((((7 <= 0) - (2047 / 100)) + ((100 < 0x10) == (7 >= 2048))) / (3 && 1)))) - ((((2047 / 3) == ((0 - (1 > 65536)) >= (+(7) == (2048 || 017)))) + ((((2 * 0) % (0 <= 7)) == 3) || (((65536 != 3) <= +(1)) % 2047))) + (((((0x10 - 2048) && (0 - 017)) && ((017 * 65536) - (2047 + 2047))) % (((2 + 100) > (2048 + 017)) <= ((2047 <= 7) >= 017))) % ((3 * ((2048 * 017) > (2047 > 2048))) / (((7 * 0) * 2048) || 2)))))) +
+    017 +
+    -(+(((((((65536 == 3) / (2 && 7)) || ((0 + 017) / (017 >= 1))) / (0x10 / ((65536 >= 0) % 0x10))) % (+(-((2048 / 2048))) - (1 * ((2047 <= 017) > 017)))) / (65536 < +((((2048 <= 2) == (0 < 2047)) - +((3 % 0)))))))) +
+    (((((-(((2048 <= 2) == -(2048))) <= 100) && (1 == (((017 != 0x10) * 0x10) > ((017 >= 3) <= (2047 + 100))))) != (017 - ((-((0 <= 017)) == ((2047 != 7) <= (0x10 < 2048))) * ((+(1) - (100 + 2047)) > ((0x10 == 0) >= 2047))))) * ((((7 + ((100 || 7) == (1 != 2047))) > (((65536 || 2047) + (0x10 == 2047)) - ((0 > 1) != (7 < 0x10)))) != ((((65536 || 65536) != (100 >= 65536)) && -((3 == 7))) <= (((3 < 0) - (2048 * 2048)) <= ((65536 < 3) + (65536 != 1))))) <= (((((1 + 2047) < (65536 - 0x10)) != !(2)) < (((3 * 7) > (017 <= 0x10)) == (2047 || (100 && 7)))) == +((((0x10 + 7) || (0x10 || 0x10)) % ((2048 + 2) != 65536)))))) || ((65536 < ((((+(3) - 3) <= 1) < (((0x10 < 7) - (2 != 2047)) < ((2048 != 65536) * !(1)))) % 100)) >= (+(((((0x10 + 100) != (7 && 2048)) && ((3 || 3) <= -(0))) > 2047)) / !(((((0 != 1) % (3 * 0)) * ((2 / 2) == (65536 > 100))) + (((2047 > 100) / (2 == 2047)) >= ((017 <= 100) % (2048 - 2048)))))))) +
+    ((((+(((2047 / (2048 > 2047)) < ((1 % 2048) != (0 >= 2047)))) < 100) || (+((017 > ((017 * 3) || (65536 / 0)))) && ((+((017 || 100)) - ((7 < 100) >= (0 * 0))) >= (0 || +(2))))) + (-(-((((2048 > 7) * (0x10 != 2047)) <= (100 + (017 * 3))))) - (((((100 < 3) <= (2 || 2)) && ((1 < 017) % (7 && 65536))) % (2047 < ((1 > 100) <= (3 < 7)))) <= (((0x10 || (2 + 2)) * 2) || (((0 < 1) < !(3)) / +((65536 - 65536))))))) == (((((+((0x10 || 0x10)) == ((100 == 65536) / (1 || 3))) / (((2048 && 0) > (0 % 2048)) + ((65536 + 2047) > (3 % 3)))) - 0x10) < (((2047 != ((2 || 2) != 0x10)) % (((7 > 100) > +(2)) == 0x10)) || (7 - (7 != ((1 - 2047) + (3 + 0)))))) < 2048)) +
+    (+((3 - (-((-((2047 != 017)) <= 1)) != (((100 && 100) - ((65536 % 0x10) != (2 == 2048))) < (((2048 - 2048) <= (2047 - 2)) <= ((0x10 == 7) && (100 > 1))))))) <= (((((((7 != 2) <= 0x10) - ((0x10 - 0x10) + 0x10)) < ((65536 > (7 + 0x10)) >= ((1 % 0x10) % (3 < 2047)))) == 2048) * ((!(((2048 <= 2047) == (017 % 2047))) / 0) == ((((1 / 100) - (100 > 1)) * (65536 > (65536 != 0))) <= (((017 && 0x10) && (0 || 1)) % (2047 * 65536))))) / ((0 < ((+(-(2)) % ((0 > 3) != (2 * 2048))) || (((65536 == 1) + (2048 > 2)) % ((2047 - 0) * (0x10 - 65536))))) - 2047))) +
+    (((-(((((1 > 100) || (65536 > 2048)) / ((017 - 017) / (1 * 0x10))) || (((100 % 017) || (100 != 2048)) * ((017 + 0x10) >= (7 > 0))))) <= ((0 || +(100)) - 2)) + (((1 + (017 > ((100 != 017) / -(3)))) - ((((65536 >= 3) % (3 && 65536)) > -(65536)) != (((2047 < 017) != (3 / 1)) - ((0 || 1) - (3 < 017))))) - 65536)) >= -(((+((1 > !((2048 >= 017)))) || ((0x10 + 100) == (((0 % 2047) == (2047 * 2047)) && ((3 == 2047) / (2048 <= 2048))))) >= (((((2048 > 1) == (2048 > 7)) - (!(2047) + (100 != 0x10))) && (((65536 != 2) == (017 <= 017)) % ((2047 <= 0x10) >= (2047 / 2)))) <= (((+(2) + 0) < ((0x10 != 0x10) <= 0x10)) % (((100 % 2048) < (1 || 7)) + (3 > (65536 - 3)))))))) +
+    +((1 / ((-((((1 * 65536) && +(2048)) < 7)) > ((((1 - 2048) + (65536 % 0x10)) != (100 / (0x10 * 1))) || !(-((0x10 % 2))))) != !(7)))) +
+    (((3 != (((((7 && 0x10) * (1 < 3)) < (7 > 65536)) >= (((65536 && 1) == (0 <= 2047)) > 0x10)) == (0 < (-((7 <= 1)) / ((0x10 / 2048) == (65536 >= 2048)))))) == ((((((3 >= 2) / (2 && 2047)) < ((2 * 2047) <= (3 < 1))) / (((0x10 || 1) > (7 && 2048)) % ((1 < 017) > 100))) - (+(!(!(100))) == (+((2048 == 0)) * ((100 == 3) - (2048 > 2))))) <= ((((!(0) - 0) && (2048 % (2047 + 100))) == ((2048 == (1 / 100)) == ((3 < 2047) != 65536))) >= (((0 % (65536 && 0)) == ((7 <= 65536) || (1 < 2048))) + (2047 && ((2048 >= 0x10) >= (1 && 0))))))) <= ((((((017 + (3 && 2)) == ((2 / 3) / (0 % 017))) == ((1 + (2048 != 7)) != 100)) || (((100 || (1 != 0x10)) % ((100 < 3) <= -(1))) > (((100 != 0) >= (2047 > 7)) == (017 / (3 >= 2))))) != (((0 + (+(3) >= (017 - 7))) - (((0 <= 1) <= (3 * 017)) % (2048 >= +(2)))) == (((2047 > 3) < ((0 / 3) == (0x10 <= 3))) && (2048 <= ((1 * 3) > (7 * 0x10)))))) / 1)) +
+    2 +
+    (((((3 || (((100 != 7) - (7 != 3)) <= ((100 < 0) * (2048 + 3)))) && ((((2047 <= 0) != +(017)) > ((65536 <= 0) > (100 <= 65536))) * (65536 && +((7 + 7))))) || 65536) || (017 == (((((7 != 65536) >= (3 && 2047)) % !((100 * 0))) || (((100 - 0) || (1 < 1)) && ((65536 + 3) + (2047 > 65536)))) <= 7))) + (((((((3 >= 1) * !(2)) - (100 <= (3 / 2))) <= (!(+(65536)) != ((0x10 <= 2047) && (65536 < 017)))) - ((((0 + 0) - (1 - 3)) > ((65536 >= 0) % (2048 + 2047))) + ((100 >= -(0x10)) * 2048))) >= -(+((((017 % 0x10) <= (1 / 100)) || ((3 * 017) || !(017)))))) != 65536)) +
+    ((((((((3 > 65536) % (3 >= 017)) >= 3) > -(((0x10 % 100) < (2 + 0x10)))) * ((((2048 < 0x10) <= (7 >= 100)) >= ((017 + 3) % (2047 || 7))) / ((-(0) / (1 <= 0)) > ((017 == 0) - (7 <= 0))))) < ((0x10 % (((2048 > 100) || (2048 == 2047)) * 3)) <= ((((3 % 0x10) >= 1) > ((1 / 0x10) <= (017 / 2))) != ((2048 || (1 < 0)) != 2)))) / (((((65536 || (1 >= 65536)) % ((2 == 2) / (3 && 3))) <= (((017 < 0) || (7 >= 7)) <= ((2 % 3) / (3 != 1)))) > ((((7 >= 017) * 2) || 65536) > (((7 + 2048) < (0x10 - 2)) || 100))) || (((+((3 >= 017)) < ((017 != 1) && (3 >= 0x10))) == (((2047 > 7) > (65536 && 2048)) && 3)) != 100))) + ((((!(((65536 >= 7) <= (3 >= 2048))) == 2048) == (+((+(2) * (2047 % 3))) <= (((100 >= 65536) && (017 - 65536)) > ((2 != 017) + (2 || 100))))) || ((+(((7 + 017) > 2047)) + ((-(2047) != (2048 == 100)) > ((3 != 2047) - (1 >= 3)))) == 7)) || ((((+((0 != 100)) < ((7 != 100) && (100 && 1))) > 2048) % (((0 <= (3 != 3)) && ((2048 + 7) < (1 >= 3))) && 7)) < (((0x10 * 2) <= 3) > ((((017 > 100) % 7) != ((2 * 2047) != (017 || 2048))) - (7 < 2048)))))) +
+    ((((1 + +(((017 - (1 != 0x10)) * (+(65536) > (65536 * 7))))) == (7 * ((((0x10 * 100) < (7 && 7)) >= ((3 > 2) < (2 == 2048))) - (2048 / !((3 < 0x10)))))) * (((1 % (((1 - 65536) % (1 * 65536)) > ((65536 != 017) == (2 - 65536)))) != (2047 * ((2048 / (017 / 2)) == ((2047 && 017) * (65536 + 1))))) > (1 * 3))) % (((((-((0x10 + 1)) - ((3 && 2047) / (100 || 0x10))) + 7) % (!((3 == (0x10 + 2047))) - (((1 && 0x10) > (100 <= 0)) != ((2 != 2047) - 0)))) + (2 != -((((3 / 0) != (0 > 017)) / ((100 > 017) == (1 && 2)))))) > ((((!((2047 || 3)) % 1) == (((3 && 1) <= (2048 != 2047)) % ((0x10 || 0x10) <= -(017)))) < ((((0x10 >= 7) < (65536 || 7)) >= ((7 % 7) != 3)) + (((1 * 3) >= 0x10) != ((3 && 2047) <= (0 < 0))))) <= (((((2048 > 017) * (3 == 2)) && ((100 || 1) || (0x10 <= 0x10))) - (7 || (7 || 2048))) - (!((-(100) || (2048 / 1))) || ((2047 >= (0 % 0x10)) + ((2 > 017) < (2048 * 100)))))))) +
+    (((((65536 * (((65536 <= 0) < (7 >= 3)) && ((2047 - 0x10) != (017 > 65536)))) != (!(1) != 2048)) || ((((!(65536) * (3 <= 2048)) >= ((3 == 017) > (100 > 1))) <= ((65536 > (0 == 7)) % ((0 && 65536) / +(0)))) <= ((((0x10 + 2) % (2048 >= 0x10)) / 2) > +(((2047 / 7) > 1))))) >= ((((3 <= ((0 == 0) - (1 / 2047))) == (+((65536 > 3)) >= 7)) * ((((7 + 0x10) * (2 > 2047)) - ((2 + 2047) * (2048 == 0x10))) != (((2 >= 100) >= (7 < 7)) / (1 == (2047 + 7))))) != (((((0 * 65536) >= (1 % 2)) && ((0 != 1) * (2048 + 100))) <= (((0 / 65536) + (0 != 1)) < +((0 && 100)))) || +((((017 != 017) > (2048 > 2047)) * ((3 - 3) >= (0x10 >= 2047))))))) <= (((((2 > ((2047 - 7) - (2047 - 2047))) - (2 <= ((3 <= 2) || (100 - 100)))) % 0x10) && !(((((0 && 65536) - (100 < 017)) * (!(3) || 100)) <= (((2 / 0x10) >= (65536 && 2048)) + (0 >= (2047 >= 1)))))) == 2)) +
+    ((!(+(((!((3 + 7)) % ((1 || 2) != (7 < 3))) || (((0 && 0) < (1 * 0)) + ((7 / 2047) && (1 <= 2)))))) * 2048) != (((((((0x10 * 3) < (7 != 3)) != (7 == 100)) % (+((7 <= 65536)) - ((65536 == 100) == (100 || 2)))) && !((((2 - 3) == (3 != 0)) - ((65536 + 100) * (0 != 2048))))) >= (((0 && (100 || (3 != 1))) >= (1 % ((2 % 7) <= 2047))) > 0)) && -((!((((2 * 017) - (65536 < 0)) == !((2048 >= 2048)))) && ((((1 * 2047) && 7) <= ((0x10 >= 3) == (100 && 3))) == (((7 >= 0) || 1) - (-(0) <= (0 && 2047)))))))) +
+    (((65536 >= 2047) + (((+(((2048 < 100) - (65536 < 65536))) - 7) && -((0x10 && ((1 == 017) != (0 != 2048))))) % +((((-(100) != 0) && ((2048 != 2047) + !(017))) >= ((7 >= (017 % 3)) * ((0 != 0) <= (3 || 3))))))) + (((-(100) != ((((2048 / 2) + 0) + ((0x10 + 0) % (0 % 0))) && ((7 / (3 * 2047)) >= ((0 >= 2) || (2047 != 2047))))) <= (((((100 != 100) >= (017 - 100)) <= (2 / (65536 + 2047))) * (((017 < 65536) && (100 * 0)) <= (2047 && !(2)))) != ((((100 >= 65536) == (017 <= 3)) || 0x10) == 2047))) + ((((((0x10 <= 3) - 0) != 1) < ((017 < (65536 / 2)) * ((2 && 017) <= (2 && 0x10)))) > 1) || 0x10))) +
+    (0 >= (2 < +(((+(((100 && 2048) * (0 + 2047))) > (0 * ((100 < 2047) * (65536 >= 0)))) || (2047 < (((7 && 65536) || 0) <= ((3 != 65536) + (2 == 65536)))))))) +
+    ((((2048 != ((((0x10 >= 65536) > 0) && ((100 - 65536) % !(3))) <= (1 % ((100 / 0) % (2048 <= 2048))))) / (+((100 == ((2 / 2048) >= !(100)))) || ((((7 / 2047) > (65536 * 7)) == ((1 < 2048) || 017)) >= +((2 * (65536 - 0)))))) || (100 * ((+(0x10) == (((017 > 2047) <= (017 >= 2047)) < -((7 + 2)))) && ((-((65536 < 100)) * ((65536 >= 2047) && (65536 && 2048))) <= 7)))) && (3 > (017 != (((100 && ((1 != 3) % (0x10 * 2))) - (((2047 / 2047) - (7 / 2048)) == (+(0) <= (1 * 2047)))) > ((((3 == 3) % 2047) * ((100 && 2047) % !(0x10))) != (((017 > 0x10) < (2047 && 0)) - ((0x10 != 3) || -(65536)))))))) +
+    0 +
+    (0x10 < 65536) +
+    ((-(((((017 >= (2 * 1)) <= (-(65536) < (2048 != 0x10))) - (((2048 + 017) && (3 <= 65536)) < (+(2047) > (2048 != 1)))) <= ((+(!(7)) <= ((0x10 < 100) + 017)) - (((2047 + 2047) < (2047 % 3)) != 2)))) < 2047) > !(((((((017 + 65536) - 0) / ((2 - 7) || (2048 * 7))) || (!((2 <= 100)) + (017 >= (1 >= 017)))) + ((((2 || 0x10) - (0 >= 100)) > ((0x10 - 2048) % (0 < 100))) > ((0x10 == +(0x10)) >= 0))) / 3))) +
+    -((((((((2048 < 3) > 100) * 017) / (((2048 * 0x10) >= (2047 - 2)) && ((2048 * 7) == 2048))) * ((((2048 % 2047) && 0) < ((017 > 2047) * -(0x10))) && (2047 < (+(2048) % (2048 != 100))))) - (!((((7 >= 65536) > (3 && 2048)) > ((3 != 0x10) + (7 + 7)))) * ((((65536 > 2048) - (7 || 7)) || ((3 % 2048) || 2)) || !(7)))) + (((((-(0) && (65536 + 7)) + (0 / 2047)) != 7) % ((((100 % 100) < 2047) > (2047 + (2 - 0x10))) % (-((7 * 65536)) / (-(2048) <= (65536 == 2048))))) + (((((100 >= 2048) / 2) > ((0 % 017) == (017 - 0))) > (7 == (+(100) != (017 - 65536)))) + ((((3 - 100) <= (2047 - 65536)) + ((2047 <= 3) > (017 <= 0))) > !(((3 >= 100) * (100 + 3)))))))) +
+    (((2047 >= ((2047 - (2048 || (!(2048) >= (1 == 100)))) <= 2048)) >= +(+((!(+((1 >= 100))) != (0x10 / -(!(0))))))) % ((3 == (((((2 / 100) - (7 * 3)) * 2048) + (((2047 >= 0x10) * (65536 % 2048)) + ((2048 % 017) == 3))) >= +((((1 != 2) > (2 % 100)) > -((0 <= 3)))))) && (!(2) + -(((((0 != 2) / (2048 + 2048)) || (2 >= (0 >= 017))) % (017 / ((0 <= 3) % (0 || 1)))))))) +
+    (0x10 > ((0 / (65536 + (((2 == +(2048)) * -((0 - 1))) - (((100 >= 017) + (017 - 2047)) != ((1 <= 65536) || 100))))) || 1)) +
+    (100 > (7 || ((((((7 || 65536) == (017 != 0)) <= ((65536 != 2047) >= (65536 == 2047))) <= ((100 >= (017 + 1)) != (!(017) - (1 / 65536)))) / ((((65536 <= 7) == !(100)) < (100 || (0 % 0x10))) > ((017 * (7 != 65536)) && ((2047 <= 2) % (0x10 / 3))))) > (-(((100 != (2047 != 2)) - ((1 >= 100) + 1))) >= ((((0x10 <= 0x10) == !(2048)) - ((2048 <= 2) != (7 > 0x10))) - +(((100 <= 3) && (0 * 100)))))))) +
+    (2047 / 3) +
+    ((((((((2048 + 017) - (65536 % 7)) >= ((2048 || 100) - (65536 - 017))) + (((2047 <= 2047) && (3 + 7)) >= ((3 < 3) || (2 * 0x10)))) && ((((2048 % 100) / (2047 < 7)) >= ((2047 <= 100) != (0x10 > 3))) == (2048 != ((65536 * 017) % (7 || 2048))))) * ((3 || !((100 > (1 != 100)))) > ((017 == ((7 > 2048) > 2)) != (((2047 - 2047) - (0x10 <= 017)) != 0)))) != 1) == (-(((2 * (+(!(100)) > (3 - !(100)))) + ((((0 - 2047) <= (100 || 3)) * ((0 != 7) % (65536 % 2))) + 3))) > (7 + +(((((65536 * 3) && !(0x10)) && (100 == (2047 % 100))) >= 2048))))) +
+    -(2048) +
+    (1 == ((65536 - ((0 - (-((2 || 2)) || ((3 * 0x10) % 100))) < (((0 == (017 != 2048)) != ((2048 < 3) % 65536)) % (((2048 * 2047) >= 100) / ((0 / 65536) >= (100 * 0x10)))))) != ((((((100 * 7) / !(3)) * ((0x10 + 2) / (0 <= 100))) - (((0x10 * 7) <= (3 < 65536)) != ((2048 % 100) == 0))) != 2) > ((((65536 / +(100)) + ((0 + 65536) || 100)) > (0 && (2048 > (3 >= 1)))) == (-((2 - (2047 < 1))) / 0x10))))) +
+    +((((((((65536 + 100) && (2 == 0)) <= 017) <= (((100 != 7) <= (017 >= 0)) + (100 - (7 <= 100)))) / (65536 + (((0 == 0x10) || (100 % 2048)) >= (2047 + (2048 >= 3))))) == (((((2048 <= 1) == (0 && 7)) && ((2047 || 65536) <= (017 != 017))) >= +(((7 && 7) + (100 >= 2)))) * 017)) % ((((!(!(2047)) <= ((2 <= 2) + (65536 / 017))) > (((017 < 2048) || (65536 != 2047)) != (7 <= 017))) >= ((((65536 != 100) - (0 - 2)) > 0) * (100 != ((100 % 2048) * 017)))) / 2047))) +
+    (2 != (((((((2048 - 2047) || (017 - 0x10)) < ((2047 + 65536) / (3 >= 3))) < ((!(2) % (100 * 7)) + (-(0x10) - (2 - 3)))) > ((((2048 >= 7) != (65536 / 0x10)) - ((0x10 != 65536) || +(7))) <= +(((7 % 2) > (2 / 3))))) % (+(!(((2047 - 100) / (2048 && 2047)))) <= +(2))) || (65536 / ((!(-((3 >= 7))) * (1 > ((0 >= 65536) && (2047 % 1)))) - (-((2 && (0 != 65536))) + (0 >= (2047 != +(2047)))))))) +
+    (-((((+(((100 > 2048) && 1)) / (((017 == 2047) < 0x10) && (017 * (2048 < 7)))) >= ((((0 == 1) > (017 + 3)) / ((0x10 == 017) % (100 != 0))) || ((0x10 != (017 == 100)) <= ((7 * 0x10) / (3 == 017))))) / (((((2048 >= 0x10) == (3 / 7)) < ((65536 <= 2) % (2047 > 017))) / (((7 / 65536) + 2047) * 2048)) && (2048 || (((0x10 > 2047) != (7 > 0x10)) >= 0x10))))) != (((((((7 == 100) % (3 % 017)) == (3 >= (017 * 3))) >= ((7 >= (1 * 65536)) >= +(-(0x10)))) - 017) <= 65536) + (7 + 65536))) +
+    +(((2047 != (+(2047) > 017)) >= ((3 + -((2 || ((7 <= 017) / -(100))))) < 1))) +
+    ((((((((3 / 2048) && (0 > 3)) && (!(0) % (65536 - 3))) >= (((3 % 2) % -(0x10)) / (3 && (100 - 3)))) != 017) - ((2 > (((2048 > 100) * (1 == 7)) % 100)) <= 3)) <= (2 / 100)) != (((((2048 == ((7 / 0) > (100 || 2))) < +(!(!(65536)))) % ((((7 < 1) < (0x10 / 2)) + ((017 && 3) == (2 || 2))) == 65536)) < (((((0x10 < 0) * (65536 > 2048)) != ((65536 < 2048) + 2)) > 65536) - ((((7 <= 100) < (2048 < 2048)) == (0 % (2048 % 017))) + +(((3 > 1) < (3 > 100)))))) || (((0 * (((017 * 2047) != 0) / ((2048 - 3) / (2047 || 2)))) || 3) - 0))) +
+    +(((2048 != (((((1 + 100) == (3 > 100)) >= (2048 && (0x10 % 100))) - (((0 - 65536) * (3 + 3)) % (7 % (2048 > 2048)))) + (+(100) < 100))) <= 65536)) +
+    (1 || 0x10) +
+    (0x10 > 1) +
+    ((((!(3) / (0 || (((3 != 65536) < (7 > 2048)) <= ((0 && 3) < !(2047))))) >= ((0 % (((017 % 3) / (017 % 2047)) - 017)) * 2)) % ((!(7) <= (((2047 <= (2047 * 2047)) && ((1 >= 2048) % (0 % 3))) != (((3 + 0x10) || (65536 || 100)) && !((7 / 1))))) < (-((+((2 - 2)) + ((100 == 0x10) <= (65536 / 3)))) && (017 + (((3 + 65536) - (2047 < 0)) == ((2048 != 017) == (2048 || 0x10))))))) && (+((65536 * ((2 != ((2 + 1) == (0x10 == 100))) <= (((3 <= 3) > (100 / 017)) || ((1 + 0x10) >= (2047 >= 0x10)))))) + ((0x10 != (2048 || !(((2048 / 2047) && !(0x10))))) >= ((((2 > (0x10 != 65536)) + 2) >= (3 && ((017 || 017) * (017 || 0)))) - (((+(2) >= 2) % 65536) >= 1))))) +
+    +((1 > ((((((0x10 % 65536) - (3 <= 3)) * ((0 > 65536) || 017)) % ((2047 < (7 % 1)) * -(7))) == ((((2048 <= 2048) == 0) == ((65536 <= 100) < 2)) / (7 >= ((2048 || 2048) <= 0)))) > 2))) +
+    (((017 == (((((017 < 2047) && (1 % 0)) == 017) < (((65536 < 0) % (0x10 / 2)) <= ((1 / 2047) == (2047 - 2048)))) / (!(((65536 * 017) == (2048 == 0))) == (((0 || 2) != (7 % 2047)) >= ((017 / 1) % (2048 || 2047)))))) % ((((((0 != 65536) > (2047 < 65536)) * ((0 % 2) || (65536 % 65536))) > 017) > !((((0 % 017) || (2048 - 7)) > ((0 && 0x10) && (0x10 / 0x10))))) == (100 == (((-(0) && (7 || 65536)) % ((65536 % 2047) < (2048 > 2047))) * (((0x10 && 7) % (100 >= 1)) - ((0 || 0) || (2047 * 100))))))) >= (((((7 != ((2048 * 0) != (017 >= 65536))) - (((65536 - 65536) > (0 < 2)) + ((3 > 017) % 1))) + ((((017 + 7) <= (65536 + 017)) && ((100 > 100) >= (100 && 0x10))) * (((0x10 + 7) <= +(0x10)) - ((3 || 2) >= 1)))) || (+((65536 != 2047)) + ((((1 < 2048) > (0x10 % 1)) / ((3 <= 65536) || (0 - 0))) + ((2048 >= (65536 * 1)) + ((2047 % 7) * (65536 != 7)))))) >= ((((((2 / 2048) >= (2048 - 017)) > ((7 - 65536) && (0 + 017))) * ((2047 < (7 || 2047)) % ((0 + 0x10) > (3 >= 3)))) < ((0x10 + ((3 != 017) - (0 != 2048))) % 2047)) > 2048))) +
+    (((017 + ((-(((100 < 3) + (2 > 017))) * (017 >= ((0x10 < 3) && (2047 % 2048)))) % (((7 != 2) - +(+(3))) > (((017 < 017) == (0x10 != 2048)) || ((7 % 1) / (65536 || 3)))))) >= ((!((((0x10 == 017) - (2 != 0x10)) > 2)) % ((((100 <= 7) != (017 * 7)) + 2048) != (3 < ((2047 <= 2048) / (7 < 2048))))) < (-(2047) * 3))) || (((3 || ((2048 || ((2 % 65536) - (2 % 0x10))) % (2047 != ((017 > 2048) && (0 >= 65536))))) / 1) || (7 * (((-((017 + 2047)) + (!(2) % -(017))) < ((7 % (3 / 2048)) * ((017 * 0) && (2047 + 100)))) && 1)))) +
+    7 +
+    (((3 + (((2048 || ((2 - 2048) / (3 < 0x10))) <= (((1 / 100) < (0 > 65536)) + 65536)) == ((1 || !((2 > 0x10))) && ((100 >= (65536 != 0)) % 7)))) && 3) <= !((1 == 1))) +
+    (((-((2 != 017)) >= (((((0x10 < 7) < (2047 * 017)) == +((7 % 0))) <= (017 % !((65536 || 7)))) < (7 * 2048))) && (((((2 + !(100)) || +(2)) || !(((2047 * 0x10) * 1))) != (2047 > (!(017) && 2048))) && (((((2048 + 100) != -(2047)) - 2) / (((2 % 1) >= (1 - 017)) < (7 > (2 >= 2048)))) < 65536))) % -((((65536 > ((3 != (0 / 65536)) && 0)) * ((100 != ((2 == 2048) && 0x10)) > (((7 + 0x10) / (1 * 3)) <= (100 <= (2 <= 0x10))))) == (((!(2048) == 7) * +(((017 + 0x10) != (3 > 2047)))) > !(((2 == (7 + 0x10)) * ((2 * 2) && (100 > 2)))))))) +
+    (((0x10 + ((((-(017) + -(100)) && ((2 - 017) || (1 == 3))) * (((2 % 0x10) * (3 * 3)) * 017)) % ((0x10 % 65536) < (((3 || 100) || (2048 != 017)) >= ((2 - 100) && (65536 && 2047)))))) - ((((2047 - ((2047 / 0x10) != (0 > 1))) - (((1 <= 017) <= 2048) && (!(017) + (65536 % 3)))) != ((((2047 / 100) + (017 % 2)) && ((0x10 % 2) >= (1 - 7))) > 2048)) / (((((2048 != 2) * !(65536)) * ((100 <= 3) % 0)) > (((2 + 2048) - (0x10 == 0)) * ((3 * 2048) >= 2048))) != (0 / (3 <= ((3 || 65536) - (7 < 7))))))) * 1) +
+    ((0 > ((((((2 == 1) * (2047 && 2)) == ((0x10 >= 017) < (017 / 65536))) || (((100 && 017) && (7 > 2)) > (2047 > 65536))) >= ((((3 >= 2048) != 2) == ((100 >= 2048) && (100 >= 3))) || 2)) - (2047 + ((((0x10 - 100) / 2048) == ((1 && 0x10) || (017 == 017))) + (+(0x10) % ((7 || 65536) / (7 >= 2))))))) + (((2048 && -((((1 != 7) / 2) < ((017 < 2048) - (0x10 || 2))))) >= (((((2048 % 2) < (017 && 2)) - !((65536 > 0))) * (-(3) * 100)) <= ((2 && (0 < (2047 < 65536))) || (1 != ((1 > 2048) == (0 == 65536)))))) == (((!((100 / (100 > 017))) - (((2 || 2) != !(017)) * +(0))) || ((((0x10 && 2048) && (2047 > 1)) / ((0x10 || 2) % 7)) > 7)) >= (((((2048 % 0) || (65536 != 3)) > ((3 == 1) - (100 >= 2))) <= ((100 <= (7 < 0x10)) >= 017)) + +((((100 % 0x10) / (2047 + 2047)) * ((2047 >= 7) > (65536 % 65536)))))))) +
+    (((2048 < ((((017 >= (2 >= 100)) >= ((100 || 7) - !(7))) || (2 || ((0 * 0x10) && (0 <= 1)))) / (((+(0x10) <= (2 % 017)) - ((100 > 65536) + (0x10 % 2048))) % (((2047 != 7) <= (65536 * 1)) >= 2)))) && (+(((((1 * 100) - (2047 != 3)) % ((65536 == 2047) / (1 && 7))) / (((3 - 65536) && (100 * 7)) && 3))) != (((((7 <= 65536) || 100) <= ((65536 > 0x10) - 65536)) / (((7 != 2047) < (2 || 3)) < ((017 || 2) % (1 * 3)))) * ((((1 > 65536) % (2048 - 65536)) || ((2047 < 100) >= (017 >= 65536))) < (((100 == 7) < (0 >= 3)) % ((017 == 3) > (2 - 0))))))) % ((2048 >= (((3 % ((1 * 100) <= (0x10 >= 7))) || (!((2048 + 100)) % (+(2047) % 2047))) >= 1)) - ((((((0 || 7) > (2048 < 0x10)) > 7) < (((3 != 3) && 017) % ((017 && 2048) && (3 || 2048)))) <= ((((100 - 2048) > (0x10 == 0)) < ((100 + 0x10) % (7 && 100))) / 1)) * (((((2047 < 7) && (1 % 0x10)) && (!(0) || (2047 * 0x10))) <= ((+(65536) / (65536 <= 2047)) <= -((7 < 0x10)))) && (0 * (((2 && 2) + (100 / 017)) == ((017 + 2048) % -(65536)))))))) +
+    017 +
+    ((-((((0x10 && (-(2048) && (65536 && 2))) - ((!(1) <= (2047 >= 65536)) <= ((2048 <= 100) / (0x10 * 100)))) == ((0 != ((7 + 2047) && (2 % 0x10))) + 100))) <= (-(((((0x10 || 7) && (100 * 2047)) <= (100 * (65536 - 7))) <= ((2047 / 1) % ((1 > 2047) + (2048 / 3))))) - (((((0 + 65536) * (7 >= 100)) >= +((0 > 3))) % 0) && ((((2048 / 100) + (100 * 3)) && ((0 != 017) - (2048 * 1))) < (((0x10 / 100) || 2047) < ((65536 != 2047) + (100 + 0x10))))))) == (((((((1 < 0x10) && (100 < 0x10)) / (-(017) < (3 % 3))) % 2048) >= (+(!((017 / 0x10))) == !(((0 && 1) >= (0 - 2048))))) + ((((65536 || 1) != 1) < 0x10) <= 65536)) - (((((-(3) * (0 && 0)) <= ((0 == 3) > -(2047))) != 65536) <= ((((017 / 2047) / !(0)) < ((3 * 1) == (2047 && 65536))) - ((0 && !(017)) || (!(2047) || (65536 <= 2048))))) / 2048))) +
+    (((((2047 && 2) != ((((100 || 2) >= 100) + ((65536 + 65536) || (0x10 != 7))) <= (2 >= ((7 >= 2) / (2 == 017))))) > 100) != (1 + (((((1 >= 017) % (1 < 1)) >= (+(2048) < 2048)) <= 7) == ((((65536 % 2048) >= (100 <= 0x10)) || ((2047 > 7) / (0 + 017))) / (2 && ((2048 != 017) < (1 == 2))))))) != 0x10) +
+    (((+(((((2 && 3) && (0 < 017)) || 017) && (((2048 > 1) * 65536) - (+(3) % 65536)))) / +(((-((3 || 017)) - 017) && (((2047 == 017) && (100 == 0x10)) || (017 % 2048))))) >= !((2 || ((((65536 == 7) % 1) * ((0x10 / 0x10) != +(65536))) != (2047 == ((2048 >= 3) % (0x10 == 7))))))) >= ((((3 + !(((1 % 3) - (65536 / 0)))) + ((2047 && 65536) + (((017 != 100) || 2048) / ((100 != 3) + (1 < 2))))) < ((!(1) + !(017)) % 2)) < ((+(((0x10 != (7 == 7)) == (1 >= (100 + 0)))) || ((((017 * 0) != (7 || 017)) % ((100 || 65536) >= (7 / 100))) / (((7 || 7) % (0x10 < 2048)) - ((017 != 65536) + !(0))))) >= (((!((2047 || 0x10)) != 0) <= ((2 && 7) / ((017 % 017) >= (7 || 2047)))) / 017)))) +
+    ((017 || 2) && (!(+((017 / +((+(2048) > (2047 * 3)))))) || ((2048 + ((((3 > 1) > 3) < ((65536 - 0) && (2047 / 2047))) < (((3 >= 0) % (1 <= 100)) != (2048 + (017 || 017))))) - (((((7 > 017) * (65536 % 100)) - (017 == !(0))) % 2048) / (((-(100) && (0x10 * 3)) / ((2047 <= 0x10) * (65536 / 65536))) || -(((2 != 2047) == (0x10 || 1)))))))) +
+    ((2 && ((((0x10 + 2047) < (((017 >= 2) % 2047) != (2 + (7 < 3)))) >= ((((3 < 2047) % (1 - 3)) < 7) == (((2048 * 65536) < (2048 == 2047)) == (7 + (017 * 0))))) || (0x10 * (2 != (((2048 == 3) - (65536 >= 65536)) > !((0x10 * 100))))))) > (((((((100 && 65536) - (100 < 2)) / ((100 && 2048) % (017 % 017))) <= (((65536 / 100) * (2048 - 0x10)) / ((1 <= 2) == (0 == 7)))) * 0) || (017 == 0x10)) * (!(((0 * ((0 + 100) < (3 >= 2))) || 2047)) / (2048 >= 7)))) +
+    1 +
+    ((((((((2047 % 100) || (017 + 2047)) > ((2048 + 100) + (65536 && 2048))) || (65536 + ((2047 && 2048) * (2 > 2047)))) != ((+((3 || 2)) == (3 && (017 && 1))) > (((2 == 0) >= 3) % 0x10))) - (((((65536 < 0x10) || (100 != 2)) * (100 != (65536 / 7))) + (+((7 - 2047)) / 3)) > ((7 + 2047) >= (((65536 || 7) <= !(0)) >= ((3 || 7) > (1 || 0x10)))))) < ((((((2047 * 2048) * (2048 == 1)) < (+(0) % (1 <= 2048))) && (((2047 - 0) % (0 <= 0)) == (+(7) < (017 - 2)))) < ((((1 <= 7) || (100 < 2048)) == ((2047 / 7) != (2048 && 65536))) < +(((1 * 3) / (1 < 100))))) % +(((3 == 0) <= (2048 <= ((2048 == 0) % (100 >= 0))))))) == ((!((0x10 > 2)) * ((65536 <= (+((017 % 1)) / (65536 < (65536 - 3)))) + ((((1 * 2047) <= (100 >= 1)) >= 017) * 017))) <= ((-((((65536 + 0x10) - 2047) != ((2047 || 2048) * !(1)))) || ((((2 != 2047) || (3 + 0x10)) && !((3 / 3))) < 7)) % 2047))) +
+    (((((0x10 + (((2048 - 7) || (017 > 017)) >= (!(3) > !(7)))) - (3 && (-((0x10 < 017)) <= ((017 * 2048) - -(1))))) < 0) && (((((2047 >= +(3)) % ((2048 && 2) || (017 == 017))) >= +(((1 > 2047) - (0x10 < 1)))) / ((((017 / 1) + +(2047)) > -((7 <= 1))) * (((1 * 100) || (2 + 3)) / 1))) * 100)) >= 7) +
+    ((((((017 && ((2047 % 7) == (1 || 0))) == (((2048 / 2) / (017 - 65536)) || ((3 != 100) / (2048 != 3)))) == (017 * (((1 <= 2) >= (7 % 3)) < (-(3) / 2)))) / (((+(+(3)) - ((2 && 0) / 100)) <= -(((017 < 0x10) + (0 == 3)))) == (7 >= 2))) - (-((((0 * (100 % 2048)) >= (3 && (65536 <= 1))) < (((2048 - 017) % (100 < 1)) != (!(2) % (0 > 0x10))))) * (2047 >= ((((1 < 65536) <= !(2048)) > 2047) <= (3 * ((1 / 65536) && (7 - 65536))))))) + (((0x10 >= !((!(2) * ((0x10 + 0x10) || 2048)))) || !(3)) >= ((((-(100) >= ((3 || 2) == (017 < 7))) + (((65536 != 100) * (017 == 100)) + ((0 > 0) > (0x10 > 3)))) && (((2047 == (1 == 100)) != 0x10) > (((2 - 0) == (017 >= 3)) + -(7)))) <= (((3 < ((2047 == 3) != (2047 + 0))) > (65536 - 0)) != (((+(7) / (017 <= 0)) <= ((0 > 0x10) && 017)) > (!((017 == 7)) / ((7 != 2047) > (0 + 2)))))))) +
+    (((100 == ((3 == (((017 * 2048) < (0x10 < 1)) || ((65536 - 2) - (1 % 7)))) % ((((7 && 7) + (0 == 100)) && ((0x10 / 2047) >= (0 + 2))) * 0))) - 2047) < (((-((!((0x10 || 65536)) != ((2 < 0x10) == (0x10 == 1)))) >= (((017 == (1 == 7)) >= ((2048 - 2048) * !(3))) % ((-(2048) && (7 >= 2048)) / ((100 < 017) % (3 % 2))))) || (((0 > ((7 * 100) <= 017)) / 2048) || ((65536 <= ((1 >= 2) / (7 != 0))) - !((-(017) < (1 + 65536)))))) <= (+(((+(0) + ((0 - 2048) > (7 > 017))) < (0x10 > (017 / (0 >= 017))))) >= (((-((0x10 < 7)) * ((0 + 100) <= (7 || 2))) && (((7 + 2047) / (017 != 2048)) <= ((100 + 0x10) * (7 >= 2048)))) != ((((017 / 2047) < (0 < 0)) / ((65536 <= 7) != (65536 < 0))) % (((65536 < 2047) % (100 / 0x10)) * ((1 + 2048) / (1 < 7)))))))) +
+    (!((((((1 > (0x10 <= 0)) && (0x10 >= (100 >= 100))) || !(((65536 || 0x10) > (100 + 2)))) - ((((1 - 0x10) - (1 == 100)) || (+(3) != (0x10 > 7))) - 65536)) / 2048)) == 2) +
+    -(((((+(((017 == 3) < (2 >= 0x10))) < 017) - (((2048 < 100) % ((1 - 7) > (7 && 2))) || (017 > ((7 != 2) == 7)))) * ((100 + (((3 * 2) >= (2047 > 0x10)) * ((3 != 2048) < (0x10 % 1)))) == ((017 && ((017 % 2048) >= 3)) * (((7 + 0) <= (7 - 2)) - ((100 / 2047) && (100 == 017)))))) + ((65536 || 2) && 017))) +
+    ((((((2047 != 7) > 2) >= ((((3 / 2047) <= (0 < 1)) < ((017 >= 100) != (2048 >= 017))) > +(((2048 + 2) * (2048 < 0x10))))) - 017) - (+(((0 + (0x10 >= (2047 <= 65536))) - ((100 < 2) == -((017 * 0x10))))) - 2048)) || (((((((017 && 3) * (017 != 2)) >= 2047) % -(((1 % 1) % (2 + 65536)))) < 1) + (7 || (-(!((0 && 7))) > ((3 != 3) > 3)))) > 3));
+}
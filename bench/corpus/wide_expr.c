@@ -0,0 +1,27 @@
+// 随机生成的大表达式
+int main() {
+  return (0x10 / !((((2 == ((1 > 0) / (2047 == 1))) != (((7 % 7) >= 3) && ((7 * -5) != (-5 <= 0x10)))) < +((((017 != 2) != (7 > 0x10)) / ((65536 % -5) > (7 || 0x10))))))) +
+    (((-(100) >= -5) % (((65536 <= ((2 > -5) - (0 / 2047))) == !(-((65536 + 100)))) < 2048)) != 2048) +
+    ((((2047 - (((017 < -5) >= (2 == 3)) / (2048 - (0x10 >= 2)))) / ((((017 - 2048) % (2048 >= 1)) <= -((65536 / 65536))) + 2048)) == -((((017 - (0 - 1)) < ((100 && -5) > (-5 + 0x10))) != (((7 - 1) != (-5 == 100)) < +((0 < 2)))))) <= ((((+((-5 < 65536)) && ((2 == 2) / (017 - 100))) >= 3) + ((((1 < 2) + (017 * 0)) / ((-5 && 65536) / (0x10 == -5))) == (((100 != 017) + 0) / ((65536 || 65536) % 0x10)))) && (!((((1 <= 2) <= 65536) < ((2 > 7) > (100 * 0x10)))) - (0 != 100)))) +
+    (((((((2048 % 2047) < (7 < 1)) - ((0 >= 2048) - (0 && 2047))) / 0) || ((((2048 > 1) * 1) != (3 == !(2048))) && (((100 >= 0x10) && (100 || 2047)) / ((2047 < 100) || (0 > 1))))) != ((1 % +((!(1) != (-5 + 0)))) != (0x10 - (((65536 > 1) != (2048 || 2048)) * (3 >= (2047 / 7)))))) || (((!(2048) - (((0x10 * 100) || 017) * ((100 == 0x10) || (7 - 65536)))) + ((((7 == 0x10) + 2048) > (2 * (7 * 2047))) <= 100)) + ((-5 || 2047) <= !(+(((1 + 3) == +(0x10))))))) +
+    (0x10 / ((((-((2048 - 3)) % +((65536 && 2048))) * (((2 > 0) || (2047 != 2)) + ((1 || 65536) && +(2)))) == (((+(0) && (3 - 65536)) < ((017 / 2047) || (0x10 % -5))) % 0)) && (100 % 3))) +
+    (((((((65536 != -5) * 0x10) % ((100 == 2048) + (65536 < -5))) && (((7 * 0) <= (100 != -5)) > (1 + (100 % 017)))) != (((3 - (017 == 2)) + ((0 - 0) && (0 < 2))) * (((2048 + 65536) * 100) <= ((0 == 65536) == 1)))) >= 3) % ((2048 > (+((017 || !(100))) * (((2 <= 017) == (3 || 2048)) || 017))) || (2047 + ((((2 && 3) < (2047 * 017)) < ((65536 >= 2048) * (2047 <= 100))) - ((2048 > (2047 < 65536)) == 1))))) +
+    (100 % ((((-5 == ((2047 == 65536) && (3 < 2048))) - (1 - ((-5 != 0x10) * (0x10 || 2047)))) - ((((1 == 017) < (017 / 1)) / !((0x10 + 0))) * (((2048 || 2047) < (65536 <= 2)) || (0x10 || (0 % 2047))))) && +(((((3 * -5) >= (2048 % 0)) == -(2)) != ((017 || (2048 || 100)) || ((7 == 7) - (2047 == 7))))))) +
+    -5 +
+    (-((((+(3) * ((0 % 017) < (1 + -5))) > (((1 && 2) % 7) == (2 && 0x10))) && (1 - (-5 || -((2047 == 3)))))) > ((((((017 >= 100) > (0 + -5)) >= ((2047 == 3) + -(100))) && (((017 < 0x10) != (0x10 && 65536)) - ((1 > -5) < (2048 + 2048)))) < ((1 < (65536 == (017 != 65536))) && (((0 < 0) >= (-5 >= 2048)) / ((65536 || 100) < (0x10 != 0x10))))) <= (((1 && 3) * (((0 % 7) > (7 < -5)) > 0x10)) + ((((2047 < -5) < !(-5)) != ((1 / 2047) < (2048 != 100))) - 017)))) +
+    (((((((2 % 100) / (2047 <= 65536)) >= ((017 + 0) != (2048 == 100))) + ((+(2047) != (65536 == 100)) <= ((7 < 2) != (7 == 0)))) * ((((0x10 && 1) / (65536 / 100)) < ((3 % 7) + (65536 <= 1))) == (((0 + 2048) || (3 / 7)) / ((2 != 0x10) >= -(3))))) > ((((+(017) && (1 % 7)) <= ((1 % 3) != (2 < 2047))) < (((0x10 + 100) / (1 / 2048)) == ((0 > -5) && (7 < 2047)))) + 017)) + (3 >= (3 && ((((1 && 2047) / (0 < 100)) || ((0x10 != 017) && !(7))) < +(((3 && 65536) || (7 && 1))))))) +
+    (+((((((2 <= 0) - 2) - ((-5 >= 017) == 65536)) + (((2048 - 0x10) && (2048 - 017)) == !((2048 * 65536)))) && 2047)) / (((!((100 == (100 + 100))) >= (((2047 == 2) && (0 % 2048)) * 7)) == (((-(0) * 2) <= (!(0x10) % (1 - 2047))) || (((3 || 7) >= +(2048)) >= ((7 > 7) + !(7))))) < ((((+(0) >= 017) + ((0x10 > 7) * (0 || 0x10))) * (((0x10 - 2) > +(65536)) - (-(65536) / 2048))) != ((((-5 <= 0x10) <= (7 % 2047)) == 3) > (((0x10 <= -5) == (-5 == 0x10)) - ((2 && 0) - -5)))))) +
+    ((((7 != (((0x10 < 2) % 0x10) - 0x10)) && 2047) < (((((3 >= 65536) * (017 <= 0)) / ((2048 <= 2048) * (2 && 2))) > 2047) + ((((017 == 1) < (-5 != 0x10)) && ((1 - 3) * (017 >= 7))) != (((2 || 1) / (0 && -5)) <= +((7 + 2047)))))) <= !(2)) +
+    ((((100 + (0 * 2048)) - 2047) < ((((1 != (0x10 != 2048)) && -((2 && 100))) != (((0x10 && 0x10) % (2047 - 1)) >= ((0 > 7) >= (2 < 2048)))) <= (0x10 % (((-5 > 3) && (65536 - 2047)) + ((0x10 - 2048) != (2 && -5)))))) != 1) +
+    ((1 - (((((0 >= 1) / !(0)) * ((100 && 0x10) >= (2 >= 0x10))) + ((+(1) == (65536 <= 2047)) + 2048)) == ((((2 && -5) % (3 / -5)) <= ((2048 % 7) - (-5 <= 2))) / -(((2047 >= 1) > (2 || 0x10)))))) % (2048 < ((0 > (((2 + 2047) != (1 > -5)) || 2048)) / !((((7 > 1) * (100 / 65536)) >= (7 + (3 % 100))))))) +
+    (017 * ((65536 * (100 >= 2)) == ((2048 <= ((2047 % 017) == !((100 / 2)))) || (!(((100 * 65536) % 2047)) / (((0x10 != 0x10) && (0x10 > 65536)) == 1))))) +
+    2 +
+    (7 < ((0 >= 0x10) % (((-(2048) == ((0x10 < 1) != 100)) || (((-5 < 2047) + (7 != 65536)) == ((2 == 1) * (2 || 7)))) && (2 * (((2047 > 2047) >= (2047 + -5)) % (+(2047) <= 7)))))) +
+    100 +
+    ((((((7 / (2048 - 3)) > ((100 && 017) / (65536 / 65536))) - (((7 / 7) - (1 - 0x10)) != ((65536 || 0x10) || (1 * 2048)))) / 7) && (65536 % ((((0 <= 7) * (2048 && 3)) != ((65536 - 2) + (0x10 || 2047))) > (65536 >= ((65536 || 1) <= (0x10 || 7)))))) > (((-(((65536 - 1) <= (-5 == 3))) * (((-5 * 2047) % +(0)) / ((2047 <= 65536) / (0x10 == 1)))) >= ((((2047 && 0) > (0 / 017)) * ((2048 && 100) / -(2048))) % (((2 || 2048) * 1) != ((100 - 7) == (3 > 0x10))))) <= (((((2047 > 2048) * (3 - 7)) && ((1 || 65536) / +(2))) || (((100 < 100) * (1 * 100)) == 3)) > ((((2047 - 2048) < (100 || 7)) > (017 && (0 && 65536))) + (((0x10 && 2) != (100 && 65536)) >= ((1 >= 2) <= (0x10 > 2048))))))) +
+    1 +
+    (((((((100 <= -5) == (65536 > 0)) / ((-5 * 0) * (0 / 0x10))) != (((2 + 7) > (-5 + 65536)) < (017 % (65536 || 100)))) == 0) * 0) + ((((((65536 % 2048) * 0) - ((100 <= 0) / (7 % -5))) > 100) <= 2048) + ((((+(2048) != (3 == 100)) / ((100 < 7) < (017 <= 0x10))) < (((2047 - 65536) / 1) - ((3 % 0) < (0x10 >= 2047)))) - ((((-5 % 3) % (1 + 7)) / -((0x10 && 7))) + (!((65536 / 65536)) != ((2 >= 100) > (-5 == 7))))))) +
+    (-(((((017 % 2047) >= ((2047 + 1) || !(3))) / ((7 && (2048 * 7)) && ((7 || -5) + (2048 == 2)))) != 0)) * 2048) +
+    !((2047 < 7)) +
+    !(0);
+}
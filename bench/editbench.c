@@ -0,0 +1,231 @@
+// 增量编译的编辑延迟测试：模拟编辑器在每次按键后经编译服务重新编译同一文件
+// 每次对源码做一处单字符修改（改写十进制常量中的一位数字，或在空白处插入一个空格），
+// 先以 -incremental 编译，再以同样的参数完整编译作为对照，报告两者的延迟分位数
+// 用法：editbench -socket <套接字> [选项] <源文件>
+//   -edits N           修改次数（默认 200）
+//   -args "A B ..."    编译参数，以空格分隔（默认 -riscv）
+//   -seed S            随机种子（默认 1）
+//   -out DIR           输出目录（默认 /tmp）
+//   -check             比较每次增量编译与完整编译的输出，不一致时报告
+//   -shutdown          结束后请求服务关闭
+// 有请求失败或输出不一致时以非零状态退出
+#include <limits.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include "bench_util.h"
+#include "server.h"
+
+#define MAX_ARGS 32
+
+typedef struct {
+    const char *socket_path;
+    const char *out_dir;
+    int edits;
+    unsigned seed;
+    bool check;
+    bool shutdown;
+    char *args[MAX_ARGS];   // mode 之后、-o 之外的编译参数；args[0] 为 mode
+    int arg_count;
+} Options;
+
+static void report(const char *name, long *latency_us, int n) {
+    qsort(latency_us, n, sizeof(long), compare_long);
+    double sum = 0;
+    for (int i = 0; i < n; i++) sum += latency_us[i];
+    printf("%-12s latency us: p50 %ld  p90 %ld  p99 %ld  max %ld  mean %.0f\n", name,
+           percentile(latency_us, n, 50), percentile(latency_us, n, 90), percentile(latency_us, n, 99),
+           latency_us[n - 1], sum / n);
+}
+
+// 随请求发送源码编译一次，返回退出状态（通信失败为 -1），*elapsed_us 为往返延迟
+static int compile_source(const Options *options, const char *output, bool incremental, const char *source,
+                          size_t len, long *elapsed_us) {
+    char *argv[MAX_ARGS + 8];
+    int argc = 0;
+    argv[argc++] = options->args[0];
+    argv[argc++] = "-";
+    argv[argc++] = "-o";
+    argv[argc++] = (char *)output;
+    for (int i = 1; i < options->arg_count; i++) argv[argc++] = options->args[i];
+    if (incremental) argv[argc++] = "-incremental";
+    argv[argc] = NULL;
+
+    double start = now_us();
+    int status = -1;
+    int fd = client_connect(options->socket_path);
+    if (fd >= 0) {
+        CompileRequest request = {argc, argv, (char *)source, len};
+        if (client_compile(fd, &request, &status, NULL, NULL) != 0) status = -1;
+        close(fd);
+    }
+    *elapsed_us = (long)(now_us() - start);
+    return status;
+}
+
+static bool is_ident_char(char c) {
+    return (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') || (c >= '0' && c <= '9') || c == '_';
+}
+
+/**
+ * 对源码做一处单字符修改，保持程序合法：
+ * 偶数次改写一个十进制常量（不以 0 开头）中的一位数字，奇数次在某个空白字符之后插入一个空格
+ * source 的容量须比 *len 多至少 1 字节
+ */
+static void apply_edit(char *source, size_t *len, int index, unsigned *seed) {
+    size_t n = *len;
+    size_t *candidates = malloc((n ? n : 1) * sizeof(size_t));
+    size_t count = 0;
+    bool digits = index % 2 == 0;
+    for (size_t i = 0; i < n; i++) {
+        if (digits) {
+            // 十进制常量：前面不是标识符字符，首位为 1-9，之后全为数字
+            if (source[i] < '1' || source[i] > '9' || (i > 0 && is_ident_char(source[i - 1]))) continue;
+            size_t end = i + 1;
+            while (end < n && source[end] >= '0' && source[end] <= '9') end++;
+            if (end < n && is_ident_char(source[end])) continue;
+            for (size_t d = i; d < end; d++) candidates[count++] = d;
+            i = end - 1;
+        } else if (source[i] == ' ' || source[i] == '\n') {
+            candidates[count++] = i + 1;
+        }
+    }
+
+    if (count > 0) {
+        size_t pos = candidates[rand_r(seed) % count];
+        if (digits) {
+            // 首位不能改成 0，否则成为八进制常量
+            bool leading = pos == 0 || source[pos - 1] < '0' || source[pos - 1] > '9';
+            char c;
+            do {
+                c = (char)((leading ? '1' : '0') + rand_r(seed) % (leading ? 9 : 10));
+            } while (c == source[pos]);
+            source[pos] = c;
+        } else {
+            memmove(source + pos + 1, source + pos, n - pos);
+            source[pos] = ' ';
+            (*len)++;
+        }
+    }
+    free(candidates);
+}
+
+static bool same_file(const char *a, const char *b) {
+    FILE *fa = fopen(a, "rb"), *fb = fopen(b, "rb");
+    bool same = fa && fb;
+    while (same) {
+        int ca = fgetc(fa), cb = fgetc(fb);
+        if (ca != cb) same = false;
+        if (ca == EOF || cb == EOF) break;
+    }
+    if (fa) fclose(fa);
+    if (fb) fclose(fb);
+    return same;
+}
+
+static void usage(void) {
+    fprintf(stderr, "usage: editbench -socket <path> [-edits N] [-args \"-riscv ...\"] [-seed S] [-out DIR]\n"
+                    "                 [-check] [-shutdown] <source>\n");
+}
+
+int main(int argc, char *argv[]) {
+    Options options;
+    memset(&options, 0, sizeof(options));
+    options.edits = 200;
+    options.seed = 1;
+    options.out_dir = "/tmp";
+    const char *args = "-riscv";
+    const char *file = NULL;
+
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "-socket") == 0 && i + 1 < argc) {
+            options.socket_path = argv[++i];
+        } else if (strcmp(argv[i], "-edits") == 0 && i + 1 < argc) {
+            options.edits = atoi(argv[++i]);
+        } else if (strcmp(argv[i], "-args") == 0 && i + 1 < argc) {
+            args = argv[++i];
+        } else if (strcmp(argv[i], "-seed") == 0 && i + 1 < argc) {
+            options.seed = (unsigned)strtoul(argv[++i], NULL, 10);
+        } else if (strcmp(argv[i], "-out") == 0 && i + 1 < argc) {
+            options.out_dir = argv[++i];
+        } else if (strcmp(argv[i], "-check") == 0) {
+            options.check = true;
+        } else if (strcmp(argv[i], "-shutdown") == 0) {
+            options.shutdown = true;
+        } else if (argv[i][0] == '-' || file) {
+            usage();
+            return 2;
+        } else {
+            file = argv[i];
+        }
+    }
+    if (!options.socket_path || !file || options.edits < 1) {
+        usage();
+        return 2;
+    }
+
+    char *args_copy = malloc(strlen(args) + 1);
+    strcpy(args_copy, args);
+    for (char *tok = strtok(args_copy, " "); tok && options.arg_count < MAX_ARGS - 1; tok = strtok(NULL, " ")) {
+        options.args[options.arg_count++] = tok;
+    }
+    if (options.arg_count == 0) {
+        usage();
+        return 2;
+    }
+
+    // 每次修改最多插入一个字符
+    size_t len = 0;
+    char *source = read_file(file, &len, options.edits);
+    if (!source) {
+        fprintf(stderr, "editbench: cannot read %s\n", file);
+        return 1;
+    }
+
+    char dir[PATH_MAX], inc_output[PATH_MAX + 32], full_output[PATH_MAX + 32];
+    if (!realpath(options.out_dir, dir)) {
+        fprintf(stderr, "editbench: cannot resolve %s\n", options.out_dir);
+        return 1;
+    }
+    snprintf(inc_output, sizeof(inc_output), "%s/editbench_incremental.out", dir);
+    snprintf(full_output, sizeof(full_output), "%s/editbench_full.out", dir);
+
+    // 第一次增量编译建立会话，相当于一次完整编译
+    long initial_us;
+    int failures = compile_source(&options, inc_output, true, source, len, &initial_us) != 0;
+
+    long *inc_us = calloc(options.edits, sizeof(long));
+    long *full_us = calloc(options.edits, sizeof(long));
+    int mismatches = 0;
+    unsigned seed = options.seed;
+    for (int i = 0; i < options.edits; i++) {
+        apply_edit(source, &len, i, &seed);
+        int inc_status = compile_source(&options, inc_output, true, source, len, &inc_us[i]);
+        int full_status = compile_source(&options, full_output, false, source, len, &full_us[i]);
+        failures += inc_status != 0 || full_status != 0;
+        if (options.check && (inc_status != full_status || !same_file(inc_output, full_output))) {
+            fprintf(stderr, "editbench: edit %d: incremental output differs from full compilation\n", i);
+            mismatches++;
+        }
+    }
+
+    printf("%s: %zu bytes, %d edit(s), %d failed", file, len, options.edits, failures);
+    if (options.check) printf(", %d mismatch(es)", mismatches);
+    printf("\ninitial      latency us: %ld\n", initial_us);
+    report("incremental", inc_us, options.edits);
+    report("full", full_us, options.edits);
+
+    if (options.shutdown) {
+        int fd = client_connect(options.socket_path);
+        if (fd < 0 || client_shutdown(fd) != 0) fprintf(stderr, "editbench: shutdown request failed\n");
+        if (fd >= 0) close(fd);
+    }
+
+    free(inc_us);
+    free(full_us);
+    free(source);
+    free(args_copy);
+    return failures || mismatches ? 1 : 0;
+}
@@ -0,0 +1,140 @@
+// 词法分析器基准：手写词法分析器（lexer.c）与 Flex 生成的词法分析器（sysy.l）对比
+// 用法：lexbench [输入大小(MB)] [输入文件]
+// 不指定输入文件时生成合成输入，空白与注释占比与生成代码相近
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#include "ast.h"
+#include "sysy.tab.h"
+#include "lexer.h"
+
+// Flex 生成的词法分析器以 flex_yy 为前缀编译
+extern FILE *flex_yyin;
+extern int flex_yylex(void);
+extern void flex_yyrestart(FILE *input_file);
+
+// 两个词法分析器共用的语义值（通常由 Bison 生成的解析器定义）
+YYSTYPE yylval;
+
+typedef struct {
+    long tokens;
+    unsigned long long hash;
+} LexResult;
+
+static const char *chunk =
+    "/* generated function\n"
+    " * with a multi-line block comment\n"
+    " */\n"
+    "int func_%d() {\n"
+    "    // line comment explaining the expression below\n"
+    "    return (counter_value_%d + 0x7fff) * 017 - !(a_long_identifier <= 42) && b || c != 123456;\n"
+    "}\n"
+    "\n"
+    "        \t\t\n";
+
+static void generate_input(const char *path, long bytes) {
+    FILE *f = fopen(path, "w");
+    if (!f) {
+        fprintf(stderr, "Failed to create input: %s\n", path);
+        exit(1);
+    }
+    long written = 0;
+    for (int i = 0; written < bytes; i++) {
+        written += fprintf(f, chunk, i, i);
+    }
+    fclose(f);
+}
+
+static double now(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+static void mix(LexResult *r, unsigned long long x) {
+    r->hash = (r->hash ^ x) * 1099511628211ULL;
+}
+
+// 扫描整个文件一遍，返回耗时（秒）
+static double run_lexer(int use_flex, const char *path, LexResult *r) {
+    FILE *f = fopen(path, "r");
+    if (!f) {
+        fprintf(stderr, "Failed to open input: %s\n", path);
+        exit(1);
+    }
+    memset(r, 0, sizeof(*r));
+    r->hash = 14695981039346656037ULL;
+    if (use_flex) {
+        flex_yyin = f;
+        flex_yyrestart(f);
+    } else {
+        yyin = f;
+    }
+
+    double start = now();
+    for (;;) {
+        int tok = use_flex ? flex_yylex() : yylex();
+        if (tok == 0) break;
+        r->tokens++;
+        mix(r, (unsigned long long)tok);
+        if (tok == IDENT) {
+            for (const char *s = yylval.str_val; *s; s++) mix(r, (unsigned char)*s);
+            free(yylval.str_val);
+        } else if (tok == INT_CONST) {
+            mix(r, (unsigned)yylval.int_val);
+        }
+    }
+    double elapsed = now() - start;
+    fclose(f);
+    return elapsed;
+}
+
+int main(int argc, const char *argv[]) {
+    long mb = argc > 1 ? atol(argv[1]) : 16;
+    const char *path = argc > 2 ? argv[2] : NULL;
+    char temp_path[] = "/tmp/lexbench_XXXXXX.c";
+    if (!path) {
+        int fd = mkstemps(temp_path, 2);
+        if (fd < 0) {
+            fprintf(stderr, "Failed to create temp file\n");
+            return 1;
+        }
+        close(fd);
+        generate_input(temp_path, mb << 20);
+        path = temp_path;
+    }
+
+    FILE *f = fopen(path, "r");
+    if (!f) {
+        fprintf(stderr, "Failed to open input: %s\n", path);
+        return 1;
+    }
+    fseek(f, 0, SEEK_END);
+    double size_mb = ftell(f) / (1024.0 * 1024.0);
+    fclose(f);
+
+    const int rounds = 5;
+    const char *names[2] = {lexer_kernel_name(), "flex"};
+    double best[2] = {1e30, 1e30};
+    LexResult results[2];
+    for (int i = 0; i < rounds; i++) {
+        for (int which = 0; which < 2; which++) {
+            double t = run_lexer(which, path, &results[which]);
+            if (t < best[which]) best[which] = t;
+        }
+    }
+
+    printf("input: %.1f MB, %ld tokens\n", size_mb, results[0].tokens);
+    for (int which = 0; which < 2; which++) {
+        printf("%-8s %8.2f ms  %8.1f MB/s\n", names[which], best[which] * 1e3, size_mb / best[which]);
+    }
+    printf("speedup: %.2fx\n", best[1] / best[0]);
+
+    int same = results[0].tokens == results[1].tokens && results[0].hash == results[1].hash;
+    if (!same) fprintf(stderr, "token streams differ!\n");
+
+    if (path == temp_path) unlink(temp_path);
+    return same ? 0 : 1;
+}
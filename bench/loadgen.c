@@ -0,0 +1,255 @@
+// 编译服务负载生成器：多个并发客户端经 Unix 域套接字向编译服务发送编译请求，报告延迟分位数与吞吐量
+// 用法：loadgen -socket <套接字> [选项] <源文件>...
+//   -requests N        请求总数（默认 1000），按顺序轮流使用各源文件
+//   -concurrency C     并发客户端数（默认 4），每个请求使用一个新连接
+//   -args "A B ..."    编译参数，以空格分隔（默认 -riscv）
+//   -inline            随请求发送源码，而不是发送路径由服务读取
+//   -out DIR           输出目录（默认 /tmp）
+//   -compiler PATH     另以每个请求启动一个编译器进程的方式跑同样的负载作为对照
+//   -shutdown          结束后请求服务关闭
+// 有请求失败时以非零状态退出
+#include <errno.h>
+#include <fcntl.h>
+#include <limits.h>
+#include <pthread.h>
+#include <spawn.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/wait.h>
+#include <unistd.h>
+#include "bench_util.h"
+#include "server.h"
+
+#define MAX_ARGS 32
+
+extern char **environ;
+
+typedef struct {
+    const char *socket_path;
+    const char *compiler;
+    const char *out_dir;
+    int requests;
+    int concurrency;
+    bool send_source;
+    bool shutdown;
+    char *args[MAX_ARGS];   // mode 之后、-o 之外的编译参数；args[0] 为 mode
+    int arg_count;
+    char **files;           // 源文件的绝对路径
+    char **sources;         // -inline 时各文件的内容
+    size_t *source_lens;
+    int file_count;
+} Options;
+
+// 一次负载：每个客户端线程负责下标 id, id + C, id + 2C, ... 的请求
+typedef struct {
+    const Options *options;
+    bool spawn;             // 以进程方式编译
+    long *latency_us;       // 按请求下标记录延迟
+    int failures;
+    pthread_mutex_t lock;
+} Load;
+
+typedef struct {
+    Load *load;
+    int id;
+} Client;
+
+// 组装第 index 个请求的参数：mode input -o output [args...]
+static int build_argv(const Options *options, int index, int client, char *output, size_t output_size,
+                      char **argv) {
+    snprintf(output, output_size, "%s/loadgen_%d.out", options->out_dir, client);
+    int argc = 0;
+    argv[argc++] = options->args[0];
+    argv[argc++] = options->files[index % options->file_count];
+    argv[argc++] = "-o";
+    argv[argc++] = output;
+    for (int i = 1; i < options->arg_count; i++) argv[argc++] = options->args[i];
+    argv[argc] = NULL;
+    return argc;
+}
+
+// 启动一个编译器进程完成请求，返回退出状态
+static int spawn_compiler(const char *compiler, int argc, char **argv) {
+    char *spawn_argv[MAX_ARGS + 8];
+    spawn_argv[0] = (char *)compiler;
+    for (int i = 0; i < argc; i++) spawn_argv[i + 1] = argv[i];
+    spawn_argv[argc + 1] = NULL;
+
+    posix_spawn_file_actions_t actions;
+    posix_spawn_file_actions_init(&actions);
+    posix_spawn_file_actions_addopen(&actions, STDERR_FILENO, "/dev/null", O_WRONLY, 0);
+    pid_t pid;
+    int ret = posix_spawn(&pid, compiler, &actions, NULL, spawn_argv, environ);
+    posix_spawn_file_actions_destroy(&actions);
+    if (ret != 0) return -1;
+    int status;
+    while (waitpid(pid, &status, 0) < 0) {
+        if (errno != EINTR) return -1;
+    }
+    return WIFEXITED(status) ? WEXITSTATUS(status) : -1;
+}
+
+static void *client_main(void *arg) {
+    Client *client = arg;
+    Load *load = client->load;
+    const Options *options = load->options;
+    int failures = 0;
+    for (int i = client->id; i < options->requests; i += options->concurrency) {
+        char output[PATH_MAX];
+        char *argv[MAX_ARGS + 8];
+        int argc = build_argv(options, i, client->id, output, sizeof(output), argv);
+        int file = i % options->file_count;
+
+        // 与 compiler --client 相同，每个请求一个连接，连接的开销计入延迟
+        double start = now_us();
+        int status = -1;
+        if (load->spawn) {
+            status = spawn_compiler(options->compiler, argc, argv);
+        } else {
+            int fd = client_connect(options->socket_path);
+            if (fd >= 0) {
+                CompileRequest request = {argc, argv, NULL, 0};
+                if (options->send_source) {
+                    request.source = options->sources[file];
+                    request.source_len = options->source_lens[file];
+                }
+                if (client_compile(fd, &request, &status, NULL, NULL) != 0) status = -1;
+                close(fd);
+            }
+        }
+        load->latency_us[i] = (long)(now_us() - start);
+        failures += status != 0;
+    }
+
+    pthread_mutex_lock(&load->lock);
+    load->failures += failures;
+    pthread_mutex_unlock(&load->lock);
+    return NULL;
+}
+
+// 跑一次负载并输出结果，返回失败的请求数
+static int run_load(const Options *options, bool spawn) {
+    Load load;
+    load.options = options;
+    load.spawn = spawn;
+    load.failures = 0;
+    load.latency_us = calloc(options->requests, sizeof(long));
+    pthread_mutex_init(&load.lock, NULL);
+
+    Client *clients = calloc(options->concurrency, sizeof(Client));
+    pthread_t *threads = calloc(options->concurrency, sizeof(pthread_t));
+    double start = now_us();
+    for (int i = 0; i < options->concurrency; i++) {
+        clients[i].load = &load;
+        clients[i].id = i;
+        pthread_create(&threads[i], NULL, client_main, &clients[i]);
+    }
+    for (int i = 0; i < options->concurrency; i++) pthread_join(threads[i], NULL);
+    double elapsed = now_us() - start;
+
+    int n = options->requests;
+    qsort(load.latency_us, n, sizeof(long), compare_long);
+    double sum = 0;
+    for (int i = 0; i < n; i++) sum += load.latency_us[i];
+    printf("%-7s %d request(s), %d client(s), %d failed, %.1f req/s\n", spawn ? "spawn" : "server", n,
+           options->concurrency, load.failures, n / (elapsed * 1e-6));
+    printf("        latency us: p50 %ld  p90 %ld  p99 %ld  max %ld  mean %.0f\n", percentile(load.latency_us, n, 50),
+           percentile(load.latency_us, n, 90), percentile(load.latency_us, n, 99), load.latency_us[n - 1], sum / n);
+
+    free(threads);
+    free(clients);
+    free(load.latency_us);
+    pthread_mutex_destroy(&load.lock);
+    return load.failures;
+}
+
+static void usage(void) {
+    fprintf(stderr, "usage: loadgen -socket <path> [-requests N] [-concurrency C] [-args \"-riscv ...\"] [-inline]\n"
+                    "               [-out DIR] [-compiler PATH] [-shutdown] <source>...\n");
+}
+
+int main(int argc, char *argv[]) {
+    Options options;
+    memset(&options, 0, sizeof(options));
+    options.requests = 1000;
+    options.concurrency = 4;
+    options.out_dir = "/tmp";
+    const char *args = "-riscv";
+
+    int first_file = argc;
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "-socket") == 0 && i + 1 < argc) {
+            options.socket_path = argv[++i];
+        } else if (strcmp(argv[i], "-requests") == 0 && i + 1 < argc) {
+            options.requests = atoi(argv[++i]);
+        } else if (strcmp(argv[i], "-concurrency") == 0 && i + 1 < argc) {
+            options.concurrency = atoi(argv[++i]);
+        } else if (strcmp(argv[i], "-args") == 0 && i + 1 < argc) {
+            args = argv[++i];
+        } else if (strcmp(argv[i], "-inline") == 0) {
+            options.send_source = true;
+        } else if (strcmp(argv[i], "-out") == 0 && i + 1 < argc) {
+            options.out_dir = argv[++i];
+        } else if (strcmp(argv[i], "-compiler") == 0 && i + 1 < argc) {
+            options.compiler = argv[++i];
+        } else if (strcmp(argv[i], "-shutdown") == 0) {
+            options.shutdown = true;
+        } else if (argv[i][0] == '-') {
+            usage();
+            return 2;
+        } else {
+            first_file = i;
+            break;
+        }
+    }
+    if (!options.socket_path || first_file >= argc || options.requests < 1 || options.concurrency < 1) {
+        usage();
+        return 2;
+    }
+
+    char *args_copy = malloc(strlen(args) + 1);
+    strcpy(args_copy, args);
+    for (char *tok = strtok(args_copy, " "); tok && options.arg_count < MAX_ARGS; tok = strtok(NULL, " ")) {
+        options.args[options.arg_count++] = tok;
+    }
+    if (options.arg_count == 0) {
+        usage();
+        return 2;
+    }
+
+    options.file_count = argc - first_file;
+    options.files = calloc(options.file_count, sizeof(char *));
+    options.sources = calloc(options.file_count, sizeof(char *));
+    options.source_lens = calloc(options.file_count, sizeof(size_t));
+    for (int i = 0; i < options.file_count; i++) {
+        options.files[i] = realpath(argv[first_file + i], NULL);
+        if (options.files[i] && options.send_source) {
+            options.sources[i] = read_file(options.files[i], &options.source_lens[i], 0);
+        }
+        if (!options.files[i] || (options.send_source && !options.sources[i])) {
+            fprintf(stderr, "loadgen: cannot read %s\n", argv[first_file + i]);
+            return 1;
+        }
+    }
+
+    int failures = run_load(&options, false);
+    if (options.compiler) failures += run_load(&options, true);
+
+    if (options.shutdown) {
+        int fd = client_connect(options.socket_path);
+        if (fd < 0 || client_shutdown(fd) != 0) fprintf(stderr, "loadgen: shutdown request failed\n");
+        if (fd >= 0) close(fd);
+    }
+
+    for (int i = 0; i < options.file_count; i++) {
+        free(options.files[i]);
+        free(options.sources[i]);
+    }
+    free(options.files);
+    free(options.sources);
+    free(options.source_lens);
+    free(args_copy);
+    return failures ? 1 : 0;
+}
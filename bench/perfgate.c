@@ -0,0 +1,363 @@
+// 性能回归检查：以 -koopa、-riscv（RV32 / RV64 / RV32C）模式编译固定语料，
+// 记录编译时间、峰值内存、指令数与代码字节数，并与基线比较
+// 用法：perfgate -compiler <编译器> -corpus <语料目录> -baseline <基线文件> [选项]
+//   -update             用本次结果覆盖基线文件
+//   -runs N             每个程序编译 N 次，时间取中位数（默认 5）
+//   -time-tol R         编译时间允许的相对增长（默认 0.5，即 50%）
+//   -time-slack-us U    编译时间允许的绝对增长，吸收计时噪声（默认 2000 微秒）
+//   -mem-tol R          峰值内存允许的相对增长（默认 0.25）
+//   -inst-tol R         指令数允许的相对增长（默认 0，任何增长都视为回归）
+//   -size-tol R         代码字节数允许的相对增长（默认 0）
+//   -timing-report-only 编译时间与峰值内存超出容差时只报告，不算作回归（二者随机器与负载波动）
+// 任一指标超出容差时以非零状态退出
+#include <dirent.h>
+#include <fcntl.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/resource.h>
+#include <sys/wait.h>
+#include <unistd.h>
+#include "bench_util.h"
+
+#define MAX_PROGRAMS 256
+#define MAX_RUNS 64
+
+typedef enum { METRIC_TIME, METRIC_MEM, METRIC_INSTS, METRIC_BYTES, METRIC_COUNT } Metric;
+
+static const char *metric_names[METRIC_COUNT] = {"time_us", "peak_kb", "insts", "bytes"};
+
+// 测量模式：名称与传给编译器的参数；native 为 true 时输出汇编，并用 -size-stats 取代码字节数
+typedef struct {
+    const char *name;
+    const char *args[4];
+    bool native;
+} Mode;
+
+static const Mode modes[] = {
+    {"koopa", {"-koopa", NULL}, false},
+    {"riscv", {"-riscv", NULL}, true},
+    {"rv64", {"-riscv", "-target", "rv64", NULL}, true},
+    {"rvc", {"-riscv", "-rvc", NULL}, true},
+};
+#define MODE_COUNT ((int)(sizeof(modes) / sizeof(modes[0])))
+
+// 一次测量（或一条基线）：程序名、模式与各项指标
+typedef struct {
+    char program[256];
+    char mode[16];
+    long values[METRIC_COUNT];
+} Record;
+
+typedef struct {
+    const char *compiler;
+    const char *corpus;
+    const char *baseline;
+    bool update;
+    int runs;
+    double tol[METRIC_COUNT];
+    long slack[METRIC_COUNT];
+    bool timing_report_only;    // 时间与内存只报告
+} Options;
+
+/**
+ * 运行一次编译器，返回墙钟时间（微秒），峰值常驻内存（KB）写入 peak_kb
+ * stats 非空时附加 -size-stats 并将标准错误写入该文件
+ * 编译失败时返回 -1
+ */
+static long run_compiler(const char *compiler, const Mode *mode, const char *input,
+                         const char *output, const char *stats, long *peak_kb) {
+    const char *argv[16];
+    int argc = 0;
+    // 编译器要求模式在前、输入输出其次，其余选项在最后
+    argv[argc++] = compiler;
+    argv[argc++] = mode->args[0];
+    argv[argc++] = input;
+    argv[argc++] = "-o";
+    argv[argc++] = output;
+    for (int i = 1; mode->args[i]; i++) argv[argc++] = mode->args[i];
+    if (stats) argv[argc++] = "-size-stats";
+    argv[argc] = NULL;
+
+    double start = now_us();
+    pid_t pid = fork();
+    if (pid < 0) {
+        perror("fork");
+        return -1;
+    }
+    if (pid == 0) {
+        int null_fd = open("/dev/null", O_WRONLY);
+        if (null_fd >= 0) {
+            dup2(null_fd, STDOUT_FILENO);
+            dup2(null_fd, STDERR_FILENO);
+        }
+        int stats_fd = stats ? open(stats, O_WRONLY | O_CREAT | O_TRUNC, 0644) : -1;
+        if (stats_fd >= 0) dup2(stats_fd, STDERR_FILENO);
+        execv(compiler, (char *const *)argv);
+        _exit(127);
+    }
+
+    int status;
+    struct rusage usage;
+    if (wait4(pid, &status, 0, &usage) < 0) {
+        perror("wait4");
+        return -1;
+    }
+    double elapsed = now_us() - start;
+    if (!WIFEXITED(status) || WEXITSTATUS(status) != 0) return -1;
+    *peak_kb = usage.ru_maxrss;
+    return (long)elapsed;
+}
+
+/**
+ * 统计输出中的指令条数
+ * Koopa IR：缩进的非空行（标签、函数头与右括号均顶格）
+ * RISC-V：缩进的非空行中除去以 . 开头的汇编指示
+ */
+static long count_insts(const char *path, bool native) {
+    FILE *f = fopen(path, "r");
+    if (!f) return -1;
+    long count = 0;
+    char line[4096];
+    while (fgets(line, sizeof(line), f)) {
+        if (line[0] != ' ' && line[0] != '\t') continue;
+        const char *p = line;
+        while (*p == ' ' || *p == '\t') p++;
+        if (*p == '\n' || *p == '\0') continue;
+        if (native && *p == '.') continue;
+        count++;
+    }
+    fclose(f);
+    return count;
+}
+
+// 累加 -size-stats 输出中每个函数的 "[size] name: N bytes"
+static long sum_code_bytes(const char *path) {
+    FILE *f = fopen(path, "r");
+    if (!f) return -1;
+    long total = 0, bytes;
+    char line[1024];
+    while (fgets(line, sizeof(line), f)) {
+        const char *colon = strrchr(line, ':');
+        if (strncmp(line, "[size] ", 7) == 0 && colon && sscanf(colon + 1, "%ld", &bytes) == 1) total += bytes;
+    }
+    fclose(f);
+    return total;
+}
+
+static int measure(const Options *opts, const char *program, const Mode *mode, Record *rec) {
+    char input[1024], output[1024], stats[1024];
+    snprintf(input, sizeof(input), "%s/%s", opts->corpus, program);
+    const char *tmpdir = getenv("TMPDIR") ? getenv("TMPDIR") : "/tmp";
+    snprintf(output, sizeof(output), "%s/perfgate_%d.out", tmpdir, (int)getpid());
+    snprintf(stats, sizeof(stats), "%s/perfgate_%d.stats", tmpdir, (int)getpid());
+
+    long times[MAX_RUNS], peaks[MAX_RUNS];
+    long peak;
+    // 预热一次，使编译器与语料进入页缓存，同时取得代码字节数
+    if (run_compiler(opts->compiler, mode, input, output, mode->native ? stats : NULL, &peak) < 0) {
+        fprintf(stderr, "perfgate: %s failed to compile in %s mode\n", program, mode->name);
+        return -1;
+    }
+    for (int i = 0; i < opts->runs; i++) {
+        times[i] = run_compiler(opts->compiler, mode, input, output, NULL, &peaks[i]);
+        if (times[i] < 0) {
+            fprintf(stderr, "perfgate: %s failed to compile in %s mode\n", program, mode->name);
+            return -1;
+        }
+    }
+    qsort(times, opts->runs, sizeof(long), compare_long);
+    qsort(peaks, opts->runs, sizeof(long), compare_long);
+
+    snprintf(rec->program, sizeof(rec->program), "%s", program);
+    snprintf(rec->mode, sizeof(rec->mode), "%s", mode->name);
+    rec->values[METRIC_TIME] = times[opts->runs / 2];
+    rec->values[METRIC_MEM] = peaks[opts->runs / 2];
+    rec->values[METRIC_INSTS] = count_insts(output, mode->native);
+    rec->values[METRIC_BYTES] = mode->native ? sum_code_bytes(stats) : 0;
+    remove(output);
+    remove(stats);
+    return 0;
+}
+
+static int is_source(const struct dirent *entry) {
+    size_t len = strlen(entry->d_name);
+    return len > 2 && strcmp(entry->d_name + len - 2, ".c") == 0;
+}
+
+// 读取基线文件，# 开头为注释；返回记录条数，文件不存在时返回 -1
+static int load_baseline(const char *path, Record *records, int max) {
+    FILE *f = fopen(path, "r");
+    if (!f) return -1;
+    int n = 0;
+    char line[1024];
+    while (n < max && fgets(line, sizeof(line), f)) {
+        if (line[0] == '#' || line[0] == '\n') continue;
+        Record *r = &records[n];
+        if (sscanf(line, "%255s %15s %ld %ld %ld %ld", r->program, r->mode, &r->values[METRIC_TIME],
+                   &r->values[METRIC_MEM], &r->values[METRIC_INSTS], &r->values[METRIC_BYTES]) == 6) {
+            n++;
+        }
+    }
+    fclose(f);
+    return n;
+}
+
+static int save_baseline(const char *path, const Record *records, int n) {
+    FILE *f = fopen(path, "w");
+    if (!f) {
+        fprintf(stderr, "perfgate: cannot write baseline %s\n", path);
+        return -1;
+    }
+    fprintf(f, "# perfgate baseline, regenerate with `make perf-baseline`\n");
+    fprintf(f, "# program mode time_us peak_kb insts bytes\n");
+    for (int i = 0; i < n; i++) {
+        fprintf(f, "%s %s %ld %ld %ld %ld\n", records[i].program, records[i].mode, records[i].values[METRIC_TIME],
+                records[i].values[METRIC_MEM], records[i].values[METRIC_INSTS], records[i].values[METRIC_BYTES]);
+    }
+    fclose(f);
+    return 0;
+}
+
+static const Record *find_record(const Record *records, int n, const char *program, const char *mode) {
+    for (int i = 0; i < n; i++) {
+        if (strcmp(records[i].program, program) == 0 && strcmp(records[i].mode, mode) == 0) return &records[i];
+    }
+    return NULL;
+}
+
+// 与基线逐项比较并打印差异，返回超出容差的指标个数
+static int compare_record(const Options *opts, const Record *cur, const Record *base) {
+    int regressions = 0;
+    printf("%s [%s]\n", cur->program, cur->mode);
+    for (int m = 0; m < METRIC_COUNT; m++) {
+        long before = base->values[m], after = cur->values[m];
+        double limit = before * (1.0 + opts->tol[m]) + opts->slack[m];
+        double change = before ? 100.0 * (after - before) / before : (after ? 100.0 : 0.0);
+        const char *verdict = "ok";
+        bool timing = m == METRIC_TIME || m == METRIC_MEM;
+        if (after > limit && timing && opts->timing_report_only) {
+            verdict = "over limit (report only)";
+        } else if (after > limit) {
+            verdict = "REGRESSION";
+            regressions++;
+        } else if ((m == METRIC_INSTS || m == METRIC_BYTES) && after < before) {
+            verdict = "improved (update the baseline)";
+        }
+        printf("  %-8s %10ld -> %-10ld (%+6.1f%%, limit %.0f)  %s\n",
+               metric_names[m], before, after, change, limit, verdict);
+    }
+    return regressions;
+}
+
+// 汇总 C 扩展压缩带来的代码体积变化（rvc 相对 riscv）
+static void report_compression(const Record *records, int n) {
+    long plain = 0, compressed = 0;
+    for (int i = 0; i < n; i++) {
+        const Record *r = &records[i];
+        if (strcmp(r->mode, "riscv") == 0) plain += r->values[METRIC_BYTES];
+        else if (strcmp(r->mode, "rvc") == 0) compressed += r->values[METRIC_BYTES];
+    }
+    if (plain > 0) {
+        printf("perfgate: code size %ld -> %ld bytes with -rvc (%.1f%% smaller)\n", plain, compressed,
+               100.0 * (plain - compressed) / plain);
+    }
+}
+
+static void usage(void) {
+    fprintf(stderr, "usage: perfgate -compiler <compiler> -corpus <dir> -baseline <file> [-update] [-runs N]\n"
+                    "                [-time-tol R] [-time-slack-us U] [-mem-tol R] [-inst-tol R] [-size-tol R]\n"
+                    "                [-timing-report-only]\n");
+}
+
+int main(int argc, char *argv[]) {
+    Options opts = {NULL, NULL, NULL, false, 5, {0.5, 0.25, 0.0, 0.0}, {2000, 0, 0, 0}, false};
+    for (int i = 1; i < argc; i++) {
+        const char *arg = argv[i];
+        const char *next = i + 1 < argc ? argv[i + 1] : NULL;
+        if (strcmp(arg, "-update") == 0) {
+            opts.update = true;
+            continue;
+        }
+        if (strcmp(arg, "-timing-report-only") == 0) {
+            opts.timing_report_only = true;
+            continue;
+        }
+        if (!next) {
+            usage();
+            return 2;
+        }
+        if (strcmp(arg, "-compiler") == 0) opts.compiler = next;
+        else if (strcmp(arg, "-corpus") == 0) opts.corpus = next;
+        else if (strcmp(arg, "-baseline") == 0) opts.baseline = next;
+        else if (strcmp(arg, "-runs") == 0) opts.runs = atoi(next);
+        else if (strcmp(arg, "-time-tol") == 0) opts.tol[METRIC_TIME] = atof(next);
+        else if (strcmp(arg, "-time-slack-us") == 0) opts.slack[METRIC_TIME] = atol(next);
+        else if (strcmp(arg, "-mem-tol") == 0) opts.tol[METRIC_MEM] = atof(next);
+        else if (strcmp(arg, "-inst-tol") == 0) opts.tol[METRIC_INSTS] = atof(next);
+        else if (strcmp(arg, "-size-tol") == 0) opts.tol[METRIC_BYTES] = atof(next);
+        else {
+            usage();
+            return 2;
+        }
+        i++;
+    }
+    if (!opts.compiler || !opts.corpus || !opts.baseline || opts.runs < 1 || opts.runs > MAX_RUNS) {
+        usage();
+        return 2;
+    }
+
+    struct dirent **entries;
+    int nentries = scandir(opts.corpus, &entries, is_source, alphasort);
+    if (nentries <= 0) {
+        fprintf(stderr, "perfgate: no programs found in %s\n", opts.corpus);
+        return 2;
+    }
+
+    static Record current[MAX_PROGRAMS * MODE_COUNT];
+    int ncurrent = 0;
+    int status = 0;
+    for (int i = 0; i < nentries && ncurrent < MAX_PROGRAMS * MODE_COUNT; i++) {
+        for (int m = 0; m < MODE_COUNT; m++) {
+            if (measure(&opts, entries[i]->d_name, &modes[m], &current[ncurrent]) != 0) status = 1;
+            else ncurrent++;
+        }
+        free(entries[i]);
+    }
+    free(entries);
+    if (status != 0) return status;
+    report_compression(current, ncurrent);
+
+    if (opts.update) {
+        if (save_baseline(opts.baseline, current, ncurrent) != 0) return 2;
+        printf("perfgate: wrote %d records to %s\n", ncurrent, opts.baseline);
+        return 0;
+    }
+
+    static Record baseline[MAX_PROGRAMS * MODE_COUNT];
+    int nbaseline = load_baseline(opts.baseline, baseline, MAX_PROGRAMS * MODE_COUNT);
+    if (nbaseline < 0) {
+        fprintf(stderr, "perfgate: cannot read baseline %s (run with -update to create it)\n", opts.baseline);
+        return 2;
+    }
+
+    int regressions = 0, missing = 0;
+    for (int i = 0; i < ncurrent; i++) {
+        const Record *base = find_record(baseline, nbaseline, current[i].program, current[i].mode);
+        if (!base) {
+            printf("%s [%s]\n  no baseline entry\n", current[i].program, current[i].mode);
+            missing++;
+            continue;
+        }
+        regressions += compare_record(&opts, &current[i], base);
+    }
+    for (int i = 0; i < nbaseline; i++) {
+        if (!find_record(current, ncurrent, baseline[i].program, baseline[i].mode)) {
+            printf("%s [%s]\n  in baseline but not in corpus\n", baseline[i].program, baseline[i].mode);
+        }
+    }
+
+    printf("perfgate: %d records, %d regressions, %d without baseline\n", ncurrent, regressions, missing);
+    return regressions || missing ? 1 : 0;
+}
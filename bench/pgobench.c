@@ -0,0 +1,186 @@
+// 剖析引导优化的收益：对语料中的每个程序，在用户态模拟器（rvemu）中比较以下三种编译结果的动态指令数
+//   base          不带剖析数据编译
+//   instrumented  以 -profile-gen 插桩编译，运行一次得到剖析数据
+//   pgo           以 -profile-use 使用该剖析数据编译
+// 三者的 main 返回值须一致
+// 用法：pgobench -compiler <编译器> -emulator <rvemu> -corpus <语料目录> [-target rv32|rv64] [-out DIR]
+// 有编译或运行失败、返回值不一致时以非零状态退出
+#include <dirent.h>
+#include <fcntl.h>
+#include <inttypes.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+typedef struct {
+    const char *compiler;
+    const char *emulator;
+    const char *corpus;
+    const char *target;
+    const char *out_dir;
+} Options;
+
+// 一次运行的结果：main 的返回值与动态指令数
+typedef struct {
+    long result;
+    uint64_t insts;
+} RunResult;
+
+/**
+ * 运行 argv 描述的进程并等待其结束，标准输出丢弃，stderr 不为 NULL 时标准错误写入该文件
+ * @return 进程的退出状态，无法运行或异常结束时返回 -1
+ */
+static int run_process(const char *const *argv, const char *stderr_path) {
+    pid_t pid = fork();
+    if (pid < 0) {
+        perror("fork");
+        return -1;
+    }
+    if (pid == 0) {
+        int null_fd = open("/dev/null", O_WRONLY);
+        if (null_fd >= 0) dup2(null_fd, STDOUT_FILENO);
+        int err_fd = stderr_path ? open(stderr_path, O_WRONLY | O_CREAT | O_TRUNC, 0644) : -1;
+        if (err_fd >= 0) dup2(err_fd, STDERR_FILENO);
+        execv(argv[0], (char *const *)argv);
+        _exit(127);
+    }
+    int status;
+    if (waitpid(pid, &status, 0) < 0) {
+        perror("waitpid");
+        return -1;
+    }
+    return WIFEXITED(status) ? WEXITSTATUS(status) : -1;
+}
+
+// 编译 input 为汇编 output，extra 为附加的一对选项（可为 NULL）
+static int compile(const Options *opts, const char *input, const char *output, const char *extra, const char *value) {
+    const char *argv[12];
+    int argc = 0;
+    argv[argc++] = opts->compiler;
+    argv[argc++] = "-riscv";
+    argv[argc++] = input;
+    argv[argc++] = "-o";
+    argv[argc++] = output;
+    argv[argc++] = "-target";
+    argv[argc++] = opts->target;
+    if (extra) {
+        argv[argc++] = extra;
+        argv[argc++] = value;
+    }
+    argv[argc] = NULL;
+    return run_process(argv, NULL) == 0 ? 0 : -1;
+}
+
+// 在模拟器中运行汇编，读取 -count 输出的返回值与动态指令数
+static int emulate(const Options *opts, const char *assembly, const char *log, RunResult *result) {
+    const char *argv[] = {opts->emulator, "-target", opts->target, "-count", assembly, NULL};
+    if (run_process(argv, log) < 0) return -1;
+    FILE *f = fopen(log, "r");
+    if (!f) return -1;
+    char line[4096];
+    int found = 0;
+    while (!found && fgets(line, sizeof(line), f)) {
+        const char *p = strstr(line, ": returned ");
+        found = p && sscanf(p, ": returned %ld, %" SCNu64 " instructions", &result->result, &result->insts) == 2;
+    }
+    fclose(f);
+    return found ? 0 : -1;
+}
+
+static int measure(const Options *opts, const char *program, RunResult results[3]) {
+    char input[1024], assembly[1024], profile[1024], log[1024];
+    snprintf(input, sizeof(input), "%s/%s", opts->corpus, program);
+    snprintf(assembly, sizeof(assembly), "%s/pgobench_%d.s", opts->out_dir, (int)getpid());
+    snprintf(profile, sizeof(profile), "%s/pgobench_%d.profraw", opts->out_dir, (int)getpid());
+    snprintf(log, sizeof(log), "%s/pgobench_%d.log", opts->out_dir, (int)getpid());
+    remove(profile);
+
+    static const char *const stages[] = {"base", "instrumented", "pgo"};
+    const char *extras[][2] = {{NULL, NULL}, {"-profile-gen", profile}, {"-profile-use", profile}};
+    int ret = 0;
+    for (int s = 0; s < 3 && ret == 0; s++) {
+        if (compile(opts, input, assembly, extras[s][0], extras[s][1]) != 0) {
+            fprintf(stderr, "pgobench: %s failed to compile (%s)\n", program, stages[s]);
+            ret = -1;
+        } else if (emulate(opts, assembly, log, &results[s]) != 0) {
+            fprintf(stderr, "pgobench: %s failed to run (%s)\n", program, stages[s]);
+            ret = -1;
+        }
+    }
+    remove(assembly);
+    remove(profile);
+    remove(log);
+    return ret;
+}
+
+static int is_source(const struct dirent *entry) {
+    size_t len = strlen(entry->d_name);
+    return len > 2 && strcmp(entry->d_name + len - 2, ".c") == 0;
+}
+
+static void usage(void) {
+    fprintf(stderr, "usage: pgobench -compiler <compiler> -emulator <rvemu> -corpus <dir> [-target rv32|rv64] [-out DIR]\n");
+}
+
+int main(int argc, char *argv[]) {
+    Options opts = {NULL, NULL, NULL, "rv32", "/tmp"};
+    for (int i = 1; i < argc; i++) {
+        const char *arg = argv[i];
+        const char *next = i + 1 < argc ? argv[i + 1] : NULL;
+        if (!next) {
+            usage();
+            return 2;
+        }
+        if (strcmp(arg, "-compiler") == 0) opts.compiler = next;
+        else if (strcmp(arg, "-emulator") == 0) opts.emulator = next;
+        else if (strcmp(arg, "-corpus") == 0) opts.corpus = next;
+        else if (strcmp(arg, "-target") == 0) opts.target = next;
+        else if (strcmp(arg, "-out") == 0) opts.out_dir = next;
+        else {
+            usage();
+            return 2;
+        }
+        i++;
+    }
+    if (!opts.compiler || !opts.emulator || !opts.corpus) {
+        usage();
+        return 2;
+    }
+
+    struct dirent **entries;
+    int nentries = scandir(opts.corpus, &entries, is_source, alphasort);
+    if (nentries <= 0) {
+        fprintf(stderr, "pgobench: no programs found in %s\n", opts.corpus);
+        return 2;
+    }
+
+    printf("%-16s %12s %10s %13s %10s %8s\n", "program", "result", "base", "instrumented", "pgo", "change");
+    uint64_t total_base = 0, total_pgo = 0;
+    int failures = 0;
+    for (int i = 0; i < nentries; i++) {
+        const char *program = entries[i]->d_name;
+        RunResult r[3];
+        if (measure(&opts, program, r) != 0) {
+            failures++;
+        } else if (r[1].result != r[0].result || r[2].result != r[0].result) {
+            fprintf(stderr, "pgobench: %s returned %ld / %ld / %ld (base / instrumented / pgo)\n", program,
+                    r[0].result, r[1].result, r[2].result);
+            failures++;
+        } else {
+            total_base += r[0].insts;
+            total_pgo += r[2].insts;
+            printf("%-16s %12ld %10" PRIu64 " %13" PRIu64 " %10" PRIu64 " %7.1f%%\n", program, r[0].result,
+                   r[0].insts, r[1].insts, r[2].insts, 100.0 * ((double)r[2].insts - r[0].insts) / r[0].insts);
+        }
+        free(entries[i]);
+    }
+    free(entries);
+    if (total_base > 0) {
+        printf("%-16s %12s %10" PRIu64 " %13s %10" PRIu64 " %7.1f%%\n", "total", "", total_base, "", total_pgo,
+               100.0 * ((double)total_pgo - total_base) / total_base);
+    }
+    return failures ? 1 : 0;
+}
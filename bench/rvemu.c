@@ -0,0 +1,688 @@
+// RISC-V 用户态模拟器：直接执行本编译器输出的汇编文本，用于检查生成代码的结果并统计动态指令数
+// 用法：rvemu [选项] <汇编文件>
+//   -target rv32|rv64  目标（默认 rv32）
+//   -count             结束后向 stderr 输出 main 的返回值与动态指令数
+//   -max-steps N       最多执行的指令条数（默认 10^9），超出视为失败
+// 支持编译器输出的 RV32IM / RV64IM 指令与伪指令、C 扩展压缩指令，以及 .text、.data、.word、.zero、.asciz 等指示；
+// 从 main 开始执行，main 返回时以其返回值的低 8 位为退出状态
+// 系统调用：openat、close、read、write、exit，按 Linux 的约定（a7 为调用号）转给宿主
+// 动态指令数按汇编器展开后的机器指令计：call、la 计 2 条，li 按 lui / addi 展开计 1 ~ 2 条
+#include <errno.h>
+#include <fcntl.h>
+#include <inttypes.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#define TEXT_BASE 0x1000u                   // 第 i 条指令的地址为 TEXT_BASE + 4i
+#define DATA_BASE 0x10000000u
+#define STACK_TOP 0x7ff00000u
+#define STACK_SIZE (8u << 20)
+#define EXIT_ADDR 0u                        // main 的返回地址，跳到此处即结束
+
+typedef enum {
+    OP_LI, OP_LUI, OP_MV, OP_LA,
+    OP_ADDI, OP_SLTI, OP_XORI, OP_ANDI, OP_ORI, OP_SLLI, OP_SRLI, OP_SRAI,
+    OP_ADD, OP_SUB, OP_MUL, OP_DIV, OP_REM, OP_SLT, OP_SGT, OP_XOR, OP_AND, OP_OR,
+    OP_SLL, OP_SRL, OP_SRA, OP_SEQZ, OP_SNEZ,
+    OP_ADDW, OP_SUBW, OP_MULW, OP_DIVW, OP_REMW, OP_ADDIW,
+    OP_SLLW, OP_SRLW, OP_SRAW, OP_SLLIW, OP_SRLIW, OP_SRAIW,
+    OP_LW, OP_SW, OP_LD, OP_SD,
+    OP_CALL, OP_JR, OP_J, OP_ECALL,
+} Op;
+
+// 操作数格式；C_ 开头的为压缩指令的两操作数形式，rd 同时是第一个源操作数
+typedef enum {
+    F_RRR,      // rd, rs1, rs2
+    F_RR,       // rd, rs1
+    F_RI,       // rd, imm
+    F_RRI,      // rd, rs1, imm
+    F_MEM,      // reg, imm(rs1)
+    F_NONE,     //
+    F_SYM,      // symbol
+    F_RSYM,     // rd, symbol[+off]
+    F_R,        // rs1
+    F_C_RR,     // rd, rs2
+    F_C_RI,     // rd, imm
+} Format;
+
+typedef struct {
+    const char *name;
+    Op op;
+    Format format;
+    bool rv64;  // 只在 RV64 上可用
+} Mnemonic;
+
+static const Mnemonic mnemonics[] = {
+    {"li", OP_LI, F_RI, false},         {"lui", OP_LUI, F_RI, false},       {"mv", OP_MV, F_RR, false},
+    {"la", OP_LA, F_RSYM, false},       {"addi", OP_ADDI, F_RRI, false},    {"slti", OP_SLTI, F_RRI, false},
+    {"xori", OP_XORI, F_RRI, false},    {"andi", OP_ANDI, F_RRI, false},    {"ori", OP_ORI, F_RRI, false},
+    {"slli", OP_SLLI, F_RRI, false},    {"srli", OP_SRLI, F_RRI, false},    {"srai", OP_SRAI, F_RRI, false},
+    {"add", OP_ADD, F_RRR, false},      {"sub", OP_SUB, F_RRR, false},      {"mul", OP_MUL, F_RRR, false},
+    {"div", OP_DIV, F_RRR, false},      {"rem", OP_REM, F_RRR, false},      {"slt", OP_SLT, F_RRR, false},
+    {"sgt", OP_SGT, F_RRR, false},      {"xor", OP_XOR, F_RRR, false},      {"and", OP_AND, F_RRR, false},
+    {"or", OP_OR, F_RRR, false},        {"sll", OP_SLL, F_RRR, false},      {"srl", OP_SRL, F_RRR, false},
+    {"sra", OP_SRA, F_RRR, false},      {"seqz", OP_SEQZ, F_RR, false},     {"snez", OP_SNEZ, F_RR, false},
+    {"addw", OP_ADDW, F_RRR, true},     {"subw", OP_SUBW, F_RRR, true},     {"mulw", OP_MULW, F_RRR, true},
+    {"divw", OP_DIVW, F_RRR, true},     {"remw", OP_REMW, F_RRR, true},     {"addiw", OP_ADDIW, F_RRI, true},
+    {"sllw", OP_SLLW, F_RRR, true},     {"srlw", OP_SRLW, F_RRR, true},     {"sraw", OP_SRAW, F_RRR, true},
+    {"slliw", OP_SLLIW, F_RRI, true},   {"srliw", OP_SRLIW, F_RRI, true},   {"sraiw", OP_SRAIW, F_RRI, true},
+    {"lw", OP_LW, F_MEM, false},        {"sw", OP_SW, F_MEM, false},        {"ld", OP_LD, F_MEM, true},
+    {"sd", OP_SD, F_MEM, true},         {"call", OP_CALL, F_SYM, false},    {"j", OP_J, F_SYM, false},
+    {"ret", OP_JR, F_NONE, false},      {"jr", OP_JR, F_R, false},          {"ecall", OP_ECALL, F_NONE, false},
+    // C 扩展
+    {"c.li", OP_LI, F_RI, false},       {"c.lui", OP_LUI, F_RI, false},     {"c.mv", OP_MV, F_RR, false},
+    {"c.add", OP_ADD, F_C_RR, false},   {"c.sub", OP_SUB, F_C_RR, false},   {"c.xor", OP_XOR, F_C_RR, false},
+    {"c.or", OP_OR, F_C_RR, false},     {"c.and", OP_AND, F_C_RR, false},   {"c.addw", OP_ADDW, F_C_RR, true},
+    {"c.subw", OP_SUBW, F_C_RR, true},  {"c.addi", OP_ADDI, F_C_RI, false}, {"c.addiw", OP_ADDIW, F_C_RI, true},
+    {"c.addi16sp", OP_ADDI, F_C_RI, false}, {"c.addi4spn", OP_ADDI, F_RRI, false},
+    {"c.slli", OP_SLLI, F_C_RI, false}, {"c.srli", OP_SRLI, F_C_RI, false}, {"c.srai", OP_SRAI, F_C_RI, false},
+    {"c.andi", OP_ANDI, F_C_RI, false}, {"c.lw", OP_LW, F_MEM, false},      {"c.lwsp", OP_LW, F_MEM, false},
+    {"c.sw", OP_SW, F_MEM, false},      {"c.swsp", OP_SW, F_MEM, false},    {"c.ld", OP_LD, F_MEM, true},
+    {"c.ldsp", OP_LD, F_MEM, true},     {"c.sd", OP_SD, F_MEM, true},       {"c.sdsp", OP_SD, F_MEM, true},
+    {"c.jr", OP_JR, F_R, false},
+};
+#define MNEMONIC_COUNT ((int)(sizeof(mnemonics) / sizeof(mnemonics[0])))
+
+static const char *reg_names[32] = {
+    "zero", "ra", "sp", "gp", "tp", "t0", "t1", "t2", "s0", "s1", "a0", "a1", "a2", "a3", "a4", "a5",
+    "a6", "a7", "s2", "s3", "s4", "s5", "s6", "s7", "s8", "s9", "s10", "s11", "t3", "t4", "t5", "t6",
+};
+
+enum { REG_RA = 1, REG_SP = 2, REG_A0 = 10, REG_A1, REG_A2, REG_A3, REG_A7 = 17 };
+
+typedef struct {
+    Op op;
+    int rd, rs1, rs2;
+    int64_t imm;
+    char *symbol;       // call、j、la 的目标，装载后解析为 target
+    uint64_t target;
+    int cost;           // 展开后的机器指令条数
+    int line;
+} Inst;
+
+typedef struct {
+    char *name;
+    bool text;
+    uint64_t addr;
+} Symbol;
+
+typedef struct {
+    int xlen;
+    Inst *insts;
+    int inst_count, inst_cap;
+    unsigned char *data;
+    size_t data_size, data_cap;
+    unsigned char *stack;
+    Symbol *symbols;
+    int symbol_count, symbol_cap;
+    uint64_t regs[32];
+    uint64_t steps;
+} Machine;
+
+static void *grow(void *p, int *cap, int count, size_t elem) {
+    if (count < *cap) return p;
+    *cap = *cap ? *cap * 2 : 256;
+    p = realloc(p, *cap * elem);
+    if (!p) {
+        fprintf(stderr, "rvemu: out of memory\n");
+        exit(2);
+    }
+    return p;
+}
+
+static char *copy_range(const char *s, size_t len) {
+    char *copy = malloc(len + 1);
+    memcpy(copy, s, len);
+    copy[len] = '\0';
+    return copy;
+}
+
+static void data_append(Machine *m, const void *bytes, size_t len) {
+    if (m->data_size + len > m->data_cap) {
+        while (m->data_size + len > m->data_cap) m->data_cap = m->data_cap ? m->data_cap * 2 : 4096;
+        m->data = realloc(m->data, m->data_cap);
+    }
+    if (bytes) memcpy(m->data + m->data_size, bytes, len);
+    else memset(m->data + m->data_size, 0, len);
+    m->data_size += len;
+}
+
+static const char *skip_space(const char *p) {
+    while (*p == ' ' || *p == '\t') p++;
+    return p;
+}
+
+// 解析汇编时出错：报告行号后退出
+static void syntax_error(int line, const char *message, const char *text) {
+    fprintf(stderr, "rvemu: line %d: %s: %s\n", line, message, text);
+    exit(2);
+}
+
+static int parse_reg(const char *s, size_t len, int line) {
+    for (int i = 0; i < 32; i++) {
+        if (strlen(reg_names[i]) == len && strncmp(reg_names[i], s, len) == 0) return i;
+    }
+    if (len == 2 && strncmp(s, "fp", 2) == 0) return 8;
+    if (len >= 2 && s[0] == 'x') {
+        char *end;
+        long n = strtol(s + 1, &end, 10);
+        if (end == s + len && n >= 0 && n < 32) return (int)n;
+    }
+    syntax_error(line, "unknown register", copy_range(s, len));
+    return 0;
+}
+
+static int64_t parse_imm(const char *s, size_t len, int line) {
+    char buf[64];
+    if (len == 0 || len >= sizeof(buf)) syntax_error(line, "bad immediate", copy_range(s, len));
+    memcpy(buf, s, len);
+    buf[len] = '\0';
+    char *end;
+    int64_t v = strtoll(buf, &end, 0);
+    if (*end) syntax_error(line, "bad immediate", buf);
+    return v;
+}
+
+// 按逗号拆分操作数，去掉两端空白
+static int split_operands(const char *p, const char *ops[4], size_t lens[4]) {
+    int n = 0;
+    p = skip_space(p);
+    while (*p && n < 4) {
+        const char *end = strchr(p, ',');
+        if (!end) end = p + strlen(p);
+        const char *e = end;
+        while (e > p && (e[-1] == ' ' || e[-1] == '\t')) e--;
+        ops[n] = p;
+        lens[n] = e - p;
+        n++;
+        p = *end ? skip_space(end + 1) : end;
+    }
+    return n;
+}
+
+// 展开后的机器指令条数：li 超出 12 位时为 lui + addi（低 12 位为 0 时只有 lui），call、la 为 auipc + jalr / addi
+static int inst_cost(const Inst *inst) {
+    if (inst->op == OP_CALL || inst->op == OP_LA) return 2;
+    if (inst->op == OP_LI && (inst->imm < -2048 || inst->imm > 2047)) {
+        int32_t low = (int32_t)((uint32_t)inst->imm << 20) >> 20;
+        return low != 0 ? 2 : 1;
+    }
+    return 1;
+}
+
+static void parse_inst(Machine *m, const char *text, int line) {
+    const char *p = text;
+    while (*p && *p != ' ' && *p != '\t') p++;
+    size_t name_len = p - text;
+    const Mnemonic *mn = NULL;
+    for (int i = 0; i < MNEMONIC_COUNT && !mn; i++) {
+        if (strlen(mnemonics[i].name) == name_len && strncmp(mnemonics[i].name, text, name_len) == 0) mn = &mnemonics[i];
+    }
+    if (!mn) syntax_error(line, "unknown instruction", text);
+    if (mn->rv64 && m->xlen != 64) syntax_error(line, "instruction requires rv64", text);
+
+    const char *ops[4];
+    size_t lens[4];
+    int n = split_operands(p, ops, lens);
+    static const int expected[] = {
+        [F_RRR] = 3, [F_RR] = 2, [F_RI] = 2, [F_RRI] = 3, [F_MEM] = 2, [F_NONE] = 0,
+        [F_SYM] = 1, [F_RSYM] = 2, [F_R] = 1, [F_C_RR] = 2, [F_C_RI] = 2,
+    };
+    if (n != expected[mn->format]) syntax_error(line, "wrong number of operands", text);
+
+    Inst inst = {mn->op, 0, 0, 0, 0, NULL, 0, 1, line};
+    switch (mn->format) {
+        case F_RRR:
+            inst.rd = parse_reg(ops[0], lens[0], line);
+            inst.rs1 = parse_reg(ops[1], lens[1], line);
+            inst.rs2 = parse_reg(ops[2], lens[2], line);
+            break;
+        case F_RR:
+            inst.rd = parse_reg(ops[0], lens[0], line);
+            inst.rs1 = parse_reg(ops[1], lens[1], line);
+            break;
+        case F_RI:
+            inst.rd = parse_reg(ops[0], lens[0], line);
+            inst.imm = parse_imm(ops[1], lens[1], line);
+            break;
+        case F_RRI:
+            inst.rd = parse_reg(ops[0], lens[0], line);
+            inst.rs1 = parse_reg(ops[1], lens[1], line);
+            inst.imm = parse_imm(ops[2], lens[2], line);
+            break;
+        case F_MEM: {
+            // 访存指令的 rd 字段对 store 为被写入内存的 rs2
+            int reg = parse_reg(ops[0], lens[0], line);
+            const char *open = memchr(ops[1], '(', lens[1]);
+            if (!open || ops[1][lens[1] - 1] != ')') syntax_error(line, "bad memory operand", text);
+            inst.imm = open > ops[1] ? parse_imm(ops[1], open - ops[1], line) : 0;
+            inst.rs1 = parse_reg(open + 1, ops[1] + lens[1] - 1 - (open + 1), line);
+            if (inst.op == OP_SW || inst.op == OP_SD) inst.rs2 = reg;
+            else inst.rd = reg;
+            break;
+        }
+        case F_NONE:
+            // ret 即 jr ra
+            if (inst.op == OP_JR) inst.rs1 = REG_RA;
+            break;
+        case F_SYM:
+            inst.symbol = copy_range(ops[0], lens[0]);
+            break;
+        case F_RSYM: {
+            inst.rd = parse_reg(ops[0], lens[0], line);
+            size_t len = lens[1];
+            const char *sign = NULL;
+            for (size_t i = 1; i < len && !sign; i++) {
+                if (ops[1][i] == '+' || ops[1][i] == '-') sign = ops[1] + i;
+            }
+            if (sign) {
+                inst.imm = parse_imm(sign, ops[1] + len - sign, line);
+                len = sign - ops[1];
+            }
+            inst.symbol = copy_range(ops[1], len);
+            break;
+        }
+        case F_R:
+            inst.rs1 = parse_reg(ops[0], lens[0], line);
+            break;
+        case F_C_RR:
+            inst.rd = inst.rs1 = parse_reg(ops[0], lens[0], line);
+            inst.rs2 = parse_reg(ops[1], lens[1], line);
+            break;
+        case F_C_RI:
+            inst.rd = inst.rs1 = parse_reg(ops[0], lens[0], line);
+            inst.imm = parse_imm(ops[1], lens[1], line);
+            break;
+    }
+    inst.cost = inst_cost(&inst);
+    m->insts = grow(m->insts, &m->inst_cap, m->inst_count, sizeof(Inst));
+    m->insts[m->inst_count++] = inst;
+}
+
+static void define_symbol(Machine *m, const char *name, size_t len, bool text, int line) {
+    for (int i = 0; i < m->symbol_count; i++) {
+        if (strlen(m->symbols[i].name) == len && strncmp(m->symbols[i].name, name, len) == 0) {
+            syntax_error(line, "duplicate symbol", m->symbols[i].name);
+        }
+    }
+    m->symbols = grow(m->symbols, &m->symbol_cap, m->symbol_count, sizeof(Symbol));
+    Symbol *sym = &m->symbols[m->symbol_count++];
+    sym->name = copy_range(name, len);
+    sym->text = text;
+    sym->addr = text ? TEXT_BASE + 4u * (uint64_t)m->inst_count : DATA_BASE + m->data_size;
+}
+
+static const Symbol *find_symbol(const Machine *m, const char *name) {
+    for (int i = 0; i < m->symbol_count; i++) {
+        if (strcmp(m->symbols[i].name, name) == 0) return &m->symbols[i];
+    }
+    return NULL;
+}
+
+// .asciz 的字符串字面量，支持 \\、\"、\n、\t 与 \0
+static void parse_string(Machine *m, const char *p, int line) {
+    p = skip_space(p);
+    if (*p != '"') syntax_error(line, "expected string", p);
+    for (p++; *p && *p != '"'; p++) {
+        char c = *p;
+        if (c == '\\') {
+            c = *++p;
+            if (c == 'n') c = '\n';
+            else if (c == 't') c = '\t';
+            else if (c == '0') c = '\0';
+            else if (!c) break;
+        }
+        data_append(m, &c, 1);
+    }
+    if (*p != '"') syntax_error(line, "unterminated string", p);
+    data_append(m, "", 1);
+}
+
+static void parse_directive(Machine *m, const char *p, bool *in_text, int line) {
+    const char *end = p;
+    while (*end && *end != ' ' && *end != '\t') end++;
+    size_t len = end - p;
+    const char *args = skip_space(end);
+#define IS(name) (len == strlen(name) && strncmp(p, name, len) == 0)
+    if (IS(".text")) {
+        *in_text = true;
+    } else if (IS(".data") || IS(".bss") || IS(".rodata")) {
+        *in_text = false;
+    } else if (IS(".section")) {
+        *in_text = strncmp(args, ".text", 5) == 0;
+    } else if (IS(".globl") || IS(".global") || IS(".type") || IS(".size") || IS(".file")) {
+        // 只有一个翻译单元，符号的可见性无关紧要
+    } else if (in_text && *in_text) {
+        if (!IS(".align") && !IS(".p2align")) syntax_error(line, "unsupported directive in .text", p);
+    } else if (IS(".align") || IS(".p2align")) {
+        uint64_t align = 1ull << parse_imm(args, strlen(args), line);
+        while ((DATA_BASE + m->data_size) % align) data_append(m, NULL, 1);
+    } else if (IS(".word")) {
+        for (const char *q = args; *q;) {
+            const char *comma = strchr(q, ',');
+            const char *e = comma ? comma : q + strlen(q);
+            while (e > q && (e[-1] == ' ' || e[-1] == '\t')) e--;
+            uint32_t v = (uint32_t)parse_imm(q, e - q, line);
+            unsigned char bytes[4] = {v & 0xff, (v >> 8) & 0xff, (v >> 16) & 0xff, v >> 24};
+            data_append(m, bytes, 4);
+            q = comma ? skip_space(comma + 1) : q + strlen(q);
+        }
+    } else if (IS(".zero") || IS(".space")) {
+        data_append(m, NULL, (size_t)parse_imm(args, strlen(args), line));
+    } else if (IS(".asciz") || IS(".string")) {
+        parse_string(m, args, line);
+    } else {
+        syntax_error(line, "unsupported directive", p);
+    }
+#undef IS
+}
+
+static void load_program(Machine *m, FILE *f) {
+    char buf[4096];
+    bool in_text = true;
+    int line = 0;
+    while (fgets(buf, sizeof(buf), f)) {
+        line++;
+        // 去掉注释（字符串之外的 #）与行尾空白
+        bool quoted = false;
+        for (char *c = buf; *c; c++) {
+            if (*c == '"' && (c == buf || c[-1] != '\\')) quoted = !quoted;
+            if (*c == '#' && !quoted) {
+                *c = '\0';
+                break;
+            }
+        }
+        size_t len = strlen(buf);
+        while (len > 0 && (buf[len - 1] == '\n' || buf[len - 1] == '\r' || buf[len - 1] == ' ' || buf[len - 1] == '\t')) {
+            buf[--len] = '\0';
+        }
+        const char *p = skip_space(buf);
+        // 标号
+        const char *colon = strchr(p, ':');
+        if (colon && *p != '.' && !memchr(p, ' ', colon - p) && !memchr(p, '"', colon - p)) {
+            define_symbol(m, p, colon - p, in_text, line);
+            p = skip_space(colon + 1);
+        } else if (colon && *p == '.' && colon[1] == '\0') {
+            define_symbol(m, p, colon - p, in_text, line);
+            p = skip_space(colon + 1);
+        }
+        if (!*p) continue;
+        if (*p == '.') parse_directive(m, p, &in_text, line);
+        else if (in_text) parse_inst(m, p, line);
+        else syntax_error(line, "instruction outside .text", p);
+    }
+
+    for (int i = 0; i < m->inst_count; i++) {
+        Inst *inst = &m->insts[i];
+        if (!inst->symbol) continue;
+        const Symbol *sym = find_symbol(m, inst->symbol);
+        if (!sym) syntax_error(inst->line, "undefined symbol", inst->symbol);
+        if ((inst->op == OP_CALL || inst->op == OP_J) && !sym->text) syntax_error(inst->line, "not a code label", inst->symbol);
+        inst->target = sym->addr + (uint64_t)inst->imm;
+    }
+}
+
+// 按 xlen 规范化寄存器值：RV32 上保存为 32 位值的符号扩展
+static uint64_t canon(const Machine *m, uint64_t v) {
+    return m->xlen == 32 ? (uint64_t)(int64_t)(int32_t)v : v;
+}
+
+static uint64_t sext32(uint64_t v) {
+    return (uint64_t)(int64_t)(int32_t)v;
+}
+
+// 按 RISC-V 的约定处理除零与溢出：除数为 0 时商为 -1、余数为被除数；最小值除以 -1 时商为被除数、余数为 0
+static int64_t do_div(int64_t a, int64_t b, int64_t min) {
+    if (b == 0) return -1;
+    if (a == min && b == -1) return a;
+    return a / b;
+}
+
+static int64_t do_rem(int64_t a, int64_t b, int64_t min) {
+    if (b == 0) return a;
+    if (a == min && b == -1) return 0;
+    return a % b;
+}
+
+static void fault(const Machine *m, const Inst *inst, const char *message, uint64_t addr) {
+    fprintf(stderr, "rvemu: line %d: %s at 0x%" PRIx64 "\n", inst->line, message, addr);
+    free(m->stack);
+    exit(2);
+}
+
+// 取得地址 addr 起 size 字节对应的宿主内存，越界时报错退出
+static unsigned char *memory(const Machine *m, const Inst *inst, uint64_t addr, size_t size) {
+    if (m->xlen == 32) addr &= 0xffffffffu;
+    if (addr >= DATA_BASE && addr + size <= DATA_BASE + m->data_size) return m->data + (addr - DATA_BASE);
+    if (addr >= STACK_TOP - STACK_SIZE && addr + size <= STACK_TOP) return m->stack + (addr - (STACK_TOP - STACK_SIZE));
+    fault(m, inst, "memory access out of bounds", addr);
+    return NULL;
+}
+
+static uint64_t load(const Machine *m, const Inst *inst, uint64_t addr, int size) {
+    const unsigned char *p = memory(m, inst, addr, size);
+    uint64_t v = 0;
+    for (int i = size - 1; i >= 0; i--) v = v << 8 | p[i];
+    return size == 4 ? sext32(v) : v;
+}
+
+static void store(const Machine *m, const Inst *inst, uint64_t addr, int size, uint64_t v) {
+    unsigned char *p = memory(m, inst, addr, size);
+    for (int i = 0; i < size; i++) p[i] = (v >> (8 * i)) & 0xff;
+}
+
+// 读取以 NUL 结尾的字符串（系统调用的路径参数）
+static char *load_string(const Machine *m, const Inst *inst, uint64_t addr) {
+    size_t len = 0;
+    while (*memory(m, inst, addr + len, 1)) len++;
+    return copy_range((const char *)memory(m, inst, addr, len + 1), len);
+}
+
+// Linux 的 openat 标志（asm-generic）转为宿主的标志
+static int host_open_flags(uint64_t flags) {
+    int host = (flags & 3) == 0 ? O_RDONLY : (flags & 3) == 1 ? O_WRONLY : O_RDWR;
+    if (flags & 0100) host |= O_CREAT;
+    if (flags & 0200) host |= O_EXCL;
+    if (flags & 01000) host |= O_TRUNC;
+    if (flags & 02000) host |= O_APPEND;
+    return host;
+}
+
+// 执行系统调用，返回 true 表示程序退出
+static bool do_syscall(Machine *m, const Inst *inst, int *exit_code) {
+    uint64_t *x = m->regs;
+    int64_t ret;
+    switch (x[REG_A7]) {
+        case 56: {  // openat
+            char *path = load_string(m, inst, x[REG_A1]);
+            int dirfd = (int32_t)x[REG_A0] == -100 ? AT_FDCWD : (int)x[REG_A0];
+            ret = openat(dirfd, path, host_open_flags(x[REG_A2]), (mode_t)x[REG_A3]);
+            free(path);
+            break;
+        }
+        case 57:    // close
+            ret = x[REG_A0] <= 2 ? 0 : close((int)x[REG_A0]);
+            break;
+        case 63:    // read
+            ret = read((int)x[REG_A0], memory(m, inst, x[REG_A1], x[REG_A2]), x[REG_A2]);
+            break;
+        case 64:    // write
+            ret = write((int)x[REG_A0], memory(m, inst, x[REG_A1], x[REG_A2]), x[REG_A2]);
+            break;
+        case 93:    // exit
+        case 94:    // exit_group
+            *exit_code = (int)(x[REG_A0] & 0xff);
+            return true;
+        default:
+            fprintf(stderr, "rvemu: line %d: unsupported system call %" PRIu64 "\n", inst->line, x[REG_A7]);
+            free(m->stack);
+            exit(2);
+    }
+    x[REG_A0] = canon(m, ret < 0 ? (uint64_t)(int64_t)-errno : (uint64_t)ret);
+    return false;
+}
+
+/**
+ * 从 main 开始执行，直到 main 返回或程序调用 exit
+ * @return 0 表示正常结束，exit_code 为退出状态；超出步数上限返回 -1
+ */
+static int run(Machine *m, uint64_t max_steps, int *exit_code) {
+    const Symbol *main_sym = find_symbol(m, "main");
+    if (!main_sym || !main_sym->text) {
+        fprintf(stderr, "rvemu: no main function\n");
+        return -1;
+    }
+    uint64_t *x = m->regs;
+    memset(m->regs, 0, sizeof(m->regs));
+    x[REG_SP] = STACK_TOP;
+    x[REG_RA] = EXIT_ADDR;
+    const int64_t min = m->xlen == 32 ? INT32_MIN : INT64_MIN;
+    const unsigned shift_mask = m->xlen - 1;
+
+    uint64_t pc = main_sym->addr;
+    for (;;) {
+        if (pc == EXIT_ADDR) {
+            *exit_code = (int)(x[REG_A0] & 0xff);
+            return 0;
+        }
+        uint64_t index = (pc - TEXT_BASE) / 4;
+        if (pc < TEXT_BASE || (pc - TEXT_BASE) % 4 || index >= (uint64_t)m->inst_count) {
+            fprintf(stderr, "rvemu: jump to invalid address 0x%" PRIx64 "\n", pc);
+            return -1;
+        }
+        const Inst *inst = &m->insts[index];
+        if (m->steps >= max_steps) {
+            fprintf(stderr, "rvemu: step limit exceeded\n");
+            return -1;
+        }
+        m->steps += inst->cost;
+        uint64_t next = pc + 4;
+        uint64_t a = x[inst->rs1], b = x[inst->rs2], imm = (uint64_t)inst->imm;
+        uint64_t v = 0;
+        bool writes = true;
+        switch (inst->op) {
+            case OP_LI: v = imm; break;
+            case OP_LUI: v = sext32((uint64_t)inst->imm << 12); break;
+            case OP_MV: v = a; break;
+            case OP_LA: v = inst->target; break;
+            case OP_ADDI: v = a + imm; break;
+            case OP_SLTI: v = (int64_t)a < (int64_t)imm; break;
+            case OP_XORI: v = a ^ imm; break;
+            case OP_ANDI: v = a & imm; break;
+            case OP_ORI: v = a | imm; break;
+            case OP_SLLI: v = a << (imm & shift_mask); break;
+            case OP_SRLI: v = m->xlen == 32 ? (uint32_t)a >> (imm & 31) : a >> (imm & 63); break;
+            case OP_SRAI: v = (uint64_t)((int64_t)a >> (imm & shift_mask)); break;
+            case OP_ADD: v = a + b; break;
+            case OP_SUB: v = a - b; break;
+            case OP_MUL: v = a * b; break;
+            case OP_DIV: v = (uint64_t)do_div((int64_t)a, (int64_t)b, min); break;
+            case OP_REM: v = (uint64_t)do_rem((int64_t)a, (int64_t)b, min); break;
+            case OP_SLT: v = (int64_t)a < (int64_t)b; break;
+            case OP_SGT: v = (int64_t)a > (int64_t)b; break;
+            case OP_XOR: v = a ^ b; break;
+            case OP_AND: v = a & b; break;
+            case OP_OR: v = a | b; break;
+            case OP_SLL: v = a << (b & shift_mask); break;
+            case OP_SRL: v = m->xlen == 32 ? (uint32_t)a >> (b & 31) : a >> (b & 63); break;
+            case OP_SRA: v = (uint64_t)((int64_t)a >> (b & shift_mask)); break;
+            case OP_SEQZ: v = a == 0; break;
+            case OP_SNEZ: v = a != 0; break;
+            case OP_ADDW: v = sext32(a + b); break;
+            case OP_SUBW: v = sext32(a - b); break;
+            case OP_MULW: v = sext32(a * b); break;
+            case OP_DIVW: v = sext32((uint64_t)do_div((int32_t)a, (int32_t)b, INT32_MIN)); break;
+            case OP_REMW: v = sext32((uint64_t)do_rem((int32_t)a, (int32_t)b, INT32_MIN)); break;
+            case OP_ADDIW: v = sext32(a + imm); break;
+            case OP_SLLW: v = sext32(a << (b & 31)); break;
+            case OP_SRLW: v = sext32((uint32_t)a >> (b & 31)); break;
+            case OP_SRAW: v = sext32((uint64_t)((int32_t)a >> (b & 31))); break;
+            case OP_SLLIW: v = sext32(a << (imm & 31)); break;
+            case OP_SRLIW: v = sext32((uint32_t)a >> (imm & 31)); break;
+            case OP_SRAIW: v = sext32((uint64_t)((int32_t)a >> (imm & 31))); break;
+            case OP_LW: v = load(m, inst, a + imm, 4); break;
+            case OP_LD: v = load(m, inst, a + imm, 8); break;
+            case OP_SW: store(m, inst, a + imm, 4, b); writes = false; break;
+            case OP_SD: store(m, inst, a + imm, 8, b); writes = false; break;
+            case OP_CALL:
+                x[REG_RA] = canon(m, next);
+                next = inst->target;
+                writes = false;
+                break;
+            case OP_J: next = inst->target; writes = false; break;
+            case OP_JR: next = a; writes = false; break;
+            case OP_ECALL:
+                if (do_syscall(m, inst, exit_code)) return 0;
+                writes = false;
+                break;
+        }
+        if (writes && inst->rd != 0) x[inst->rd] = canon(m, v);
+        pc = m->xlen == 32 ? next & 0xffffffffu : next;
+    }
+}
+
+static void usage(void) {
+    fprintf(stderr, "usage: rvemu [-target rv32|rv64] [-count] [-max-steps N] <assembly>\n");
+}
+
+int main(int argc, char *argv[]) {
+    Machine m;
+    memset(&m, 0, sizeof(m));
+    m.xlen = 32;
+    bool count = false;
+    uint64_t max_steps = 1000000000ull;
+    const char *file = NULL;
+
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "-target") == 0 && i + 1 < argc) {
+            const char *target = argv[++i];
+            if (strcmp(target, "rv32") == 0) m.xlen = 32;
+            else if (strcmp(target, "rv64") == 0) m.xlen = 64;
+            else {
+                usage();
+                return 2;
+            }
+        } else if (strcmp(argv[i], "-count") == 0) {
+            count = true;
+        } else if (strcmp(argv[i], "-max-steps") == 0 && i + 1 < argc) {
+            max_steps = strtoull(argv[++i], NULL, 10);
+        } else if (argv[i][0] == '-' || file) {
+            usage();
+            return 2;
+        } else {
+            file = argv[i];
+        }
+    }
+    if (!file) {
+        usage();
+        return 2;
+    }
+
+    FILE *f = fopen(file, "r");
+    if (!f) {
+        fprintf(stderr, "rvemu: cannot open %s\n", file);
+        return 2;
+    }
+    load_program(&m, f);
+    fclose(f);
+
+    m.stack = calloc(STACK_SIZE, 1);
+    int exit_code = 0;
+    int ret = run(&m, max_steps, &exit_code);
+    if (ret == 0 && count) {
+        fprintf(stderr, "rvemu: %s: returned %" PRId64 ", %" PRIu64 " instructions\n", file,
+                (int64_t)(int32_t)m.regs[REG_A0], m.steps);
+    }
+
+    for (int i = 0; i < m.inst_count; i++) free(m.insts[i].symbol);
+    for (int i = 0; i < m.symbol_count; i++) free(m.symbols[i].name);
+    free(m.insts);
+    free(m.symbols);
+    free(m.data);
+    free(m.stack);
+    return ret == 0 ? exit_code : 2;
+}
@@ -0,0 +1,141 @@
+#include "riscv_frame.h"
+#include <assert.h>
+#include <string.h>
+
+// 序言 / 尾声中计算大偏移地址使用的临时寄存器（此时不存放任何活跃值）
+#define FRAME_SCRATCH RV_REG_T0
+
+static int align_to(int value, int align) {
+    return (value + align - 1) / align * align;
+}
+
+void riscv_frame_init(RiscvFrame *frame, const RiscvTarget *target) {
+    memset(frame, 0, sizeof(*frame));
+    frame->target = target;
+    frame->reg_size = target->reg_size;
+}
+
+int riscv_frame_new_spill_slot(RiscvFrame *frame) {
+    return frame->spill_count++;
+}
+
+bool riscv_reg_is_callee_saved(RiscvReg reg) {
+    return reg == RV_REG_S0 || reg == RV_REG_S1 || (reg >= RV_REG_S2 && reg <= RV_REG_S11);
+}
+
+void riscv_frame_use_reg(RiscvFrame *frame, RiscvReg reg) {
+    if (riscv_reg_is_callee_saved(reg)) frame->callee_saved[reg] = true;
+}
+
+void riscv_frame_layout(RiscvFrame *frame) {
+    int offset = align_to(frame->outgoing_bytes, frame->reg_size);
+
+    // 保存区紧贴参数区放置，使序言和尾声中的偏移尽量落在 12 位立即数范围内
+    for (int r = 0; r < RV_REG_COUNT; r++) {
+        if (!frame->callee_saved[r]) continue;
+        frame->save_offsets[r] = offset;
+        offset += frame->reg_size;
+    }
+    if (frame->saves_ra) {
+        frame->ra_offset = offset;
+        offset += frame->reg_size;
+    }
+
+    frame->spill_base = offset;
+    offset += frame->spill_count * 4;
+
+    // 栈指针须保持 16 字节对齐
+    frame->size = align_to(offset, 16);
+}
+
+int riscv_frame_slot_offset(const RiscvFrame *frame, int slot) {
+    if (slot >= RISCV_FRAME_INCOMING_BASE) {
+        return frame->size + (slot - RISCV_FRAME_INCOMING_BASE) * frame->reg_size;
+    }
+    assert(slot >= 0 && slot < frame->spill_count);
+    return frame->spill_base + slot * 4;
+}
+
+// sp += delta
+static void emit_sp_adjust(RiscvInstBuffer *buf, int delta) {
+    if (riscv_imm12_fits(delta)) {
+        riscv_push_rri(buf, RV_OP_ADDI, RV_REG_SP, RV_REG_SP, delta);
+    } else {
+        riscv_push_ri(buf, RV_OP_LI, FRAME_SCRATCH, delta);
+        riscv_push_rrr(buf, RV_OP_ADD, RV_REG_SP, RV_REG_SP, FRAME_SCRATCH);
+    }
+}
+
+/**
+ * 访问 offset(sp)，偏移过大时先在 addr_reg 中计算地址
+ * op 为读取指令时 reg 为目的寄存器，为存储指令时 reg 为源寄存器
+ */
+static void emit_stack_access(RiscvInstBuffer *buf, RiscvOpcode op, RiscvReg reg, int offset, RiscvReg addr_reg) {
+    bool is_load = riscv_op_info(op)->format == RV_FMT_LOAD;
+    RiscvReg base = RV_REG_SP;
+    if (!riscv_imm12_fits(offset)) {
+        assert(addr_reg != RV_REG_NONE);
+        assert(is_load || addr_reg != reg);
+        riscv_push_ri(buf, RV_OP_LI, addr_reg, offset);
+        riscv_push_rrr(buf, RV_OP_ADD, addr_reg, RV_REG_SP, addr_reg);
+        base = addr_reg;
+        offset = 0;
+    }
+    RiscvInst inst = {op, RV_REG_NONE, base, RV_REG_NONE, offset, -1};
+    if (is_load) inst.rd = reg;
+    else inst.rs2 = reg;
+    riscv_buffer_push(buf, inst);
+}
+
+static void emit_prologue(const RiscvFrame *frame, RiscvInstBuffer *buf) {
+    RiscvOpcode store = frame->target->store_reg;
+    emit_sp_adjust(buf, -frame->size);
+    if (frame->saves_ra) {
+        emit_stack_access(buf, store, RV_REG_RA, frame->ra_offset, FRAME_SCRATCH);
+    }
+    for (int r = 0; r < RV_REG_COUNT; r++) {
+        if (frame->callee_saved[r]) {
+            emit_stack_access(buf, store, (RiscvReg)r, frame->save_offsets[r], FRAME_SCRATCH);
+        }
+    }
+}
+
+static void emit_epilogue(const RiscvFrame *frame, RiscvInstBuffer *buf) {
+    RiscvOpcode load = frame->target->load_reg;
+    for (int r = 0; r < RV_REG_COUNT; r++) {
+        if (frame->callee_saved[r]) {
+            emit_stack_access(buf, load, (RiscvReg)r, frame->save_offsets[r], FRAME_SCRATCH);
+        }
+    }
+    if (frame->saves_ra) {
+        emit_stack_access(buf, load, RV_REG_RA, frame->ra_offset, FRAME_SCRATCH);
+    }
+    emit_sp_adjust(buf, frame->size);
+}
+
+void riscv_frame_lower(const RiscvFrame *frame, RiscvInstBuffer *blocks, int nblocks) {
+    for (int b = 0; b < nblocks; b++) {
+        RiscvInstBuffer lowered;
+        riscv_buffer_init(&lowered);
+        if (b == 0 && frame->size > 0) emit_prologue(frame, &lowered);
+
+        for (int i = 0; i < blocks[b].len; i++) {
+            RiscvInst inst = blocks[b].insts[i];
+            if (inst.frame_slot >= 0) {
+                int offset = riscv_frame_slot_offset(frame, inst.frame_slot) + inst.imm;
+                if (inst.op == RV_OP_LW) {
+                    // 读入时目的寄存器本身即可用于计算地址
+                    emit_stack_access(&lowered, RV_OP_LW, inst.rd, offset, inst.rd);
+                } else {
+                    emit_stack_access(&lowered, RV_OP_SW, inst.rs2, offset, inst.rd);
+                }
+                continue;
+            }
+            if (inst.op == RV_OP_RET && frame->size > 0) emit_epilogue(frame, &lowered);
+            riscv_buffer_push(&lowered, inst);
+        }
+
+        riscv_buffer_free(&blocks[b]);
+        blocks[b] = lowered;
+    }
+}
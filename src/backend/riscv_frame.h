@@ -0,0 +1,62 @@
+#pragma once
+
+#include <stdbool.h>
+#include "riscv_inst.h"
+#include "riscv_target.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * 函数栈帧
+ * 自 sp 向高地址依次为：调用参数区、被调用者保存寄存器、ra、溢出槽
+ * 总大小按 16 字节对齐；不需要任何栈空间的函数 size 为 0，不生成序言和尾声
+ * 第 9 个起的传入参数位于调用者的调用参数区，即本帧之上，每个占一个寄存器宽度
+ */
+typedef struct {
+    const RiscvTarget *target;          // 目标描述，决定保存寄存器的宽度与指令
+    int reg_size;                       // 保存一个寄存器所需字节数（RV32 为 4，RV64 为 8）
+    int outgoing_bytes;                 // 调用参数区大小（超过 8 个参数的部分）
+    int spill_count;                    // 溢出槽个数，每个 4 字节
+    bool saves_ra;                      // 函数内有调用，需要保存 ra
+    bool callee_saved[RV_REG_COUNT];    // 使用到的被调用者保存寄存器
+
+    // 以下由 riscv_frame_layout 计算
+    int size;                           // 栈帧总大小
+    int spill_base;                     // 第 0 个溢出槽相对 sp 的偏移
+    int ra_offset;                      // ra 的保存位置
+    int save_offsets[RV_REG_COUNT];     // 被调用者保存寄存器的保存位置
+} RiscvFrame;
+
+// 传入参数的栈槽编号：第 8 + i 个参数为 RISCV_FRAME_INCOMING_BASE + i，与溢出槽一样经栈槽访问读取
+#define RISCV_FRAME_INCOMING_BASE 0x40000000
+
+// 初始化空栈帧
+void riscv_frame_init(RiscvFrame *frame, const RiscvTarget *target);
+
+// 分配一个新的溢出槽，返回槽编号
+int riscv_frame_new_spill_slot(RiscvFrame *frame);
+
+// 判断寄存器是否由被调用者保存（s0 ~ s11）
+bool riscv_reg_is_callee_saved(RiscvReg reg);
+
+// 记录函数使用了某个寄存器；若为被调用者保存寄存器则加入保存集合
+void riscv_frame_use_reg(RiscvFrame *frame, RiscvReg reg);
+
+// 计算栈帧大小与各区域偏移
+void riscv_frame_layout(RiscvFrame *frame);
+
+// 溢出槽或传入参数相对 sp 的偏移（须在 riscv_frame_layout 之后调用）
+int riscv_frame_slot_offset(const RiscvFrame *frame, int slot);
+
+/**
+ * 栈帧降级：将栈槽访问改写为相对 sp 的偏移，并在入口块插入序言、在每条 ret 前插入尾声
+ * 偏移超出 12 位立即数时用 li + add 先计算地址
+ * @param blocks 函数的所有基本块，blocks[0] 为入口块
+ */
+void riscv_frame_lower(const RiscvFrame *frame, RiscvInstBuffer *blocks, int nblocks);
+
+#ifdef __cplusplus
+}
+#endif
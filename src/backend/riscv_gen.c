@@ -1,184 +1,717 @@
 #include "riscv_gen.h"
 #include <assert.h>
+#include <stdarg.h>
 #include <stdbool.h>
+#include <stdint.h>
 #include <stdlib.h>
 #include <string.h>
+#include "riscv_frame.h"
+#include "riscv_isel.h"
+#include "dataflow.h"
+#include "ssa.h"
+#include "diag.h"
 
-// 简单的寄存器分配，为临时变量按顺序分配 t0, t1
-// t2, t3 作为运算时的临时寄存器
-static const char* temp_regs[] = {"t0", "t1"};
-static int reg_counter = 0;
+// 可分配给临时变量的寄存器：先用调用者保存寄存器，用尽后使用被调用者保存寄存器，再用尽则溢出到栈上
+// t2, t3 作为运算时的临时寄存器，a0 留作返回值
+// 值在最后一次使用后释放其寄存器或溢出槽，供之后定义的值复用
+// 有调用的函数中 a1 ~ a7 用于传参，不分配给值；跨越调用仍活跃的值只放在被调用者保存寄存器或溢出槽中
+static const RiscvReg allocatable_regs[] = {
+    RV_REG_T0, RV_REG_T1, RV_REG_T4, RV_REG_T5, RV_REG_T6,
+    RV_REG_A1, RV_REG_A2, RV_REG_A3, RV_REG_A4, RV_REG_A5, RV_REG_A6, RV_REG_A7,
+    RV_REG_S0, RV_REG_S1, RV_REG_S2, RV_REG_S3, RV_REG_S4, RV_REG_S5,
+    RV_REG_S6, RV_REG_S7, RV_REG_S8, RV_REG_S9, RV_REG_S10, RV_REG_S11,
+};
+#define ALLOCATABLE_COUNT ((int)(sizeof(allocatable_regs) / sizeof(allocatable_regs[0])))
 
-// 存储值到寄存器的映射
-#define MAX_VALUES 1000
-static koopa_raw_value_t value_map[MAX_VALUES];
-static int value_reg_map[MAX_VALUES];
-static int value_count = 0;
+// 生成压缩指令时优先使用 x8 ~ x15 中的调用者保存寄存器，使 c.sub、c.and 等三位寄存器编码可用
+static const RiscvReg compressible_first_regs[ALLOCATABLE_COUNT] = {
+    RV_REG_A1, RV_REG_A2, RV_REG_A3, RV_REG_A4, RV_REG_A5,
+    RV_REG_T0, RV_REG_T1, RV_REG_T4, RV_REG_T5, RV_REG_T6, RV_REG_A6, RV_REG_A7,
+    RV_REG_S0, RV_REG_S1, RV_REG_S2, RV_REG_S3, RV_REG_S4, RV_REG_S5,
+    RV_REG_S6, RV_REG_S7, RV_REG_S8, RV_REG_S9, RV_REG_S10, RV_REG_S11,
+};
+// 以下为生成单个程序时的状态，按线程保存，编译服务的多个工作线程可以同时生成代码
+static _Thread_local const RiscvReg *alloc_order = allocatable_regs;
+static _Thread_local bool reg_busy[RV_REG_COUNT];
 
-// 访问指令
-static void visit_value(FILE *output, koopa_raw_value_t value);
+// 已释放、可复用的溢出槽
+static _Thread_local int *free_slots = NULL;
+static _Thread_local int free_slot_count = 0;
+static _Thread_local int free_slot_cap = 0;
 
-// 获取值对应的寄存器索引，不存在则分配新的
-static int get_value_reg(koopa_raw_value_t value) {
-    for (int i = 0; i < value_count; i++) {
-        if (value_map[i] == value) {
-            return value_reg_map[i];
-        }
+// 值的存放位置：寄存器或栈上的溢出槽
+typedef struct {
+    bool assigned;  // 已分配位置
+    RiscvReg reg;   // RV_REG_NONE 表示溢出到栈上
+    int slot;       // 溢出槽编号
+} ValueLocation;
+
+// 按 SSA 值编号索引的存放位置，各函数复用同一数组
+static _Thread_local ValueLocation *locations = NULL;
+static _Thread_local size_t location_cap = 0;
+
+// 正在生成的程序与函数
+static _Thread_local const SsaProgram *cur_prog = NULL;
+static _Thread_local const SsaFunction *cur_func = NULL;
+
+// 当前目标
+static _Thread_local const RiscvTarget *target = NULL;
+
+// 当前函数的栈帧与各基本块的机器指令
+static _Thread_local RiscvFrame frame;
+static _Thread_local RiscvInstBuffer *blocks = NULL;
+static _Thread_local int block_count = 0;
+static _Thread_local RiscvInstBuffer *cur_block = NULL;
+
+// 当前函数的活跃性分析结果、指令选择结果，以及正在处理的基本块、指令下标
+static _Thread_local DataflowInfo liveness;
+static _Thread_local RiscvIsel isel;
+static _Thread_local bool *live_across_call = NULL;     // 按值编号：跨越调用仍活跃
+static _Thread_local bool has_calls = false;
+static _Thread_local int cur_block_index = 0;
+static _Thread_local int cur_inst_index = 0;
+
+// 当前函数中因结果无人使用而跳过、被使用者吸收的运算条数
+static _Thread_local int dead_count = 0;
+static _Thread_local int folded_count = 0;
+static _Thread_local int superopt_count = 0;
+
+// 当前占用寄存器或溢出槽的值的个数，及其在函数中的峰值
+static _Thread_local int live_count = 0;
+static _Thread_local int max_live = 0;
+
+// 剖析插桩：是否插桩、各计数器的名字（下标即编号），以及当前块中已访问的调用点数
+static _Thread_local bool instrument = false;
+static _Thread_local char **counter_names = NULL;
+static _Thread_local int counter_count = 0;
+static _Thread_local int counter_cap = 0;
+static _Thread_local int call_site_index = 0;
+
+#define PROFILE_COUNTERS_SYMBOL "__profile_counters"
+#define PROFILE_WRITE_SYMBOL "__profile_write"
+
+// 获取值的存放位置，不存在则分配空闲的寄存器或溢出槽
+static ValueLocation *get_value_location(SsaValueId value) {
+    ValueLocation *loc = &locations[value];
+    if (loc->assigned) return loc;
+
+    loc->assigned = true;
+    loc->reg = RV_REG_NONE;
+    loc->slot = -1;
+    int id = dataflow_value_id(&liveness, value);
+    bool across = id >= 0 && live_across_call[id];
+    for (int i = 0; i < ALLOCATABLE_COUNT; i++) {
+        RiscvReg reg = alloc_order[i];
+        if (reg_busy[reg]) continue;
+        if (across && !riscv_reg_is_callee_saved(reg)) continue;
+        if (has_calls && reg >= RV_REG_A0 && reg <= RV_REG_A7) continue;
+        loc->reg = reg;
+        break;
     }
-    // 分配新寄存器
-    int reg_idx = reg_counter % 2;
-    value_map[value_count] = value;
-    value_reg_map[value_count] = reg_idx;
-    value_count++;
-    reg_counter++;
-    return reg_idx;
+    if (loc->reg != RV_REG_NONE) {
+        reg_busy[loc->reg] = true;
+        riscv_frame_use_reg(&frame, loc->reg);
+    } else if (free_slot_count > 0) {
+        loc->slot = free_slots[--free_slot_count];
+    } else {
+        loc->slot = riscv_frame_new_spill_slot(&frame);
+    }
+    if (++live_count > max_live) max_live = live_count;
+    return loc;
+}
+
+// 将值固定在 reg 中（不经过分配，如叶函数的传入参数）
+static void bind_value_to_reg(SsaValueId value, RiscvReg reg) {
+    ValueLocation *loc = &locations[value];
+    assert(!loc->assigned);
+    loc->assigned = true;
+    loc->reg = reg;
+    loc->slot = -1;
+    reg_busy[reg] = true;
+    if (++live_count > max_live) max_live = live_count;
+}
+
+// 释放值占用的寄存器或溢出槽（位置保留，值不会再被使用）
+static void release_location(ValueLocation *loc) {
+    live_count--;
+    if (loc->reg != RV_REG_NONE) {
+        reg_busy[loc->reg] = false;
+        return;
+    }
+    if (free_slot_count == free_slot_cap) {
+        free_slot_cap = free_slot_cap ? free_slot_cap * 2 : 16;
+        free_slots = realloc(free_slots, free_slot_cap * sizeof(int));
+        assert(free_slots);
+    }
+    free_slots[free_slot_count++] = loc->slot;
+}
+
+// 释放在当前块第 inst_index 条指令处最后一次使用的操作数，须在读取所有操作数之后、分配结果之前调用
+static void release_dead_operands(int inst_index) {
+    const int *start = liveness.kill_start[cur_block_index];
+    const int *kills = liveness.kills[cur_block_index];
+    for (int j = start[inst_index]; j < start[inst_index + 1]; j++) {
+        ValueLocation *loc = &locations[kills[j]];
+        if (loc->assigned) release_location(loc);
+    }
+}
+
+// 将常量装入 reg：12 位立即数用 li，其余用 lui 装入高 20 位，低 12 位非零时再 addi（RV64 上为 addiw）
+static void load_const(RiscvReg reg, int32_t value) {
+    if (riscv_imm12_fits(value)) {
+        riscv_push_ri(cur_block, RV_OP_LI, reg, value);
+        return;
+    }
+    int32_t low = (int32_t)((uint32_t)value << 20) >> 20;
+    riscv_push_ri(cur_block, RV_OP_LUI, reg, (int32_t)(((uint32_t)value - (uint32_t)low) >> 12));
+    if (low != 0) riscv_push_rri(cur_block, riscv_target_op(target, RV_OP_ADDI), reg, reg, low);
+}
+
+/**
+ * 获取操作数所在的寄存器
+ * 常量 0 直接使用 x0，其余整数常量装入 scratch，溢出的值从栈槽读入 scratch，其余直接使用分配到的寄存器
+ */
+static RiscvReg use_operand(SsaValueId value, RiscvReg scratch) {
+    const SsaValue *v = &cur_func->values[value];
+    if (v->op == SSA_CONST) {
+        if (v->imm == 0) return RV_REG_ZERO;
+        load_const(scratch, v->imm);
+        return scratch;
+    }
+    ValueLocation *loc = get_value_location(value);
+    if (loc->reg != RV_REG_NONE) return loc->reg;
+    riscv_push_slot_load(cur_block, scratch, loc->slot);
+    return scratch;
 }
 
 // 加载值到指定寄存器
-static void load_value_to_reg(FILE *output, koopa_raw_value_t value, const char* reg) {
-    if (value->kind.tag == KOOPA_RVT_INTEGER) {
-        fprintf(output, "  li %s, %d\n", reg, value->kind.data.integer.value);
-    } else {
-        int val_reg = get_value_reg(value);
-        const char* val_reg_name = temp_regs[val_reg];
-        if (strcmp(val_reg_name, reg) != 0) {
-            fprintf(output, "  mv %s, %s\n", reg, val_reg_name);
-        }
+static void load_value_to_reg(SsaValueId value, RiscvReg reg) {
+    RiscvReg src = use_operand(value, reg);
+    if (src != reg) {
+        riscv_push_rr(cur_block, RV_OP_MV, reg, src);
+    }
+}
+
+/**
+ * 新建一个名为 printf 格式 fmt 的计数器，并在当前块追加将其加一的指令
+ * 经 t2、t3 访问计数器，这两个寄存器只在单条运算内部使用，插在任意两条指令之间都不影响其他值
+ */
+static void push_counter(const char *fmt, ...) {
+    va_list args;
+    va_start(args, fmt);
+    int len = vsnprintf(NULL, 0, fmt, args);
+    va_end(args);
+    char *name = malloc(len + 1);
+    assert(name);
+    va_start(args, fmt);
+    vsnprintf(name, len + 1, fmt, args);
+    va_end(args);
+    if (counter_count == counter_cap) {
+        counter_cap = counter_cap ? counter_cap * 2 : 64;
+        counter_names = realloc(counter_names, counter_cap * sizeof(char *));
+        assert(counter_names);
     }
+    counter_names[counter_count] = name;
+
+    riscv_push_la(cur_block, RV_REG_T2, PROFILE_COUNTERS_SYMBOL, counter_count * 4);
+    RiscvInst load = {RV_OP_LW, RV_REG_T3, RV_REG_T2, RV_REG_NONE, 0, -1, NULL};
+    riscv_buffer_push(cur_block, load);
+    riscv_push_rri(cur_block, RV_OP_ADDI, RV_REG_T3, RV_REG_T3, 1);
+    RiscvInst store = {RV_OP_SW, RV_REG_NONE, RV_REG_T2, RV_REG_T3, 0, -1, NULL};
+    riscv_buffer_push(cur_block, store);
+    counter_count++;
 }
 
 // 访问 return 指令
-static void visit_return(FILE *output, koopa_raw_return_t ret) {
-    koopa_raw_value_t ret_value = ret.value;
-    if (ret_value != NULL) {
-        if (ret_value->kind.tag == KOOPA_RVT_INTEGER) {
-            // 返回整数常量
-            fprintf(output, "  li a0, %d\n", ret_value->kind.data.integer.value);
-        } else {
-            // 返回临时变量
-            int ret_reg = get_value_reg(ret_value);
-            fprintf(output, "  mv a0, %s\n", temp_regs[ret_reg]);
+static void visit_return(SsaValueId inst) {
+    if (cur_func->values[inst].operand_count > 0) {
+        // 返回值放入 a0
+        load_value_to_reg(ssa_operands(cur_func, inst)[0], RV_REG_A0);
+    }
+    release_dead_operands(cur_inst_index);
+    // 插桩时 main 返回前写出剖析数据，写出例程保持 a0 不变
+    if (instrument && strcmp(cur_func->name, "main") == 0) {
+        riscv_push_call(cur_block, PROFILE_WRITE_SYMBOL);
+        frame.saves_ra = true;
+    }
+    riscv_push_op(cur_block, RV_OP_RET);
+}
+
+/**
+ * 访问 call 指令
+ * 前 8 个实参放入 a0 ~ a7，其余依次写入栈帧底部的调用参数区；结果自 a0 取回
+ * 有调用的函数不把值分配到 a 寄存器，装入实参时不会覆盖其他仍需读取的值
+ */
+static void visit_call(SsaValueId value) {
+  const SsaValue *call = &cur_func->values[value];
+  const SsaValueId *args = ssa_operands(cur_func, value);
+  int nargs = (int) call->operand_count;
+  if (instrument) {
+    push_counter("call %s %s %d %s", cur_func->name, cur_func->blocks[cur_block_index].name, call_site_index++,
+                 cur_prog->funcs[call->imm].name);
+  }
+  for (int i = 8; i < nargs; i++) {
+    int offset = (i - 8) * frame.reg_size;
+    RiscvReg src = use_operand(args[i], RV_REG_T2);
+    // 偏移超出 12 位立即数时与栈槽访问一样，先在 t3 中算出地址
+    RiscvReg base = RV_REG_SP;
+    if (!riscv_imm12_fits(offset)) {
+      riscv_push_ri(cur_block, RV_OP_LI, RV_REG_T3, offset);
+      riscv_push_rrr(cur_block, RV_OP_ADD, RV_REG_T3, RV_REG_SP, RV_REG_T3);
+      base = RV_REG_T3;
+      offset = 0;
+    }
+    RiscvInst store = {target->store_reg, RV_REG_NONE, base, src, offset, -1, NULL};
+    riscv_buffer_push(cur_block, store);
+  }
+  if (nargs > 8 && (nargs - 8) * frame.reg_size > frame.outgoing_bytes) {
+    frame.outgoing_bytes = (nargs - 8) * frame.reg_size;
+  }
+  for (int i = 0; i < nargs && i < 8; i++) {
+    load_value_to_reg(args[i], (RiscvReg) (RV_REG_A0 + i));
+  }
+  release_dead_operands(cur_inst_index);
+
+  riscv_push_call(cur_block, cur_prog->funcs[call->imm].name);
+  frame.saves_ra = true;
+
+  int id = dataflow_value_id(&liveness, value);
+  if (id < 0 || liveness.use_count[id] == 0) return;
+  ValueLocation *result = get_value_location(value);
+  if (result->reg != RV_REG_NONE) {
+    riscv_push_rr(cur_block, RV_OP_MV, result->reg, RV_REG_A0);
+  } else {
+    riscv_push_slot_store(cur_block, RV_REG_A0, result->slot, RV_REG_T3);
+  }
+}
+
+/**
+ * 生成超优化表中的指令序列：x 为左操作数所在寄存器，中间结果放在 t3，最后一条写入 rd
+ * rd 可能就是 x 所在的寄存器（x 此后不再使用），表中只有最后一条指令写结果，之前的指令都能读到 x
+ */
+static void push_superopt_sequence(const SuperoptEntry *entry, RiscvReg x, RiscvReg rd) {
+    const RiscvReg regs[] = {
+        [SUPEROPT_X] = x, [SUPEROPT_T] = RV_REG_T3, [SUPEROPT_R] = rd, [SUPEROPT_ZERO] = RV_REG_ZERO,
+    };
+    for (int i = 0; i < entry->length; i++) {
+        const SuperoptInst *inst = &entry->insts[i];
+        RiscvOpcode op = riscv_target_op(target, inst->op);
+        switch (riscv_op_info(inst->op)->format) {
+            case RV_FMT_RRR:
+                riscv_push_rrr(cur_block, op, regs[inst->rd], regs[inst->rs1], regs[inst->rs2]);
+                break;
+            case RV_FMT_RRI:
+                riscv_push_rri(cur_block, op, regs[inst->rd], regs[inst->rs1], inst->imm);
+                break;
+            case RV_FMT_RI:
+                riscv_push_ri(cur_block, op, regs[inst->rd], inst->imm);
+                break;
+            case RV_FMT_RR:
+                riscv_push_rr(cur_block, op, regs[inst->rd], regs[inst->rs1]);
+                break;
+            default:
+                assert(false && "Unexpected superoptimizer instruction format");
         }
     }
-    fprintf(output, "  ret\n");
-}
-
-// 访问二元运算指令
-static void visit_binary(FILE *output, koopa_raw_value_t value, koopa_raw_binary_t binary) {
-    koopa_raw_value_t lhs = binary.lhs;
-    koopa_raw_value_t rhs = binary.rhs;
-    
-    // 分配结果至寄存器
-    int result_reg = get_value_reg(value);
-    const char* target_reg = temp_regs[result_reg];
-    
-    // 分别载入左右操作数
-    load_value_to_reg(output, lhs, "t2");
-    load_value_to_reg(output, rhs, "t3");
-    
-    // 执行运算，使用 t2 和 t3 作为操作数，结果存储到目标寄存器
-    switch (binary.op) {
-        case KOOPA_RBO_ADD:
-            fprintf(output, "  add %s, t2, t3\n", target_reg);
-            break;
-        case KOOPA_RBO_SUB:
-            fprintf(output, "  sub %s, t2, t3\n", target_reg);
-            break;
-        case KOOPA_RBO_MUL:
-            fprintf(output, "  mul %s, t2, t3\n", target_reg);
-            break;
-        case KOOPA_RBO_DIV:
-            fprintf(output, "  div %s, t2, t3\n", target_reg);
-            break;
-        case KOOPA_RBO_MOD:
-            fprintf(output, "  rem %s, t2, t3\n", target_reg);
-            break;
-        case KOOPA_RBO_LT:
-            fprintf(output, "  slt %s, t2, t3\n", target_reg);
-            break;
-        case KOOPA_RBO_GT:
-            fprintf(output, "  sgt %s, t2, t3\n", target_reg);
-            break;
-        case KOOPA_RBO_LE:
-            fprintf(output, "  sgt %s, t2, t3\n", target_reg);
-            fprintf(output, "  seqz %s, %s\n", target_reg, target_reg);
-            break;
-        case KOOPA_RBO_GE:
-            fprintf(output, "  slt %s, t2, t3\n", target_reg);
-            fprintf(output, "  seqz %s, %s\n", target_reg, target_reg);
-            break;
-        case KOOPA_RBO_EQ:
-            fprintf(output, "  xor %s, t2, t3\n", target_reg);
-            fprintf(output, "  seqz %s, %s\n", target_reg, target_reg);
+    superopt_count++;
+}
+
+// 按选定的覆盖生成二元运算
+static void visit_binary(SsaValueId value) {
+    const RiscvTile *tile = riscv_isel_tile(&isel, value);
+    assert(tile);
+    RiscvFormat format = tile->seq ? RV_FMT_NONE : riscv_op_info(tile->op)->format;
+
+    // 分别取得左右操作数所在寄存器，常量与溢出值经由 t2、t3 载入
+    RiscvReg lhs_reg = use_operand(tile->lhs, RV_REG_T2);
+    RiscvReg rhs_reg = format == RV_FMT_RRR ? use_operand(tile->rhs, RV_REG_T3) : RV_REG_NONE;
+
+    // 操作数已读出，最后一次使用的操作数的寄存器可直接作为结果寄存器；
+    // 被吸收的指令的操作数推迟到这里才读取，也在这里释放
+    release_dead_operands(cur_inst_index);
+    if (tile->folded >= 0) release_dead_operands(tile->folded);
+
+    // 分配结果至寄存器；溢出的结果先算到 t2，再写回栈槽
+    ValueLocation *result = get_value_location(value);
+    RiscvReg target_reg = result->reg != RV_REG_NONE ? result->reg : RV_REG_T2;
+
+    RiscvOpcode op = riscv_target_op(target, tile->op);
+    switch (format) {
+        case RV_FMT_RRR:
+            riscv_push_rrr(cur_block, op, target_reg, lhs_reg, rhs_reg);
             break;
-        case KOOPA_RBO_NOT_EQ:
-            fprintf(output, "  xor %s, t2, t3\n", target_reg);
-            fprintf(output, "  snez %s, %s\n", target_reg, target_reg);
+        case RV_FMT_RRI:
+            // 左操作数为 0 的加法（如 0 - c）即装入立即数
+            if (tile->op == RV_OP_ADDI && lhs_reg == RV_REG_ZERO) riscv_push_ri(cur_block, RV_OP_LI, target_reg, tile->imm);
+            else riscv_push_rri(cur_block, op, target_reg, lhs_reg, tile->imm);
             break;
-        case KOOPA_RBO_AND:
-            fprintf(output, "  and %s, t2, t3\n", target_reg);
+        case RV_FMT_RR:
+            riscv_push_rr(cur_block, op, target_reg, lhs_reg);
             break;
-        case KOOPA_RBO_OR:
-            fprintf(output, "  or %s, t2, t3\n", target_reg);
+        case RV_FMT_NONE:
+            push_superopt_sequence(tile->seq, lhs_reg, target_reg);
             break;
         default:
-            assert(false && "Unsupported binary operation");
+            assert(false && "Unexpected tile format");
+    }
+    if (tile->post != RV_OP_NONE) {
+        riscv_push_rr(cur_block, tile->post, target_reg, target_reg);
+    }
+
+    if (result->reg == RV_REG_NONE) {
+        riscv_push_slot_store(cur_block, target_reg, result->slot, RV_REG_T3);
     }
 }
 
 // 访问指令
-static void visit_value(FILE *output, koopa_raw_value_t value) {
-    koopa_raw_value_kind_t kind = value->kind;
-    switch (kind.tag) {
-        case KOOPA_RVT_RETURN:
-            visit_return(output, kind.data.ret);
-            break;
-        case KOOPA_RVT_INTEGER:
-            // 整数值不需要单独处理，在使用时处理
+static void visit_value(SsaValueId value) {
+    switch (cur_func->values[value].op) {
+        case SSA_RET:
+            visit_return(value);
             break;
-        case KOOPA_RVT_BINARY:
-            visit_binary(output, value, kind.data.binary);
+        case SSA_CALL:
+            visit_call(value);
             break;
         default:
-            assert(false && "Unsupported value type");
+            assert(ssa_is_binary(&cur_func->values[value]) && "Unsupported instruction");
+            // 被使用者吸收的运算随使用者一起生成
+            if (riscv_isel_covered(&isel, value)) {
+                folded_count++;
+                break;
+            }
+            visit_binary(value);
+            break;
     }
 }
 
-// 访问基本块
-static void visit_basic_block(FILE *output, koopa_raw_basic_block_t bb) {
+// 访问基本块：为其中的指令选择机器指令
+static void visit_basic_block(int block) {
+  // 先为整个基本块选择覆盖，再按顺序生成
+  riscv_isel_select_block(&isel, block);
+  if (instrument) push_counter("block %s %s", cur_func->name, cur_func->blocks[block].name);
+  call_site_index = 0;
+
   // 访问所有指令
-  for (size_t i = 0; i < bb->insts.len; ++i) {
-    koopa_raw_value_t value = (koopa_raw_value_t) bb->insts.buffer[i];
-    visit_value(output, value);
+  for (uint32_t i = 0; i < cur_func->blocks[block].inst_count; ++i) {
+    cur_inst_index = (int) i;
+    visit_value(ssa_block_inst(cur_func, block, i));
   }
 }
 
-// 访问函数
-static void visit_function(FILE *output, koopa_raw_function_t func) {
-  // 重置寄存器
-  reg_counter = 0;
-  value_count = 0;
+/**
+ * 在入口处安置传入参数
+ * 没有调用的函数中前 8 个参数直接留在 a0 ~ a7；有调用时先移入分配到的位置，为传参腾出 a 寄存器
+ * 第 9 个起的参数从调用者的调用参数区读入
+ */
+static void place_params(void) {
+  for (uint32_t i = 0; i < cur_func->param_count; ++i) {
+    SsaValueId param = i;
+    if (liveness.use_count[param] == 0) continue;
+    if (i < 8 && !has_calls) {
+      bind_value_to_reg(param, (RiscvReg) (RV_REG_A0 + i));
+      continue;
+    }
+    ValueLocation *loc = get_value_location(param);
+    RiscvReg reg = loc->reg != RV_REG_NONE ? loc->reg : RV_REG_T2;
+    if (i < 8) {
+      reg = (RiscvReg) (RV_REG_A0 + i);
+      if (loc->reg != RV_REG_NONE) riscv_push_rr(cur_block, RV_OP_MV, loc->reg, reg);
+    } else {
+      riscv_push_slot_load(cur_block, reg, RISCV_FRAME_INCOMING_BASE + (int) i - 8);
+    }
+    if (loc->reg == RV_REG_NONE) riscv_push_slot_store(cur_block, reg, loc->slot, RV_REG_T3);
+  }
+}
+
+// 统计中机器指令的类别：li（含 lui）、move、muldiv、load、store、control（call、ret），其余为 alu
+static const char *const stats_inst_classes[] = {
+    "machine_insts.total", "machine_insts.alu", "machine_insts.muldiv", "machine_insts.load",
+    "machine_insts.store", "machine_insts.move", "machine_insts.li", "machine_insts.control",
+};
+
+static const char *stats_inst_class(RiscvOpcode op) {
+  switch (op) {
+    case RV_OP_LI: case RV_OP_LUI: return "machine_insts.li";
+    case RV_OP_MV: return "machine_insts.move";
+    case RV_OP_CALL: case RV_OP_RET: return "machine_insts.control";
+    default: break;
+  }
+  switch (riscv_op_info(op)->cls) {
+    case RV_CLASS_MUL: case RV_CLASS_DIV: return "machine_insts.muldiv";
+    case RV_CLASS_LOAD: return "machine_insts.load";
+    case RV_CLASS_STORE: return "machine_insts.store";
+    default: return "machine_insts.alu";
+  }
+}
+
+// 统计一个基本块的最终机器指令，并记下读写的寄存器
+static void record_block_stats(FuncStats *stats, const RiscvInstBuffer *buf, bool regs_used[RV_REG_COUNT]) {
+  for (int i = 0; i < buf->len; i++) {
+    const RiscvInst *inst = &buf->insts[i];
+    func_stats_add(stats, "machine_insts.total", 1);
+    func_stats_add(stats, stats_inst_class(inst->op), 1);
+    RiscvReg regs[3];
+    int n = riscv_inst_defs(inst, regs);
+    for (int k = 0; k < n; k++) regs_used[regs[k]] = true;
+    n = riscv_inst_uses(inst, regs);
+    for (int k = 0; k < n; k++) regs_used[regs[k]] = true;
+  }
+}
+
+// 记录函数级统计；用到的寄存器不含 zero、sp 与 ra
+static void record_function_stats(FuncStats *stats, const bool regs_used[RV_REG_COUNT], int code_bytes,
+                                  int cycles_before, int cycles_after, const RiscvGenOptions *options) {
+  int regs = 0;
+  for (int r = 0; r < RV_REG_COUNT; r++) {
+    if (regs_used[r] && r != RV_REG_ZERO && r != RV_REG_SP && r != RV_REG_RA) regs++;
+  }
+  func_stats_set(stats, "regs_used", regs);
+  func_stats_set(stats, "max_live", max_live);
+  func_stats_set(stats, "spills", frame.spill_count);
+  func_stats_set(stats, "frame_size", frame.size);
+  func_stats_set(stats, "code_bytes", code_bytes);
+  if (options->eliminate_dead) func_stats_set(stats, "passes.dce.removed", dead_count);
+  if (options->fold) func_stats_set(stats, "passes.fold.folded", folded_count);
+  if (options->superopt) func_stats_set(stats, "passes.superopt.lowered", superopt_count);
+  if (options->schedule) {
+    func_stats_set(stats, "passes.sched.cycles_before", cycles_before);
+    func_stats_set(stats, "passes.sched.cycles_after", cycles_after);
+  }
+}
+
+// 重置函数级状态
+static void reset_function_state(int nblocks, size_t nvalues) {
+  memset(reg_busy, 0, sizeof(reg_busy));
+  free_slot_count = 0;
+  dead_count = 0;
+  folded_count = 0;
+  superopt_count = 0;
+  live_count = 0;
+  max_live = 0;
+  if (nvalues > location_cap) {
+    free(locations);
+    location_cap = nvalues * 2;
+    locations = malloc(location_cap * sizeof(ValueLocation));
+    assert(locations);
+  }
+  if (nvalues) memset(locations, 0, nvalues * sizeof(ValueLocation));
+  riscv_frame_init(&frame, target);
+
+  blocks = malloc(nblocks * sizeof(RiscvInstBuffer));
+  assert(nblocks == 0 || blocks);
+  for (int i = 0; i < nblocks; i++) riscv_buffer_init(&blocks[i]);
+  block_count = nblocks;
+}
+
+// 访问函数：删除死代码、选择指令、确定栈帧、调度后输出
+static void visit_function(FILE *output, SsaFunction *func, const RiscvGenOptions *options) {
+  // 函数声明没有函数体，无需生成代码
+  if (func->block_count == 0) return;
+
+  cur_func = func;
+  reset_function_state((int) func->block_count, func->value_count);
+  // 结果无人使用的运算就地删除，不生成代码
+  if (options->eliminate_dead) dead_count = dataflow_eliminate_dead(func);
+  dataflow_analyze(&liveness, func);
+  riscv_isel_init(&isel, &liveness, options->fold, options->superopt);
+  live_across_call = malloc((liveness.value_count ? liveness.value_count : 1) * sizeof(bool));
+  assert(live_across_call);
+  has_calls = dataflow_live_across_calls(&liveness, live_across_call);
   
-  // 函数名去掉 @ 前缀
-  const char *func_name = func->name + 1;
+  const char *func_name = func->name;
+
+  cur_block = &blocks[0];
+  cur_block_index = 0;
+  place_params();
   
+  // 访问所有基本块
+  for (uint32_t i = 0; i < func->block_count; ++i) {
+    cur_block = &blocks[i];
+    cur_block_index = (int) i;
+    visit_basic_block((int) i);
+  }
+  riscv_isel_free(&isel);
+  free(live_across_call);
+  live_across_call = NULL;
+  dataflow_free(&liveness);
+
+  // 所有溢出槽和用到的寄存器已确定，计算栈帧并插入序言、尾声
+  riscv_frame_layout(&frame);
+  riscv_frame_lower(&frame, blocks, block_count);
+
   // 生成函数标签和全局声明
   fprintf(output, "  .text\n");
   fprintf(output, "  .globl %s\n", func_name);
   fprintf(output, "%s:\n", func_name);
-  
-  // 访问所有基本块
-  for (size_t i = 0; i < func->bbs.len; ++i) {
-    koopa_raw_basic_block_t bb = (koopa_raw_basic_block_t) func->bbs.buffer[i];
-    visit_basic_block(output, bb);
+
+  FuncStats *stats = options->stats ? compile_stats_function(options->stats, func_name) : NULL;
+  for (size_t i = 0; stats && i < sizeof(stats_inst_classes) / sizeof(stats_inst_classes[0]); i++) {
+    func_stats_set(stats, stats_inst_classes[i], 0);
+  }
+  bool regs_used[RV_REG_COUNT] = {false};
+  int cycles_before = 0, cycles_after = 0, code_bytes = 0;
+  for (int i = 0; i < block_count; i++) {
+    cycles_before += riscv_modeled_cycles(blocks[i].insts, blocks[i].len, &options->latency);
+    if (options->schedule) {
+      riscv_schedule_block(&blocks[i], &options->latency);
+    }
+    cycles_after += riscv_modeled_cycles(blocks[i].insts, blocks[i].len, &options->latency);
+    code_bytes += riscv_emit_buffer_for(output, &blocks[i], target, options->compress);
+    if (stats) record_block_stats(stats, &blocks[i], regs_used);
+    riscv_buffer_free(&blocks[i]);
+  }
+  free(blocks);
+  blocks = NULL;
+  cur_block = NULL;
+  cur_func = NULL;
+
+  if (stats) record_function_stats(stats, regs_used, code_bytes, cycles_before, cycles_after, options);
+  if (options->report_cycles) {
+    fprintf(diag_err(), "[sched] %s: %d -> %d modeled cycles\n", func_name, cycles_before, cycles_after);
+  }
+  if (options->report_size) {
+    fprintf(diag_err(), "[size] %s: %d bytes\n", func_name, code_bytes);
+  }
+}
+
+void riscv_gen_options_default(RiscvGenOptions *options) {
+  options->schedule = true;
+  options->report_cycles = false;
+  options->eliminate_dead = true;
+  options->fold = true;
+  options->superopt = true;
+  options->target = riscv_target_default();
+  options->compress = false;
+  options->report_size = false;
+  options->stats = NULL;
+  options->profile_gen = NULL;
+  options->profile = NULL;
+  riscv_latency_default(&options->latency);
+}
+
+// 输出汇编字符串字面量
+static void emit_asm_string(FILE *output, const char *s) {
+  fputs("  .asciz \"", output);
+  for (; *s; s++) {
+    if (*s == '"' || *s == '\\') fputc('\\', output);
+    fputc(*s, output);
+  }
+  fputs("\"\n", output);
+}
+
+/**
+ * 输出剖析数据及其写出例程（格式见 profile.h）
+ * 写出例程经 Linux 系统调用 openat、write、close 把整个数据区写入 path，不改变 a0
+ */
+static void emit_profile_runtime(FILE *output, const char *path) {
+  int names_size = 0;
+  for (int i = 0; i < counter_count; i++) names_size += (int) strlen(counter_names[i]) + 1;
+  int data_size = PROFILE_HEADER_WORDS * 4 + counter_count * 4 + names_size;
+
+  fprintf(output, "  .text\n");
+  fprintf(output, "%s:\n", PROFILE_WRITE_SYMBOL);
+  fprintf(output, "  mv t0, a0\n");
+  fprintf(output, "  li a0, -100\n");                   // AT_FDCWD
+  fprintf(output, "  la a1, __profile_path\n");
+  fprintf(output, "  li a2, 577\n");                    // O_WRONLY | O_CREAT | O_TRUNC
+  fprintf(output, "  li a3, 420\n");                    // 0644
+  fprintf(output, "  li a7, 56\n");                     // openat
+  fprintf(output, "  ecall\n");
+  fprintf(output, "  mv t1, a0\n");
+  fprintf(output, "  la a1, __profile_data\n");
+  fprintf(output, "  li a2, %d\n", data_size);
+  fprintf(output, "  li a7, 64\n");                     // write
+  fprintf(output, "  ecall\n");
+  fprintf(output, "  mv a0, t1\n");
+  fprintf(output, "  li a7, 57\n");                     // close
+  fprintf(output, "  ecall\n");
+  fprintf(output, "  mv a0, t0\n");
+  fprintf(output, "  ret\n");
+
+  fprintf(output, "  .data\n");
+  fprintf(output, "  .align 2\n");
+  fprintf(output, "__profile_data:\n");
+  fprintf(output, "  .word %u, %d, %d, %d\n", PROFILE_MAGIC, PROFILE_VERSION, counter_count, names_size);
+  fprintf(output, "%s:\n", PROFILE_COUNTERS_SYMBOL);
+  fprintf(output, "  .zero %d\n", counter_count * 4);
+  for (int i = 0; i < counter_count; i++) emit_asm_string(output, counter_names[i]);
+  fprintf(output, "__profile_path:\n");
+  emit_asm_string(output, path);
+}
+
+// 函数的输出顺序：按剖析得到的进入次数从高到低，不在剖析数据中的函数随后，剖析中从未进入的函数最后
+typedef struct {
+  uint32_t index;
+  int rank;               // 0：执行过，1：不在剖析数据中，2：从未进入
+  uint64_t entries;
+} FunctionOrder;
+
+static int compare_function_order(const void *a, const void *b) {
+  const FunctionOrder *x = a, *y = b;
+  if (x->rank != y->rank) return x->rank - y->rank;
+  if (x->entries != y->entries) return x->entries < y->entries ? 1 : -1;
+  return (x->index > y->index) - (x->index < y->index);
+}
+
+static void profile_function_order(const SsaProgram *prog, const Profile *profile, uint32_t *order) {
+  FunctionOrder *keys = malloc((prog->func_count ? prog->func_count : 1) * sizeof(FunctionOrder));
+  assert(keys);
+  for (uint32_t i = 0; i < prog->func_count; ++i) {
+    const ProfileFunction *f = profile_find_function(profile, prog->funcs[i].name);
+    keys[i].index = i;
+    keys[i].rank = !f ? 1 : f->entries == 0 ? 2 : 0;
+    keys[i].entries = f ? f->entries : 0;
   }
+  qsort(keys, prog->func_count, sizeof(FunctionOrder), compare_function_order);
+  for (uint32_t i = 0; i < prog->func_count; ++i) order[i] = keys[i].index;
+  free(keys);
 }
 
-// 从 raw program 生成 RISC-V 汇编代码
-void generate_riscv_from_raw_program(FILE *output, koopa_raw_program_t raw) {
-  // 访问所有函数
-  for (size_t i = 0; i < raw.funcs.len; ++i) {
-    koopa_raw_function_t func = (koopa_raw_function_t) raw.funcs.buffer[i];
-    visit_function(output, func);
+void generate_riscv(FILE *output, SsaProgram *prog, const RiscvGenOptions *options) {
+  RiscvGenOptions defaults;
+  if (!options) {
+    riscv_gen_options_default(&defaults);
+    options = &defaults;
   }
-}
\ No newline at end of file
+  target = options->target;
+  alloc_order = options->compress ? compressible_first_regs : allocatable_regs;
+  cur_prog = prog;
+
+  instrument = options->profile_gen != NULL;
+  counter_count = 0;
+
+  // 访问所有函数；有剖析数据时热函数集中在前，从未执行的函数移到最后
+  uint32_t *order = malloc((prog->func_count ? prog->func_count : 1) * sizeof(uint32_t));
+  assert(order);
+  for (uint32_t i = 0; i < prog->func_count; ++i) order[i] = i;
+  if (options->profile) profile_function_order(prog, options->profile, order);
+  for (uint32_t i = 0; i < prog->func_count; ++i) {
+    visit_function(output, &prog->funcs[order[i]], options);
+  }
+  free(order);
+
+  if (instrument) emit_profile_runtime(output, options->profile_gen);
+  for (int i = 0; i < counter_count; i++) free(counter_names[i]);
+  free(counter_names);
+  counter_names = NULL;
+  counter_count = 0;
+  counter_cap = 0;
+  instrument = false;
+
+  cur_prog = NULL;
+  free(locations);
+  locations = NULL;
+  location_cap = 0;
+  free(free_slots);
+  free_slots = NULL;
+  free_slot_cap = 0;
+}
+
+// 从 raw program 生成 RISC-V 汇编代码：先导入为 SSA IR
+int generate_riscv_from_raw_program(FILE *output, koopa_raw_program_t raw, const RiscvGenOptions *options) {
+  SsaProgram prog;
+  if (ssa_import_koopa(&prog, raw) != 0) return -1;
+  generate_riscv(output, &prog, options);
+  ssa_program_free(&prog);
+  return 0;
+}
@@ -1,15 +1,49 @@
 #pragma once
 
+#include <stdbool.h>
 #include <stdio.h>
 #include "koopa.h"
+#include "profile.h"
+#include "ssa.h"
+#include "riscv_sched.h"
+#include "riscv_target.h"
+#include "stats.h"
 
 #ifdef __cplusplus
 extern "C" {
 #endif
 
-// 从 raw program 生成 RISC-V 汇编代码
-void generate_riscv_from_raw_program(FILE *output, koopa_raw_program_t raw);
+// 后端选项
+typedef struct {
+    bool schedule;               // 是否做基本块内指令调度
+    bool report_cycles;          // 是否向 stderr 报告调度前后的模型周期数
+    RiscvLatencyModel latency;   // 调度使用的延迟模型
+    bool eliminate_dead;         // 是否先删除结果无人使用的运算
+    bool fold;                   // 指令选择时是否把单次使用的子运算并入使用者
+    bool superopt;               // 常量右操作数的运算是否查超优化表
+    const RiscvTarget *target;   // 目标（rv32 / rv64）
+    bool compress;               // 是否输出 C 扩展压缩指令
+    bool report_size;            // 是否向 stderr 报告每个函数的代码字节数
+    CompileStats *stats;         // 不为 NULL 时记录每个函数的机器指令、寄存器与栈帧统计
+    const char *profile_gen;     // 不为 NULL 时插入剖析计数器，main 返回前把剖析数据写入该路径
+    const Profile *profile;      // 不为 NULL 时按剖析得到的进入次数安排函数的输出顺序
+} RiscvGenOptions;
+
+// 默认选项：rv32，开启调度、死代码删除、子运算吸收与超优化表，不压缩，使用默认延迟模型，不做剖析
+void riscv_gen_options_default(RiscvGenOptions *options);
+
+/**
+ * 由 SSA IR 生成 RISC-V 汇编代码，options 为 NULL 时使用默认选项
+ * 插桩时计数器按整个程序编号，须一次生成整个程序；开启死代码删除时就地改写 prog 中的函数
+ */
+void generate_riscv(FILE *output, SsaProgram *prog, const RiscvGenOptions *options);
+
+/**
+ * 将 raw program 导入为 SSA IR 后生成 RISC-V 汇编代码
+ * @return 成功返回 0，有后端不支持的值时返回 -1
+ */
+int generate_riscv_from_raw_program(FILE *output, koopa_raw_program_t raw, const RiscvGenOptions *options);
 
 #ifdef __cplusplus
 }
-#endif
\ No newline at end of file
+#endif
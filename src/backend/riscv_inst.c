@@ -0,0 +1,212 @@
+#include "riscv_inst.h"
+#include <assert.h>
+#include <stdlib.h>
+
+static const char *reg_names[RV_REG_COUNT] = {
+    "zero", "ra", "sp", "gp", "tp",
+    "t0", "t1", "t2",
+    "s0", "s1",
+    "a0", "a1", "a2", "a3", "a4", "a5", "a6", "a7",
+    "s2", "s3", "s4", "s5", "s6", "s7", "s8", "s9", "s10", "s11",
+    "t3", "t4", "t5", "t6",
+};
+
+static const RiscvOpInfo op_infos[RV_OP_COUNT] = {
+    [RV_OP_LI]    = {"li",    RV_FMT_RI,    RV_CLASS_ALU,    false, RV_OP_NONE},
+    [RV_OP_LUI]   = {"lui",   RV_FMT_RI,    RV_CLASS_ALU,    false, RV_OP_NONE},
+    [RV_OP_MV]    = {"mv",    RV_FMT_RR,    RV_CLASS_ALU,    false, RV_OP_NONE},
+    [RV_OP_ADDI]  = {"addi",  RV_FMT_RRI,   RV_CLASS_ALU,    false, RV_OP_ADDIW},
+    [RV_OP_SLTI]  = {"slti",  RV_FMT_RRI,   RV_CLASS_ALU,    false, RV_OP_NONE},
+    [RV_OP_XORI]  = {"xori",  RV_FMT_RRI,   RV_CLASS_ALU,    false, RV_OP_NONE},
+    [RV_OP_ANDI]  = {"andi",  RV_FMT_RRI,   RV_CLASS_ALU,    false, RV_OP_NONE},
+    [RV_OP_ORI]   = {"ori",   RV_FMT_RRI,   RV_CLASS_ALU,    false, RV_OP_NONE},
+    [RV_OP_SLLI]  = {"slli",  RV_FMT_RRI,   RV_CLASS_ALU,    false, RV_OP_SLLIW},
+    [RV_OP_SRLI]  = {"srli",  RV_FMT_RRI,   RV_CLASS_ALU,    false, RV_OP_SRLIW},
+    [RV_OP_SRAI]  = {"srai",  RV_FMT_RRI,   RV_CLASS_ALU,    false, RV_OP_SRAIW},
+    [RV_OP_LW]    = {"lw",    RV_FMT_LOAD,  RV_CLASS_LOAD,   false, RV_OP_NONE},
+    [RV_OP_SW]    = {"sw",    RV_FMT_STORE, RV_CLASS_STORE,  false, RV_OP_NONE},
+    [RV_OP_ADD]   = {"add",   RV_FMT_RRR,   RV_CLASS_ALU,    false, RV_OP_ADDW},
+    [RV_OP_SUB]   = {"sub",   RV_FMT_RRR,   RV_CLASS_ALU,    false, RV_OP_SUBW},
+    [RV_OP_MUL]   = {"mul",   RV_FMT_RRR,   RV_CLASS_MUL,    false, RV_OP_MULW},
+    [RV_OP_DIV]   = {"div",   RV_FMT_RRR,   RV_CLASS_DIV,    false, RV_OP_DIVW},
+    [RV_OP_REM]   = {"rem",   RV_FMT_RRR,   RV_CLASS_DIV,    false, RV_OP_REMW},
+    [RV_OP_SLT]   = {"slt",   RV_FMT_RRR,   RV_CLASS_ALU,    false, RV_OP_NONE},
+    [RV_OP_SGT]   = {"sgt",   RV_FMT_RRR,   RV_CLASS_ALU,    false, RV_OP_NONE},
+    [RV_OP_XOR]   = {"xor",   RV_FMT_RRR,   RV_CLASS_ALU,    false, RV_OP_NONE},
+    [RV_OP_AND]   = {"and",   RV_FMT_RRR,   RV_CLASS_ALU,    false, RV_OP_NONE},
+    [RV_OP_OR]    = {"or",    RV_FMT_RRR,   RV_CLASS_ALU,    false, RV_OP_NONE},
+    [RV_OP_SEQZ]  = {"seqz",  RV_FMT_RR,    RV_CLASS_ALU,    false, RV_OP_NONE},
+    [RV_OP_SNEZ]  = {"snez",  RV_FMT_RR,    RV_CLASS_ALU,    false, RV_OP_NONE},
+    [RV_OP_SLL]   = {"sll",   RV_FMT_RRR,   RV_CLASS_ALU,    false, RV_OP_SLLW},
+    [RV_OP_SRL]   = {"srl",   RV_FMT_RRR,   RV_CLASS_ALU,    false, RV_OP_SRLW},
+    [RV_OP_SRA]   = {"sra",   RV_FMT_RRR,   RV_CLASS_ALU,    false, RV_OP_SRAW},
+    [RV_OP_RET]   = {"ret",   RV_FMT_NONE,  RV_CLASS_BRANCH, true,  RV_OP_NONE},
+    [RV_OP_CALL]  = {"call",  RV_FMT_CALL,  RV_CLASS_BRANCH, true,  RV_OP_NONE},
+    [RV_OP_LA]    = {"la",    RV_FMT_ADDR,  RV_CLASS_ALU,    false, RV_OP_NONE},
+    [RV_OP_ADDW]  = {"addw",  RV_FMT_RRR,   RV_CLASS_ALU,    false, RV_OP_NONE},
+    [RV_OP_SUBW]  = {"subw",  RV_FMT_RRR,   RV_CLASS_ALU,    false, RV_OP_NONE},
+    [RV_OP_MULW]  = {"mulw",  RV_FMT_RRR,   RV_CLASS_MUL,    false, RV_OP_NONE},
+    [RV_OP_DIVW]  = {"divw",  RV_FMT_RRR,   RV_CLASS_DIV,    false, RV_OP_NONE},
+    [RV_OP_REMW]  = {"remw",  RV_FMT_RRR,   RV_CLASS_DIV,    false, RV_OP_NONE},
+    [RV_OP_ADDIW] = {"addiw", RV_FMT_RRI,   RV_CLASS_ALU,    false, RV_OP_NONE},
+    [RV_OP_SLLW]  = {"sllw",  RV_FMT_RRR,   RV_CLASS_ALU,    false, RV_OP_NONE},
+    [RV_OP_SRLW]  = {"srlw",  RV_FMT_RRR,   RV_CLASS_ALU,    false, RV_OP_NONE},
+    [RV_OP_SRAW]  = {"sraw",  RV_FMT_RRR,   RV_CLASS_ALU,    false, RV_OP_NONE},
+    [RV_OP_SLLIW] = {"slliw", RV_FMT_RRI,   RV_CLASS_ALU,    false, RV_OP_NONE},
+    [RV_OP_SRLIW] = {"srliw", RV_FMT_RRI,   RV_CLASS_ALU,    false, RV_OP_NONE},
+    [RV_OP_SRAIW] = {"sraiw", RV_FMT_RRI,   RV_CLASS_ALU,    false, RV_OP_NONE},
+    [RV_OP_LD]    = {"ld",    RV_FMT_LOAD,  RV_CLASS_LOAD,   false, RV_OP_NONE},
+    [RV_OP_SD]    = {"sd",    RV_FMT_STORE, RV_CLASS_STORE,  false, RV_OP_NONE},
+};
+
+const RiscvOpInfo *riscv_op_info(RiscvOpcode op) {
+    assert(op >= 0 && op < RV_OP_COUNT);
+    return &op_infos[op];
+}
+
+const char *riscv_reg_name(RiscvReg reg) {
+    assert(reg >= 0 && reg < RV_REG_COUNT);
+    return reg_names[reg];
+}
+
+void riscv_buffer_init(RiscvInstBuffer *buf) {
+    buf->insts = NULL;
+    buf->len = 0;
+    buf->cap = 0;
+}
+
+void riscv_buffer_free(RiscvInstBuffer *buf) {
+    free(buf->insts);
+    riscv_buffer_init(buf);
+}
+
+void riscv_buffer_clear(RiscvInstBuffer *buf) {
+    buf->len = 0;
+}
+
+void riscv_buffer_push(RiscvInstBuffer *buf, RiscvInst inst) {
+    if (buf->len == buf->cap) {
+        buf->cap = buf->cap ? buf->cap * 2 : 64;
+        buf->insts = realloc(buf->insts, buf->cap * sizeof(RiscvInst));
+        assert(buf->insts);
+    }
+    buf->insts[buf->len++] = inst;
+}
+
+void riscv_push_rrr(RiscvInstBuffer *buf, RiscvOpcode op, RiscvReg rd, RiscvReg rs1, RiscvReg rs2) {
+    RiscvInst inst = {op, rd, rs1, rs2, 0, -1};
+    riscv_buffer_push(buf, inst);
+}
+
+void riscv_push_rr(RiscvInstBuffer *buf, RiscvOpcode op, RiscvReg rd, RiscvReg rs1) {
+    RiscvInst inst = {op, rd, rs1, RV_REG_NONE, 0, -1};
+    riscv_buffer_push(buf, inst);
+}
+
+void riscv_push_ri(RiscvInstBuffer *buf, RiscvOpcode op, RiscvReg rd, int32_t imm) {
+    RiscvInst inst = {op, rd, RV_REG_NONE, RV_REG_NONE, imm, -1};
+    riscv_buffer_push(buf, inst);
+}
+
+void riscv_push_rri(RiscvInstBuffer *buf, RiscvOpcode op, RiscvReg rd, RiscvReg rs1, int32_t imm) {
+    RiscvInst inst = {op, rd, rs1, RV_REG_NONE, imm, -1};
+    riscv_buffer_push(buf, inst);
+}
+
+void riscv_push_op(RiscvInstBuffer *buf, RiscvOpcode op) {
+    RiscvInst inst = {op, RV_REG_NONE, RV_REG_NONE, RV_REG_NONE, 0, -1};
+    riscv_buffer_push(buf, inst);
+}
+
+void riscv_push_call(RiscvInstBuffer *buf, const char *symbol) {
+    RiscvInst inst = {RV_OP_CALL, RV_REG_NONE, RV_REG_NONE, RV_REG_NONE, 0, -1, symbol};
+    riscv_buffer_push(buf, inst);
+}
+
+void riscv_push_la(RiscvInstBuffer *buf, RiscvReg rd, const char *symbol, int32_t offset) {
+    RiscvInst inst = {RV_OP_LA, rd, RV_REG_NONE, RV_REG_NONE, offset, -1, symbol};
+    riscv_buffer_push(buf, inst);
+}
+
+void riscv_push_slot_load(RiscvInstBuffer *buf, RiscvReg rd, int slot) {
+    RiscvInst inst = {RV_OP_LW, rd, RV_REG_SP, RV_REG_NONE, 0, slot};
+    riscv_buffer_push(buf, inst);
+}
+
+void riscv_push_slot_store(RiscvInstBuffer *buf, RiscvReg rs, int slot, RiscvReg addr_scratch) {
+    RiscvInst inst = {RV_OP_SW, addr_scratch, RV_REG_SP, rs, 0, slot};
+    riscv_buffer_push(buf, inst);
+}
+
+bool riscv_imm12_fits(int32_t imm) {
+    return imm >= -2048 && imm <= 2047;
+}
+
+int riscv_inst_defs(const RiscvInst *inst, RiscvReg out[2]) {
+    int n = 0;
+    if (riscv_op_info(inst->op)->format == RV_FMT_STORE) return 0;
+    if (inst->op == RV_OP_CALL) {
+        out[n++] = RV_REG_RA;
+        out[n++] = RV_REG_A0;
+        return n;
+    }
+    if (inst->rd != RV_REG_NONE && inst->rd != RV_REG_ZERO) out[n++] = inst->rd;
+    return n;
+}
+
+int riscv_inst_uses(const RiscvInst *inst, RiscvReg out[3]) {
+    int n = 0;
+    if (inst->rs1 != RV_REG_NONE && inst->rs1 != RV_REG_ZERO) out[n++] = inst->rs1;
+    if (inst->rs2 != RV_REG_NONE && inst->rs2 != RV_REG_ZERO) out[n++] = inst->rs2;
+    // ret 隐式读取返回值寄存器
+    if (inst->op == RV_OP_RET) out[n++] = RV_REG_A0;
+    return n;
+}
+
+void riscv_emit_inst(FILE *output, const RiscvInst *inst) {
+    const RiscvOpInfo *info = riscv_op_info(inst->op);
+    switch (info->format) {
+        case RV_FMT_RRR:
+            fprintf(output, "  %s %s, %s, %s\n", info->name,
+                    riscv_reg_name(inst->rd), riscv_reg_name(inst->rs1), riscv_reg_name(inst->rs2));
+            break;
+        case RV_FMT_RR:
+            fprintf(output, "  %s %s, %s\n", info->name,
+                    riscv_reg_name(inst->rd), riscv_reg_name(inst->rs1));
+            break;
+        case RV_FMT_RI:
+            fprintf(output, "  %s %s, %d\n", info->name, riscv_reg_name(inst->rd), inst->imm);
+            break;
+        case RV_FMT_RRI:
+            fprintf(output, "  %s %s, %s, %d\n", info->name,
+                    riscv_reg_name(inst->rd), riscv_reg_name(inst->rs1), inst->imm);
+            break;
+        case RV_FMT_LOAD:
+            fprintf(output, "  %s %s, %d(%s)\n", info->name,
+                    riscv_reg_name(inst->rd), inst->imm, riscv_reg_name(inst->rs1));
+            break;
+        case RV_FMT_STORE:
+            fprintf(output, "  %s %s, %d(%s)\n", info->name,
+                    riscv_reg_name(inst->rs2), inst->imm, riscv_reg_name(inst->rs1));
+            break;
+        case RV_FMT_NONE:
+            fprintf(output, "  %s\n", info->name);
+            break;
+        case RV_FMT_CALL:
+            fprintf(output, "  %s %s\n", info->name, inst->symbol);
+            break;
+        case RV_FMT_ADDR:
+            if (inst->imm != 0) {
+                fprintf(output, "  %s %s, %s%+d\n", info->name, riscv_reg_name(inst->rd), inst->symbol, inst->imm);
+            } else {
+                fprintf(output, "  %s %s, %s\n", info->name, riscv_reg_name(inst->rd), inst->symbol);
+            }
+            break;
+    }
+}
+
+void riscv_emit_buffer(FILE *output, const RiscvInstBuffer *buf) {
+    for (int i = 0; i < buf->len; i++) {
+        riscv_emit_inst(output, &buf->insts[i]);
+    }
+}
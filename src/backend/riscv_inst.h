@@ -0,0 +1,177 @@
+#pragma once
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// 物理寄存器，编号即 x0 ~ x31
+typedef enum {
+    RV_REG_ZERO, RV_REG_RA, RV_REG_SP, RV_REG_GP, RV_REG_TP,
+    RV_REG_T0, RV_REG_T1, RV_REG_T2,
+    RV_REG_S0, RV_REG_S1,
+    RV_REG_A0, RV_REG_A1, RV_REG_A2, RV_REG_A3, RV_REG_A4, RV_REG_A5, RV_REG_A6, RV_REG_A7,
+    RV_REG_S2, RV_REG_S3, RV_REG_S4, RV_REG_S5, RV_REG_S6, RV_REG_S7,
+    RV_REG_S8, RV_REG_S9, RV_REG_S10, RV_REG_S11,
+    RV_REG_T3, RV_REG_T4, RV_REG_T5, RV_REG_T6,
+    RV_REG_COUNT,
+    RV_REG_NONE = -1
+} RiscvReg;
+
+// 机器指令操作码
+typedef enum {
+    RV_OP_LI,
+    RV_OP_LUI,
+    RV_OP_MV,
+    RV_OP_ADDI,
+    RV_OP_SLTI,
+    RV_OP_XORI,
+    RV_OP_ANDI,
+    RV_OP_ORI,
+    RV_OP_SLLI,
+    RV_OP_SRLI,
+    RV_OP_SRAI,
+    RV_OP_LW,
+    RV_OP_SW,
+    RV_OP_ADD,
+    RV_OP_SUB,
+    RV_OP_MUL,
+    RV_OP_DIV,
+    RV_OP_REM,
+    RV_OP_SLT,
+    RV_OP_SGT,
+    RV_OP_XOR,
+    RV_OP_AND,
+    RV_OP_OR,
+    RV_OP_SEQZ,
+    RV_OP_SNEZ,
+    RV_OP_SLL,
+    RV_OP_SRL,
+    RV_OP_SRA,
+    RV_OP_RET,
+    RV_OP_CALL,
+    RV_OP_LA,
+    // RV64 的 32 位运算与整寄存器访存
+    RV_OP_ADDW,
+    RV_OP_SUBW,
+    RV_OP_MULW,
+    RV_OP_DIVW,
+    RV_OP_REMW,
+    RV_OP_ADDIW,
+    RV_OP_SLLW,
+    RV_OP_SRLW,
+    RV_OP_SRAW,
+    RV_OP_SLLIW,
+    RV_OP_SRLIW,
+    RV_OP_SRAIW,
+    RV_OP_LD,
+    RV_OP_SD,
+    RV_OP_COUNT,
+    RV_OP_NONE = -1
+} RiscvOpcode;
+
+// 汇编格式
+typedef enum {
+    RV_FMT_RRR,   // op rd, rs1, rs2
+    RV_FMT_RR,    // op rd, rs1
+    RV_FMT_RI,    // op rd, imm
+    RV_FMT_RRI,   // op rd, rs1, imm
+    RV_FMT_LOAD,  // op rd, imm(rs1)
+    RV_FMT_STORE, // op rs2, imm(rs1)
+    RV_FMT_NONE,  // op
+    RV_FMT_CALL,  // op symbol
+    RV_FMT_ADDR,  // op rd, symbol+imm
+} RiscvFormat;
+
+// 指令类别，决定延迟模型中的延迟
+typedef enum {
+    RV_CLASS_ALU,
+    RV_CLASS_MUL,
+    RV_CLASS_DIV,
+    RV_CLASS_LOAD,
+    RV_CLASS_STORE,
+    RV_CLASS_BRANCH,
+    RV_CLASS_COUNT
+} RiscvInstClass;
+
+typedef struct {
+    const char *name;     // 助记符
+    RiscvFormat format;   // 汇编格式
+    RiscvInstClass cls;   // 指令类别
+    bool barrier;         // 调度时不可跨越（控制流转移）
+    RiscvOpcode word_op;  // RV64 上对 32 位值运算时改用的 *w 指令，没有则为 RV_OP_NONE
+} RiscvOpInfo;
+
+/**
+ * 机器指令
+ * 未使用的寄存器字段为 RV_REG_NONE
+ * frame_slot >= 0 表示栈帧布局确定前的栈槽访问（lw/sw），imm 为槽内偏移，
+ * 由 riscv_frame_lower 改写为相对 sp 的实际偏移；此时 sw 的 rd 暂存大偏移寻址用的临时寄存器
+ * symbol 为 call 的目标函数名或 la 装入地址的符号（imm 为相对符号的偏移），其余指令为 NULL
+ */
+typedef struct {
+    RiscvOpcode op;
+    RiscvReg rd;
+    RiscvReg rs1;
+    RiscvReg rs2;
+    int32_t imm;
+    int32_t frame_slot;
+    const char *symbol;
+} RiscvInst;
+
+/**
+ * 一个基本块的机器指令序列
+ */
+typedef struct {
+    RiscvInst *insts;
+    int len;
+    int cap;
+} RiscvInstBuffer;
+
+// 获取操作码信息
+const RiscvOpInfo *riscv_op_info(RiscvOpcode op);
+
+// 获取寄存器的 ABI 名称
+const char *riscv_reg_name(RiscvReg reg);
+
+void riscv_buffer_init(RiscvInstBuffer *buf);
+void riscv_buffer_free(RiscvInstBuffer *buf);
+void riscv_buffer_clear(RiscvInstBuffer *buf);
+void riscv_buffer_push(RiscvInstBuffer *buf, RiscvInst inst);
+
+// 便捷构造：按格式追加一条指令
+void riscv_push_rrr(RiscvInstBuffer *buf, RiscvOpcode op, RiscvReg rd, RiscvReg rs1, RiscvReg rs2);
+void riscv_push_rr(RiscvInstBuffer *buf, RiscvOpcode op, RiscvReg rd, RiscvReg rs1);
+void riscv_push_ri(RiscvInstBuffer *buf, RiscvOpcode op, RiscvReg rd, int32_t imm);
+void riscv_push_rri(RiscvInstBuffer *buf, RiscvOpcode op, RiscvReg rd, RiscvReg rs1, int32_t imm);
+void riscv_push_op(RiscvInstBuffer *buf, RiscvOpcode op);
+void riscv_push_call(RiscvInstBuffer *buf, const char *symbol);
+void riscv_push_la(RiscvInstBuffer *buf, RiscvReg rd, const char *symbol, int32_t offset);
+
+// 栈槽访问：从栈槽 slot 读入 rd / 将 rs 写入栈槽 slot（addr_scratch 用于偏移超出 12 位立即数时计算地址）
+void riscv_push_slot_load(RiscvInstBuffer *buf, RiscvReg rd, int slot);
+void riscv_push_slot_store(RiscvInstBuffer *buf, RiscvReg rs, int slot, RiscvReg addr_scratch);
+
+// 立即数是否可以直接编码进 12 位有符号立即数字段
+bool riscv_imm12_fits(int32_t imm);
+
+/**
+ * 获取指令写入 / 读取的寄存器（包括隐式操作数，如 ret 读取 a0、call 写入 ra 与 a0）
+ * call 读取的参数寄存器不在其中，调度时 call 作为屏障不与任何指令交换顺序
+ * @return 寄存器个数
+ */
+int riscv_inst_defs(const RiscvInst *inst, RiscvReg out[2]);
+int riscv_inst_uses(const RiscvInst *inst, RiscvReg out[3]);
+
+// 输出一条指令的汇编文本
+void riscv_emit_inst(FILE *output, const RiscvInst *inst);
+
+// 输出整个缓冲区
+void riscv_emit_buffer(FILE *output, const RiscvInstBuffer *buf);
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,306 @@
+#include "riscv_isel.h"
+#include <assert.h>
+#include <stdlib.h>
+
+// 常量模式：右操作数须为何种常量，以及写入立即数字段的值
+typedef enum {
+    RHS_REG,            // 任意值（常量装入寄存器）
+    RHS_ZERO,           // 常量 0，不占用操作数
+    RHS_IMM12,          // c 可放入 12 位立即数
+    RHS_IMM12_PLUS1,    // c + 1 可放入 12 位立即数
+    RHS_IMM12_NEG,      // -c 可放入 12 位立即数
+    RHS_SHAMT,          // 0 <= c < 32，作为移位量
+    RHS_POW2,           // c 为 2 的正整数次幂，立即数为其指数
+} RhsShape;
+
+/**
+ * 模式表：运算 op 在右操作数满足 rhs 时可由 inst（及其后的 post）实现
+ * 代价为指令条数加上操作数中常量的装入代价，同一运算的多个模式中取代价最小者
+ */
+typedef struct {
+    SsaOp op;
+    RhsShape rhs;
+    RiscvOpcode inst;
+    RiscvOpcode post;
+} Pattern;
+
+static const Pattern patterns[] = {
+    {SSA_ADD,    RHS_REG,         RV_OP_ADD,  RV_OP_NONE},
+    {SSA_ADD,    RHS_IMM12,       RV_OP_ADDI, RV_OP_NONE},
+    {SSA_SUB,    RHS_REG,         RV_OP_SUB,  RV_OP_NONE},
+    {SSA_SUB,    RHS_IMM12_NEG,   RV_OP_ADDI, RV_OP_NONE},
+    {SSA_MUL,    RHS_REG,         RV_OP_MUL,  RV_OP_NONE},
+    {SSA_MUL,    RHS_POW2,        RV_OP_SLLI, RV_OP_NONE},
+    {SSA_DIV,    RHS_REG,         RV_OP_DIV,  RV_OP_NONE},
+    {SSA_MOD,    RHS_REG,         RV_OP_REM,  RV_OP_NONE},
+    {SSA_AND,    RHS_REG,         RV_OP_AND,  RV_OP_NONE},
+    {SSA_AND,    RHS_IMM12,       RV_OP_ANDI, RV_OP_NONE},
+    {SSA_OR,     RHS_REG,         RV_OP_OR,   RV_OP_NONE},
+    {SSA_OR,     RHS_IMM12,       RV_OP_ORI,  RV_OP_NONE},
+    {SSA_XOR,    RHS_REG,         RV_OP_XOR,  RV_OP_NONE},
+    {SSA_XOR,    RHS_IMM12,       RV_OP_XORI, RV_OP_NONE},
+    {SSA_SHL,    RHS_REG,         RV_OP_SLL,  RV_OP_NONE},
+    {SSA_SHL,    RHS_SHAMT,       RV_OP_SLLI, RV_OP_NONE},
+    {SSA_SHR,    RHS_REG,         RV_OP_SRL,  RV_OP_NONE},
+    {SSA_SHR,    RHS_SHAMT,       RV_OP_SRLI, RV_OP_NONE},
+    {SSA_SAR,    RHS_REG,         RV_OP_SRA,  RV_OP_NONE},
+    {SSA_SAR,    RHS_SHAMT,       RV_OP_SRAI, RV_OP_NONE},
+    {SSA_LT,     RHS_REG,         RV_OP_SLT,  RV_OP_NONE},
+    {SSA_LT,     RHS_IMM12,       RV_OP_SLTI, RV_OP_NONE},
+    {SSA_GT,     RHS_REG,         RV_OP_SGT,  RV_OP_NONE},
+    {SSA_GT,     RHS_IMM12_PLUS1, RV_OP_SLTI, RV_OP_SEQZ},    // x > c ⇔ !(x < c + 1)
+    {SSA_LE,     RHS_REG,         RV_OP_SGT,  RV_OP_SEQZ},
+    {SSA_LE,     RHS_IMM12_PLUS1, RV_OP_SLTI, RV_OP_NONE},    // x <= c ⇔ x < c + 1
+    {SSA_GE,     RHS_REG,         RV_OP_SLT,  RV_OP_SEQZ},
+    {SSA_GE,     RHS_IMM12,       RV_OP_SLTI, RV_OP_SEQZ},
+    {SSA_EQ,     RHS_ZERO,        RV_OP_SEQZ, RV_OP_NONE},    // seqz 即 sltiu rd, x, 1
+    {SSA_EQ,     RHS_REG,         RV_OP_XOR,  RV_OP_SEQZ},
+    {SSA_EQ,     RHS_IMM12,       RV_OP_XORI, RV_OP_SEQZ},
+    {SSA_NE, RHS_ZERO,        RV_OP_SNEZ, RV_OP_NONE},
+    {SSA_NE, RHS_REG,         RV_OP_XOR,  RV_OP_SNEZ},
+    {SSA_NE, RHS_IMM12,       RV_OP_XORI, RV_OP_SNEZ},
+};
+#define PATTERN_COUNT ((int)(sizeof(patterns) / sizeof(patterns[0])))
+
+/**
+ * 交换操作数后的等价运算：可交换运算为其自身，比较运算为反方向的比较
+ * @return 不能交换时返回 false
+ */
+static bool mirror_op(SsaOp op, SsaOp *out) {
+    switch (op) {
+        case SSA_ADD: case SSA_MUL: case SSA_AND: case SSA_OR:
+        case SSA_XOR: case SSA_EQ: case SSA_NE:
+            *out = op;
+            return true;
+        case SSA_LT: *out = SSA_GT; return true;
+        case SSA_GT: *out = SSA_LT; return true;
+        case SSA_LE: *out = SSA_GE; return true;
+        case SSA_GE: *out = SSA_LE; return true;
+        default: return false;
+    }
+}
+
+// 比较运算取反后的运算
+static bool invert_compare(SsaOp op, SsaOp *out) {
+    switch (op) {
+        case SSA_LT: *out = SSA_GE; return true;
+        case SSA_GE: *out = SSA_LT; return true;
+        case SSA_GT: *out = SSA_LE; return true;
+        case SSA_LE: *out = SSA_GT; return true;
+        case SSA_EQ: *out = SSA_NE; return true;
+        case SSA_NE: *out = SSA_EQ; return true;
+        default: return false;
+    }
+}
+
+static bool is_const(const SsaFunction *func, SsaValueId value, int32_t *out) {
+    if (func->values[value].op != SSA_CONST) return false;
+    *out = func->values[value].imm;
+    return true;
+}
+
+int riscv_const_cost(int32_t value) {
+    if (value == 0) return 0;
+    if (riscv_imm12_fits(value)) return 1;
+    return (value & 0xfff) == 0 ? 1 : 2;
+}
+
+// 操作数的装入代价：常量按 riscv_const_cost 计，其余值已在寄存器中
+static int operand_cost(const SsaFunction *func, SsaValueId value) {
+    int32_t c;
+    return is_const(func, value, &c) ? riscv_const_cost(c) : 0;
+}
+
+// 右操作数是否满足常量模式，满足时写出立即数
+static bool match_rhs(const SsaFunction *func, RhsShape shape, SsaValueId rhs, int32_t *imm) {
+    int32_t c;
+    if (shape == RHS_REG) return true;
+    if (!is_const(func, rhs, &c)) return false;
+    switch (shape) {
+        case RHS_ZERO:
+            *imm = 0;
+            return c == 0;
+        case RHS_IMM12:
+            *imm = c;
+            return riscv_imm12_fits(c);
+        case RHS_IMM12_PLUS1:
+            if (c == INT32_MAX) return false;
+            *imm = c + 1;
+            return riscv_imm12_fits(*imm);
+        case RHS_IMM12_NEG:
+            if (c == INT32_MIN) return false;
+            *imm = -c;
+            return riscv_imm12_fits(*imm);
+        case RHS_SHAMT:
+            *imm = c;
+            return c >= 0 && c < 32;
+        case RHS_POW2:
+            if (c <= 0 || (c & (c - 1)) != 0) return false;
+            *imm = __builtin_ctz((uint32_t)c);
+            return true;
+        default:
+            return false;
+    }
+}
+
+/**
+ * 在模式表中为 lhs op rhs 选择代价最小的覆盖（含交换操作数后的等价形式）
+ * 开启查表且右操作数为常量时，超优化表中的序列严格更便宜才取代模式表的结果
+ */
+static RiscvTile select_op(const RiscvIsel *isel, SsaOp op, SsaValueId lhs, SsaValueId rhs) {
+    const SsaFunction *func = isel->info->func;
+    RiscvTile best = {RV_OP_NONE, SSA_NONE, SSA_NONE, 0, RV_OP_NONE, 0, -1, NULL};
+    SsaOp ops[2] = {op, op};
+    SsaValueId lhss[2] = {lhs, rhs}, rhss[2] = {rhs, lhs};
+    int orientations = mirror_op(op, &ops[1]) ? 2 : 1;
+
+    for (int o = 0; o < orientations; o++) {
+        for (int i = 0; i < PATTERN_COUNT; i++) {
+            const Pattern *p = &patterns[i];
+            int32_t imm = 0;
+            if (p->op != ops[o] || !match_rhs(func, p->rhs, rhss[o], &imm)) continue;
+            RiscvFormat format = riscv_op_info(p->inst)->format;
+            int cost = 1 + (p->post != RV_OP_NONE) + operand_cost(func, lhss[o]);
+            if (format == RV_FMT_RRR) cost += operand_cost(func, rhss[o]);
+            if (best.op != RV_OP_NONE && cost >= best.cost) continue;
+            best.op = p->inst;
+            best.lhs = lhss[o];
+            best.rhs = format == RV_FMT_RRR ? rhss[o] : SSA_NONE;
+            best.imm = imm;
+            best.post = p->post;
+            best.cost = cost;
+        }
+    }
+    for (int o = 0; isel->superopt && o < orientations; o++) {
+        int32_t c;
+        const SuperoptEntry *entry = is_const(func, rhss[o], &c) ? riscv_superopt_lookup(ops[o], c) : NULL;
+        if (!entry) continue;
+        int cost = entry->length + operand_cost(func, lhss[o]);
+        if (best.op != RV_OP_NONE && cost >= best.cost) continue;
+        best = (RiscvTile){entry->insts[entry->length - 1].op, lhss[o], SSA_NONE, 0, RV_OP_NONE, cost, -1, entry};
+    }
+    assert(best.op != RV_OP_NONE && "no pattern covers binary operator");
+    return best;
+}
+
+/**
+ * 值是否为可被使用者吸收的运算：单次使用、位于同一块、已选择覆盖且自身未吸收其他指令
+ * 与使用者之间隔着调用时不吸收，否则其操作数会被推迟到调用之后读取，而寄存器分配并不知道它们跨越了调用
+ */
+static bool foldable(const RiscvIsel *isel, SsaValueId value, int block) {
+    if (!ssa_is_binary(&isel->info->func->values[value])) return false;
+    int id = dataflow_value_id(isel->info, value);
+    if (id < 0 || !isel->selected[id] || isel->block_of[id] != block) return false;
+    if (isel->index_of[id] < isel->last_call) return false;
+    return isel->info->use_count[id] == 1 && isel->tiles[id].folded < 0;
+}
+
+static bool is_negation(const SsaFunction *func, SsaValueId value, SsaValueId *operand) {
+    const SsaValueId *ops = ssa_operands(func, value);
+    int32_t c;
+    if (func->values[value].op != SSA_SUB || !is_const(func, ops[0], &c) || c != 0) return false;
+    *operand = ops[1];
+    return true;
+}
+
+/**
+ * 吸收单次使用的子运算后的覆盖
+ * 与 0 判等 / 判不等的比较结果改为直接比较（eq 时比较取反），加减一个取负的值改为减加
+ * @return 无可用的吸收形式时返回 false
+ */
+static bool select_folded(const RiscvIsel *isel, SsaValueId inst, int block, SsaValueId *child, RiscvTile *out) {
+    const SsaFunction *func = isel->info->func;
+    SsaOp op = (SsaOp)func->values[inst].op;
+    SsaValueId lhs = ssa_operands(func, inst)[0], rhs = ssa_operands(func, inst)[1];
+    int32_t c;
+    if (op == SSA_EQ || op == SSA_NE) {
+        SsaValueId other = SSA_NONE;
+        if (is_const(func, rhs, &c) && c == 0) other = lhs;
+        else if (is_const(func, lhs, &c) && c == 0) other = rhs;
+        if (other == SSA_NONE || !foldable(isel, other, block)) return false;
+        SsaOp inner = (SsaOp)func->values[other].op, inverted;
+        if (!invert_compare(inner, &inverted)) return false;
+        const SsaValueId *inner_ops = ssa_operands(func, other);
+        *child = other;
+        *out = select_op(isel, op == SSA_EQ ? inverted : inner, inner_ops[0], inner_ops[1]);
+        return true;
+    }
+    if (op == SSA_ADD || op == SSA_SUB) {
+        SsaValueId negated, other;
+        if (foldable(isel, rhs, block) && is_negation(func, rhs, &negated)) {
+            *child = rhs;
+            other = lhs;
+        } else if (op == SSA_ADD && foldable(isel, lhs, block) && is_negation(func, lhs, &negated)) {
+            *child = lhs;
+            other = rhs;
+        } else {
+            return false;
+        }
+        *out = select_op(isel, op == SSA_ADD ? SSA_SUB : SSA_ADD, other, negated);
+        return true;
+    }
+    return false;
+}
+
+void riscv_isel_init(RiscvIsel *isel, const DataflowInfo *info, bool fold, bool superopt) {
+    int n = info->value_count ? info->value_count : 1;
+    isel->info = info;
+    isel->fold = fold;
+    isel->superopt = superopt;
+    isel->tiles = calloc(n, sizeof(RiscvTile));
+    isel->selected = calloc(n, sizeof(bool));
+    isel->covered = calloc(n, sizeof(bool));
+    isel->block_of = calloc(n, sizeof(int));
+    isel->index_of = calloc(n, sizeof(int));
+    assert(isel->tiles && isel->selected && isel->covered && isel->block_of && isel->index_of);
+}
+
+void riscv_isel_free(RiscvIsel *isel) {
+    free(isel->tiles);
+    free(isel->selected);
+    free(isel->covered);
+    free(isel->block_of);
+    free(isel->index_of);
+    isel->tiles = NULL;
+    isel->selected = isel->covered = NULL;
+    isel->block_of = isel->index_of = NULL;
+}
+
+void riscv_isel_select_block(RiscvIsel *isel, int block) {
+    const SsaFunction *func = isel->info->func;
+    isel->last_call = -1;
+    for (uint32_t i = 0; i < func->blocks[block].inst_count; ++i) {
+        SsaValueId id = ssa_block_inst(func, block, i);
+        const SsaValue *value = &func->values[id];
+        if (value->op == SSA_CALL) isel->last_call = (int) i;
+        if (!ssa_is_binary(value)) continue;
+        const SsaValueId *ops = ssa_operands(func, id);
+
+        RiscvTile tile = select_op(isel, (SsaOp)value->op, ops[0], ops[1]);
+        SsaValueId child;
+        RiscvTile fused;
+        if (isel->fold && select_folded(isel, id, block, &child, &fused)) {
+            // 吸收后的覆盖须比「子运算单独生成 + 使用者以寄存器读取」更便宜
+            if (fused.cost < tile.cost + isel->tiles[child].cost) {
+                fused.folded = isel->index_of[child];
+                isel->covered[child] = true;
+                tile = fused;
+            }
+        }
+
+        isel->tiles[id] = tile;
+        isel->selected[id] = true;
+        isel->block_of[id] = block;
+        isel->index_of[id] = (int) i;
+    }
+}
+
+const RiscvTile *riscv_isel_tile(const RiscvIsel *isel, SsaValueId value) {
+    int id = dataflow_value_id(isel->info, value);
+    return id >= 0 && isel->selected[id] ? &isel->tiles[id] : NULL;
+}
+
+bool riscv_isel_covered(const RiscvIsel *isel, SsaValueId value) {
+    int id = dataflow_value_id(isel->info, value);
+    return id >= 0 && isel->covered[id];
+}
@@ -0,0 +1,66 @@
+#pragma once
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "riscv_inst.h"
+#include "riscv_superopt.h"
+#include "dataflow.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * 一个覆盖（tile）：一条二元运算，连同被它吸收的单次使用的子运算，所对应的机器指令模板
+ * op 的格式决定操作数：RRR 使用 lhs、rhs，RRI 使用 lhs 与 imm，RR 只使用 lhs；常量操作数在使用时装入
+ * post 不为 RV_OP_NONE 时再对结果执行一次（seqz / snez）
+ * seq 不为 NULL 时改为生成超优化表中 lhs op k 的指令序列，op 为其最后一条指令
+ */
+typedef struct {
+    RiscvOpcode op;
+    SsaValueId lhs;
+    SsaValueId rhs;     // 不使用时为 SSA_NONE
+    int32_t imm;
+    RiscvOpcode post;
+    int cost;           // 估计的指令条数，含常量装入
+    int folded;         // 被吸收的指令在块内的下标，没有则为 -1
+    const SuperoptEntry *seq;
+} RiscvTile;
+
+/**
+ * 一个函数的指令选择结果，按 SSA 值编号索引
+ */
+typedef struct {
+    const DataflowInfo *info;
+    RiscvTile *tiles;
+    bool *selected;     // 已为其选择覆盖
+    bool *covered;      // 已被使用者的覆盖吸收，不单独生成代码
+    int *block_of;      // 所在基本块下标
+    int *index_of;      // 块内下标
+    int last_call;      // 当前块中最近一条调用指令的下标，没有则为 -1
+    bool fold;          // 是否吸收子运算；为 false 时每条运算单独选择覆盖
+    bool superopt;      // 常量右操作数的运算是否查超优化表
+} RiscvIsel;
+
+void riscv_isel_init(RiscvIsel *isel, const DataflowInfo *info, bool fold, bool superopt);
+void riscv_isel_free(RiscvIsel *isel);
+
+/**
+ * 为基本块中的二元运算选择覆盖
+ * 按指令顺序自底向上计算每个值的最小代价覆盖，开启查表时右操作数为常量的运算另与超优化表中的序列比较；开启吸收时，单次使用、同块、与使用者之间没有调用且自身未吸收
+ * 其他指令的子运算在吸收后总代价更低时并入使用者的覆盖
+ */
+void riscv_isel_select_block(RiscvIsel *isel, int block);
+
+// 值的覆盖，未选择时返回 NULL
+const RiscvTile *riscv_isel_tile(const RiscvIsel *isel, SsaValueId value);
+
+// 值是否已被使用者的覆盖吸收
+bool riscv_isel_covered(const RiscvIsel *isel, SsaValueId value);
+
+// 将常量装入寄存器所需的指令数：0 为 x0，12 位立即数为 li，其余为 lui + addi
+int riscv_const_cost(int32_t value);
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,272 @@
+#include "riscv_sched.h"
+#include <assert.h>
+#include <stdlib.h>
+#include <string.h>
+
+static const char *class_names[RV_CLASS_COUNT] = {
+    [RV_CLASS_ALU] = "alu",
+    [RV_CLASS_MUL] = "mul",
+    [RV_CLASS_DIV] = "div",
+    [RV_CLASS_LOAD] = "load",
+    [RV_CLASS_STORE] = "store",
+    [RV_CLASS_BRANCH] = "branch",
+};
+
+void riscv_latency_default(RiscvLatencyModel *model) {
+    model->latency[RV_CLASS_ALU] = 1;
+    model->latency[RV_CLASS_MUL] = 3;
+    model->latency[RV_CLASS_DIV] = 16;
+    model->latency[RV_CLASS_LOAD] = 3;
+    model->latency[RV_CLASS_STORE] = 1;
+    model->latency[RV_CLASS_BRANCH] = 1;
+}
+
+int riscv_latency_parse(RiscvLatencyModel *model, const char *spec) {
+    const char *p = spec;
+    while (*p) {
+        const char *eq = strchr(p, '=');
+        if (!eq) return -1;
+        int cls = -1;
+        for (int i = 0; i < RV_CLASS_COUNT; i++) {
+            size_t n = strlen(class_names[i]);
+            if ((size_t)(eq - p) == n && strncmp(p, class_names[i], n) == 0) cls = i;
+        }
+        char *end = NULL;
+        long value = strtol(eq + 1, &end, 10);
+        if (cls < 0 || end == eq + 1 || value < 1) return -1;
+        model->latency[cls] = (int)value;
+        if (*end == ',') end++;
+        else if (*end != '\0') return -1;
+        p = end;
+    }
+    return 0;
+}
+
+static int inst_latency(const RiscvInst *inst, const RiscvLatencyModel *model) {
+    return model->latency[riscv_op_info(inst->op)->cls];
+}
+
+// ========================================
+// 依赖图
+// ========================================
+
+typedef struct {
+    int to;
+    int delay;  // 后继最早可在前驱发射后多少周期发射
+} DepEdge;
+
+typedef struct {
+    DepEdge *edges;
+    int len;
+    int cap;
+} EdgeList;
+
+typedef struct {
+    int n;
+    EdgeList *succs;
+    int *pred_count;
+} DepGraph;
+
+// 允许重复边：入度与边一一对应，调度时逐条递减即可
+static void add_edge(DepGraph *g, int from, int to, int delay) {
+    EdgeList *list = &g->succs[from];
+    if (list->len == list->cap) {
+        list->cap = list->cap ? list->cap * 2 : 4;
+        list->edges = realloc(list->edges, list->cap * sizeof(DepEdge));
+        assert(list->edges);
+    }
+    list->edges[list->len].to = to;
+    list->edges[list->len].delay = delay;
+    list->len++;
+    g->pred_count[to]++;
+}
+
+// 寄存器上自上次写入以来的读者
+typedef struct {
+    int *readers;
+    int len;
+    int cap;
+} ReaderList;
+
+static void reader_push(ReaderList *list, int idx) {
+    if (list->len == list->cap) {
+        list->cap = list->cap ? list->cap * 2 : 4;
+        list->readers = realloc(list->readers, list->cap * sizeof(int));
+        assert(list->readers);
+    }
+    list->readers[list->len++] = idx;
+}
+
+// 内存视为一个额外的伪寄存器：load 读取它，store 写入它
+#define MEM_RESOURCE RV_REG_COUNT
+#define RESOURCE_COUNT (RV_REG_COUNT + 1)
+
+static void build_graph(DepGraph *g, const RiscvInst *insts, int n, const RiscvLatencyModel *model) {
+    g->n = n;
+    g->succs = calloc(n, sizeof(EdgeList));
+    g->pred_count = calloc(n, sizeof(int));
+
+    int last_def[RESOURCE_COUNT];
+    ReaderList readers[RESOURCE_COUNT];
+    for (int r = 0; r < RESOURCE_COUNT; r++) last_def[r] = -1;
+    memset(readers, 0, sizeof(readers));
+    int last_barrier = -1;
+
+    for (int i = 0; i < n; i++) {
+        const RiscvInst *inst = &insts[i];
+        int uses[4], defs[3];
+        RiscvReg reg_uses[3], reg_defs[2];
+        int nuses = riscv_inst_uses(inst, reg_uses);
+        int ndefs = riscv_inst_defs(inst, reg_defs);
+        for (int k = 0; k < nuses; k++) uses[k] = reg_uses[k];
+        for (int k = 0; k < ndefs; k++) defs[k] = reg_defs[k];
+        RiscvInstClass cls = riscv_op_info(inst->op)->cls;
+        if (cls == RV_CLASS_LOAD) uses[nuses++] = MEM_RESOURCE;
+        if (cls == RV_CLASS_STORE) defs[ndefs++] = MEM_RESOURCE;
+
+        // 控制流屏障：之前的所有指令必须在其之前，之后的所有指令必须在其之后
+        if (riscv_op_info(inst->op)->barrier) {
+            for (int j = last_barrier + 1; j < i; j++) add_edge(g, j, i, 1);
+        }
+        if (last_barrier >= 0) add_edge(g, last_barrier, i, 1);
+
+        // RAW：等待前驱结果产生
+        for (int k = 0; k < nuses; k++) {
+            int def = last_def[uses[k]];
+            if (def >= 0) add_edge(g, def, i, inst_latency(&insts[def], model));
+        }
+        for (int k = 0; k < ndefs; k++) {
+            int r = defs[k];
+            // WAW：写回顺序不能颠倒
+            if (last_def[r] >= 0) add_edge(g, last_def[r], i, inst_latency(&insts[last_def[r]], model));
+            // WAR：读者必须先于新的写入发射
+            for (int j = 0; j < readers[r].len; j++) {
+                if (readers[r].readers[j] != i) add_edge(g, readers[r].readers[j], i, 1);
+            }
+            readers[r].len = 0;
+            last_def[r] = i;
+        }
+        for (int k = 0; k < nuses; k++) {
+            // 同一条指令先读后写同一寄存器时，读者记录在写入之前已被清空，无需再记
+            bool redefined = false;
+            for (int d = 0; d < ndefs; d++) redefined |= defs[d] == uses[k];
+            if (!redefined) reader_push(&readers[uses[k]], i);
+        }
+
+        if (riscv_op_info(inst->op)->barrier) last_barrier = i;
+    }
+
+    for (int r = 0; r < RESOURCE_COUNT; r++) free(readers[r].readers);
+}
+
+static void free_graph(DepGraph *g) {
+    for (int i = 0; i < g->n; i++) free(g->succs[i].edges);
+    free(g->succs);
+    free(g->pred_count);
+}
+
+// ========================================
+// 周期估算与调度
+// ========================================
+
+int riscv_modeled_cycles(const RiscvInst *insts, int len, const RiscvLatencyModel *model) {
+    if (len == 0) return 0;
+    DepGraph g;
+    build_graph(&g, insts, len, model);
+
+    // 顺序单发射：每周期最多发射一条，且须等待所有依赖满足
+    int *earliest = calloc(len, sizeof(int));
+    int cycle = 0, finish = 0;
+    for (int i = 0; i < len; i++) {
+        int issue = earliest[i] > cycle ? earliest[i] : cycle;
+        for (int k = 0; k < g.succs[i].len; k++) {
+            DepEdge e = g.succs[i].edges[k];
+            if (issue + e.delay > earliest[e.to]) earliest[e.to] = issue + e.delay;
+        }
+        int done = issue + inst_latency(&insts[i], model);
+        if (done > finish) finish = done;
+        cycle = issue + 1;
+    }
+
+    free(earliest);
+    free_graph(&g);
+    return finish;
+}
+
+void riscv_schedule_block(RiscvInstBuffer *buf, const RiscvLatencyModel *model) {
+    int n = buf->len;
+    if (n <= 2) return;
+
+    DepGraph g;
+    build_graph(&g, buf->insts, n, model);
+
+    // 优先级：到块尾的最长延迟路径（关键路径）
+    int *priority = malloc(n * sizeof(int));
+    for (int i = n - 1; i >= 0; i--) {
+        int best = inst_latency(&buf->insts[i], model);
+        for (int k = 0; k < g.succs[i].len; k++) {
+            DepEdge e = g.succs[i].edges[k];
+            if (e.delay + priority[e.to] > best) best = e.delay + priority[e.to];
+        }
+        priority[i] = best;
+    }
+
+    int *earliest = calloc(n, sizeof(int));
+    int *remaining = malloc(n * sizeof(int));
+    memcpy(remaining, g.pred_count, n * sizeof(int));
+    int *ready = malloc(n * sizeof(int));  // 所有前驱均已调度的候选指令
+    int ready_len = 0;
+    for (int i = 0; i < n; i++) {
+        if (remaining[i] == 0) ready[ready_len++] = i;
+    }
+    RiscvInst *scheduled = malloc(n * sizeof(RiscvInst));
+
+    int cycle = 0;
+    for (int count = 0; count < n; count++) {
+        // 优先选已可发射且关键路径最长的候选，同优先级保持原顺序；
+        // 若都需等待，则选最早可发射的一条（模拟流水线停顿）
+        int pick = -1;
+        bool pick_ready = false;
+        for (int r = 0; r < ready_len; r++) {
+            int i = ready[r];
+            bool now = earliest[i] <= cycle;
+            bool better;
+            if (pick < 0) {
+                better = true;
+            } else if (now != pick_ready) {
+                better = now;
+            } else if (now) {
+                int pi = ready[pick];
+                better = priority[i] > priority[pi] || (priority[i] == priority[pi] && i < pi);
+            } else {
+                int pi = ready[pick];
+                better = earliest[i] < earliest[pi] || (earliest[i] == earliest[pi] && i < pi);
+            }
+            if (better) {
+                pick = r;
+                pick_ready = now;
+            }
+        }
+        assert(pick >= 0);
+
+        int chosen = ready[pick];
+        ready[pick] = ready[--ready_len];
+        int issue = earliest[chosen] > cycle ? earliest[chosen] : cycle;
+        scheduled[count] = buf->insts[chosen];
+        for (int k = 0; k < g.succs[chosen].len; k++) {
+            DepEdge e = g.succs[chosen].edges[k];
+            if (issue + e.delay > earliest[e.to]) earliest[e.to] = issue + e.delay;
+            if (--remaining[e.to] == 0) ready[ready_len++] = e.to;
+        }
+        cycle = issue + 1;
+    }
+
+    memcpy(buf->insts, scheduled, n * sizeof(RiscvInst));
+
+    free(scheduled);
+    free(ready);
+    free(remaining);
+    free(earliest);
+    free(priority);
+    free_graph(&g);
+}
@@ -0,0 +1,40 @@
+#pragma once
+
+#include "riscv_inst.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * 顺序单发射流水线的延迟模型
+ * latency[cls] 为该类指令的结果最早可被后续指令使用的周期数
+ */
+typedef struct {
+    int latency[RV_CLASS_COUNT];
+} RiscvLatencyModel;
+
+// 默认延迟：alu=1, mul=3, div=16, load=3, store=1, branch=1
+void riscv_latency_default(RiscvLatencyModel *model);
+
+/**
+ * 解析形如 "mul=4,div=20" 的延迟配置，未出现的类别保持原值
+ * @return 成功返回 0，格式错误返回 -1
+ */
+int riscv_latency_parse(RiscvLatencyModel *model, const char *spec);
+
+/**
+ * 按延迟模型估算指令序列在顺序单发射流水线上的执行周期数
+ */
+int riscv_modeled_cycles(const RiscvInst *insts, int len, const RiscvLatencyModel *model);
+
+/**
+ * 对一个基本块做表调度
+ * 在物理寄存器的 RAW/WAR/WAW 依赖与控制流屏障构成的 DAG 上，
+ * 按关键路径长度优先重排指令，不改变寄存器分配结果
+ */
+void riscv_schedule_block(RiscvInstBuffer *buf, const RiscvLatencyModel *model);
+
+#ifdef __cplusplus
+}
+#endif
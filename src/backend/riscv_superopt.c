@@ -0,0 +1,22 @@
+#include "riscv_superopt.h"
+#include <stdlib.h>
+
+#include "riscv_superopt_table.h"
+
+#define SUPEROPT_COUNT ((int)(sizeof(superopt_entries) / sizeof(superopt_entries[0])))
+
+const SuperoptEntry *riscv_superopt_table(int *count) {
+    *count = SUPEROPT_COUNT;
+    return superopt_entries;
+}
+
+static int compare_entry(const void *key, const void *elem) {
+    const SuperoptEntry *a = key, *b = elem;
+    if (a->op != b->op) return a->op < b->op ? -1 : 1;
+    return (a->k > b->k) - (a->k < b->k);
+}
+
+const SuperoptEntry *riscv_superopt_lookup(SsaOp op, int32_t k) {
+    SuperoptEntry key = {op, k, 0, 0, {{0}}};
+    return bsearch(&key, superopt_entries, SUPEROPT_COUNT, sizeof(SuperoptEntry), compare_entry);
+}
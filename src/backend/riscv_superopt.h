@@ -0,0 +1,52 @@
+#pragma once
+
+#include <stdint.h>
+#include "riscv_inst.h"
+#include "ssa.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * 常量右操作数的二元运算 x op k 的超优化指令序列
+ * 由 tools/superopt.c 离线穷举搜索得到，生成的表为 riscv_superopt_table.h，不要手工修改：
+ *   cmake --build build --target superopt-gen    重新生成
+ *   cmake --build build --target superopt-check  以更多输入复核表中的序列，并检查重新生成的结果与之逐字节一致
+ * 表中只收录比指令选择的模式表（装入常量后以寄存器运算，或立即数形式）更短的序列；
+ * 序列在 RV32 语义下与该运算等价（除以 0 等按 RISC-V 的结果），所用指令在 RV64 上换成 *w 形式后结果相同
+ */
+
+#define SUPEROPT_MAX_LENGTH 2
+
+// 序列中的寄存器：被运算的值 x、临时寄存器、结果、x0；只有最后一条指令写结果寄存器
+typedef enum {
+    SUPEROPT_X,
+    SUPEROPT_T,
+    SUPEROPT_R,
+    SUPEROPT_ZERO,
+} SuperoptReg;
+
+typedef struct {
+    RiscvOpcode op;
+    int8_t rd, rs1, rs2;        // SuperoptReg，不使用的字段为 -1
+    int32_t imm;
+} SuperoptInst;
+
+typedef struct {
+    SsaOp op;
+    int32_t k;
+    int length;
+    int latency;                // 默认延迟模型下的关键路径长度
+    SuperoptInst insts[SUPEROPT_MAX_LENGTH];
+} SuperoptEntry;
+
+// 表中的全部序列，按 (op, k) 升序排列
+const SuperoptEntry *riscv_superopt_table(int *count);
+
+// 查找 x op k 的序列，表中没有时返回 NULL
+const SuperoptEntry *riscv_superopt_lookup(SsaOp op, int32_t k);
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,410 @@
+// 由 tools/superopt.c 生成，不要手工修改；重新生成：cmake --build build --target superopt-gen
+// x op k 的最短指令序列，寄存器 x 为被运算的值，t 为临时寄存器，r 为结果
+// 每项为 {运算, k, 长度, 关键路径延迟, {指令 {操作码, rd, rs1, rs2, 立即数}...}}
+
+static const SuperoptEntry superopt_entries[] = {
+    // ne x, -2147483648: lui t, 524288; slt r, t, x
+    {SSA_NE, INT32_MIN, 2, 2, {{RV_OP_LUI, SUPEROPT_T, -1, -1, 524288}, {RV_OP_SLT, SUPEROPT_R, SUPEROPT_T, SUPEROPT_X, 0}}},
+    // ne x, 2048: addi t, x, -2048; snez r, t
+    {SSA_NE, 2048, 2, 2, {{RV_OP_ADDI, SUPEROPT_T, SUPEROPT_X, -1, -2048}, {RV_OP_SNEZ, SUPEROPT_R, SUPEROPT_T, -1, 0}}},
+    // ne x, 2147483647: addi t, x, 1; slt r, x, t
+    {SSA_NE, 2147483647, 2, 2, {{RV_OP_ADDI, SUPEROPT_T, SUPEROPT_X, -1, 1}, {RV_OP_SLT, SUPEROPT_R, SUPEROPT_X, SUPEROPT_T, 0}}},
+    // eq x, -2147483648: addi t, x, -1; slt r, x, t
+    {SSA_EQ, INT32_MIN, 2, 2, {{RV_OP_ADDI, SUPEROPT_T, SUPEROPT_X, -1, -1}, {RV_OP_SLT, SUPEROPT_R, SUPEROPT_X, SUPEROPT_T, 0}}},
+    // eq x, 2048: addi t, x, -2048; seqz r, t
+    {SSA_EQ, 2048, 2, 2, {{RV_OP_ADDI, SUPEROPT_T, SUPEROPT_X, -1, -2048}, {RV_OP_SEQZ, SUPEROPT_R, SUPEROPT_T, -1, 0}}},
+    // eq x, 2147483647: addi t, x, 1; slt r, t, x
+    {SSA_EQ, 2147483647, 2, 2, {{RV_OP_ADDI, SUPEROPT_T, SUPEROPT_X, -1, 1}, {RV_OP_SLT, SUPEROPT_R, SUPEROPT_T, SUPEROPT_X, 0}}},
+    // gt x, -2147483647: addi t, x, -2; slt r, t, x
+    {SSA_GT, -2147483647, 2, 2, {{RV_OP_ADDI, SUPEROPT_T, SUPEROPT_X, -1, -2}, {RV_OP_SLT, SUPEROPT_R, SUPEROPT_T, SUPEROPT_X, 0}}},
+    // gt x, 4095: srai t, x, 12; slt r, zero, t
+    {SSA_GT, 4095, 2, 2, {{RV_OP_SRAI, SUPEROPT_T, SUPEROPT_X, -1, 12}, {RV_OP_SLT, SUPEROPT_R, SUPEROPT_ZERO, SUPEROPT_T, 0}}},
+    // gt x, 8191: srai t, x, 13; slt r, zero, t
+    {SSA_GT, 8191, 2, 2, {{RV_OP_SRAI, SUPEROPT_T, SUPEROPT_X, -1, 13}, {RV_OP_SLT, SUPEROPT_R, SUPEROPT_ZERO, SUPEROPT_T, 0}}},
+    // gt x, 16383: srai t, x, 14; slt r, zero, t
+    {SSA_GT, 16383, 2, 2, {{RV_OP_SRAI, SUPEROPT_T, SUPEROPT_X, -1, 14}, {RV_OP_SLT, SUPEROPT_R, SUPEROPT_ZERO, SUPEROPT_T, 0}}},
+    // gt x, 32767: srai t, x, 15; slt r, zero, t
+    {SSA_GT, 32767, 2, 2, {{RV_OP_SRAI, SUPEROPT_T, SUPEROPT_X, -1, 15}, {RV_OP_SLT, SUPEROPT_R, SUPEROPT_ZERO, SUPEROPT_T, 0}}},
+    // gt x, 65535: srai t, x, 16; slt r, zero, t
+    {SSA_GT, 65535, 2, 2, {{RV_OP_SRAI, SUPEROPT_T, SUPEROPT_X, -1, 16}, {RV_OP_SLT, SUPEROPT_R, SUPEROPT_ZERO, SUPEROPT_T, 0}}},
+    // gt x, 131071: srai t, x, 17; slt r, zero, t
+    {SSA_GT, 131071, 2, 2, {{RV_OP_SRAI, SUPEROPT_T, SUPEROPT_X, -1, 17}, {RV_OP_SLT, SUPEROPT_R, SUPEROPT_ZERO, SUPEROPT_T, 0}}},
+    // gt x, 262143: srai t, x, 18; slt r, zero, t
+    {SSA_GT, 262143, 2, 2, {{RV_OP_SRAI, SUPEROPT_T, SUPEROPT_X, -1, 18}, {RV_OP_SLT, SUPEROPT_R, SUPEROPT_ZERO, SUPEROPT_T, 0}}},
+    // gt x, 524287: srai t, x, 19; slt r, zero, t
+    {SSA_GT, 524287, 2, 2, {{RV_OP_SRAI, SUPEROPT_T, SUPEROPT_X, -1, 19}, {RV_OP_SLT, SUPEROPT_R, SUPEROPT_ZERO, SUPEROPT_T, 0}}},
+    // gt x, 1048575: srai t, x, 20; slt r, zero, t
+    {SSA_GT, 1048575, 2, 2, {{RV_OP_SRAI, SUPEROPT_T, SUPEROPT_X, -1, 20}, {RV_OP_SLT, SUPEROPT_R, SUPEROPT_ZERO, SUPEROPT_T, 0}}},
+    // gt x, 2097151: srai t, x, 21; slt r, zero, t
+    {SSA_GT, 2097151, 2, 2, {{RV_OP_SRAI, SUPEROPT_T, SUPEROPT_X, -1, 21}, {RV_OP_SLT, SUPEROPT_R, SUPEROPT_ZERO, SUPEROPT_T, 0}}},
+    // gt x, 4194303: srai t, x, 22; slt r, zero, t
+    {SSA_GT, 4194303, 2, 2, {{RV_OP_SRAI, SUPEROPT_T, SUPEROPT_X, -1, 22}, {RV_OP_SLT, SUPEROPT_R, SUPEROPT_ZERO, SUPEROPT_T, 0}}},
+    // gt x, 8388607: srai t, x, 23; slt r, zero, t
+    {SSA_GT, 8388607, 2, 2, {{RV_OP_SRAI, SUPEROPT_T, SUPEROPT_X, -1, 23}, {RV_OP_SLT, SUPEROPT_R, SUPEROPT_ZERO, SUPEROPT_T, 0}}},
+    // gt x, 16777215: srai t, x, 24; slt r, zero, t
+    {SSA_GT, 16777215, 2, 2, {{RV_OP_SRAI, SUPEROPT_T, SUPEROPT_X, -1, 24}, {RV_OP_SLT, SUPEROPT_R, SUPEROPT_ZERO, SUPEROPT_T, 0}}},
+    // gt x, 33554431: srai t, x, 25; slt r, zero, t
+    {SSA_GT, 33554431, 2, 2, {{RV_OP_SRAI, SUPEROPT_T, SUPEROPT_X, -1, 25}, {RV_OP_SLT, SUPEROPT_R, SUPEROPT_ZERO, SUPEROPT_T, 0}}},
+    // gt x, 67108863: srai t, x, 26; slt r, zero, t
+    {SSA_GT, 67108863, 2, 2, {{RV_OP_SRAI, SUPEROPT_T, SUPEROPT_X, -1, 26}, {RV_OP_SLT, SUPEROPT_R, SUPEROPT_ZERO, SUPEROPT_T, 0}}},
+    // gt x, 134217727: srai t, x, 27; slt r, zero, t
+    {SSA_GT, 134217727, 2, 2, {{RV_OP_SRAI, SUPEROPT_T, SUPEROPT_X, -1, 27}, {RV_OP_SLT, SUPEROPT_R, SUPEROPT_ZERO, SUPEROPT_T, 0}}},
+    // gt x, 268435455: srai t, x, 28; slt r, zero, t
+    {SSA_GT, 268435455, 2, 2, {{RV_OP_SRAI, SUPEROPT_T, SUPEROPT_X, -1, 28}, {RV_OP_SLT, SUPEROPT_R, SUPEROPT_ZERO, SUPEROPT_T, 0}}},
+    // gt x, 536870911: srai t, x, 29; slt r, zero, t
+    {SSA_GT, 536870911, 2, 2, {{RV_OP_SRAI, SUPEROPT_T, SUPEROPT_X, -1, 29}, {RV_OP_SLT, SUPEROPT_R, SUPEROPT_ZERO, SUPEROPT_T, 0}}},
+    // gt x, 1073741823: srai t, x, 30; slt r, zero, t
+    {SSA_GT, 1073741823, 2, 2, {{RV_OP_SRAI, SUPEROPT_T, SUPEROPT_X, -1, 30}, {RV_OP_SLT, SUPEROPT_R, SUPEROPT_ZERO, SUPEROPT_T, 0}}},
+    // gt x, 2147483647: li r, 0
+    {SSA_GT, 2147483647, 1, 1, {{RV_OP_LI, SUPEROPT_R, -1, -1, 0}}},
+    // lt x, -2147483648: li r, 0
+    {SSA_LT, INT32_MIN, 1, 1, {{RV_OP_LI, SUPEROPT_R, -1, -1, 0}}},
+    // lt x, -2147483647: addi t, x, -1; slt r, x, t
+    {SSA_LT, -2147483647, 2, 2, {{RV_OP_ADDI, SUPEROPT_T, SUPEROPT_X, -1, -1}, {RV_OP_SLT, SUPEROPT_R, SUPEROPT_X, SUPEROPT_T, 0}}},
+    // lt x, 2048: andi t, x, -2; slti r, t, 2047
+    {SSA_LT, 2048, 2, 2, {{RV_OP_ANDI, SUPEROPT_T, SUPEROPT_X, -1, -2}, {RV_OP_SLTI, SUPEROPT_R, SUPEROPT_T, -1, 2047}}},
+    // lt x, 2147483647: addi t, x, 1; slt r, x, t
+    {SSA_LT, 2147483647, 2, 2, {{RV_OP_ADDI, SUPEROPT_T, SUPEROPT_X, -1, 1}, {RV_OP_SLT, SUPEROPT_R, SUPEROPT_X, SUPEROPT_T, 0}}},
+    // ge x, -2147483648: li r, 1
+    {SSA_GE, INT32_MIN, 1, 1, {{RV_OP_LI, SUPEROPT_R, -1, -1, 1}}},
+    // ge x, -2147483647: lui t, 524288; slt r, t, x
+    {SSA_GE, -2147483647, 2, 2, {{RV_OP_LUI, SUPEROPT_T, -1, -1, 524288}, {RV_OP_SLT, SUPEROPT_R, SUPEROPT_T, SUPEROPT_X, 0}}},
+    // ge x, -1073741823: lui t, 786432; slt r, t, x
+    {SSA_GE, -1073741823, 2, 2, {{RV_OP_LUI, SUPEROPT_T, -1, -1, 786432}, {RV_OP_SLT, SUPEROPT_R, SUPEROPT_T, SUPEROPT_X, 0}}},
+    // ge x, -536870911: lui t, 917504; slt r, t, x
+    {SSA_GE, -536870911, 2, 2, {{RV_OP_LUI, SUPEROPT_T, -1, -1, 917504}, {RV_OP_SLT, SUPEROPT_R, SUPEROPT_T, SUPEROPT_X, 0}}},
+    // ge x, -268435455: lui t, 983040; slt r, t, x
+    {SSA_GE, -268435455, 2, 2, {{RV_OP_LUI, SUPEROPT_T, -1, -1, 983040}, {RV_OP_SLT, SUPEROPT_R, SUPEROPT_T, SUPEROPT_X, 0}}},
+    // ge x, -134217727: lui t, 1015808; slt r, t, x
+    {SSA_GE, -134217727, 2, 2, {{RV_OP_LUI, SUPEROPT_T, -1, -1, 1015808}, {RV_OP_SLT, SUPEROPT_R, SUPEROPT_T, SUPEROPT_X, 0}}},
+    // ge x, -67108863: lui t, 1032192; slt r, t, x
+    {SSA_GE, -67108863, 2, 2, {{RV_OP_LUI, SUPEROPT_T, -1, -1, 1032192}, {RV_OP_SLT, SUPEROPT_R, SUPEROPT_T, SUPEROPT_X, 0}}},
+    // ge x, -33554431: lui t, 1040384; slt r, t, x
+    {SSA_GE, -33554431, 2, 2, {{RV_OP_LUI, SUPEROPT_T, -1, -1, 1040384}, {RV_OP_SLT, SUPEROPT_R, SUPEROPT_T, SUPEROPT_X, 0}}},
+    // ge x, -16777215: lui t, 1044480; slt r, t, x
+    {SSA_GE, -16777215, 2, 2, {{RV_OP_LUI, SUPEROPT_T, -1, -1, 1044480}, {RV_OP_SLT, SUPEROPT_R, SUPEROPT_T, SUPEROPT_X, 0}}},
+    // ge x, -8388607: lui t, 1046528; slt r, t, x
+    {SSA_GE, -8388607, 2, 2, {{RV_OP_LUI, SUPEROPT_T, -1, -1, 1046528}, {RV_OP_SLT, SUPEROPT_R, SUPEROPT_T, SUPEROPT_X, 0}}},
+    // ge x, -4194303: lui t, 1047552; slt r, t, x
+    {SSA_GE, -4194303, 2, 2, {{RV_OP_LUI, SUPEROPT_T, -1, -1, 1047552}, {RV_OP_SLT, SUPEROPT_R, SUPEROPT_T, SUPEROPT_X, 0}}},
+    // ge x, -2097151: lui t, 1048064; slt r, t, x
+    {SSA_GE, -2097151, 2, 2, {{RV_OP_LUI, SUPEROPT_T, -1, -1, 1048064}, {RV_OP_SLT, SUPEROPT_R, SUPEROPT_T, SUPEROPT_X, 0}}},
+    // ge x, -1048575: lui t, 1048320; slt r, t, x
+    {SSA_GE, -1048575, 2, 2, {{RV_OP_LUI, SUPEROPT_T, -1, -1, 1048320}, {RV_OP_SLT, SUPEROPT_R, SUPEROPT_T, SUPEROPT_X, 0}}},
+    // ge x, -524287: lui t, 1048448; slt r, t, x
+    {SSA_GE, -524287, 2, 2, {{RV_OP_LUI, SUPEROPT_T, -1, -1, 1048448}, {RV_OP_SLT, SUPEROPT_R, SUPEROPT_T, SUPEROPT_X, 0}}},
+    // ge x, -262143: lui t, 1048512; slt r, t, x
+    {SSA_GE, -262143, 2, 2, {{RV_OP_LUI, SUPEROPT_T, -1, -1, 1048512}, {RV_OP_SLT, SUPEROPT_R, SUPEROPT_T, SUPEROPT_X, 0}}},
+    // ge x, -131071: lui t, 1048544; slt r, t, x
+    {SSA_GE, -131071, 2, 2, {{RV_OP_LUI, SUPEROPT_T, -1, -1, 1048544}, {RV_OP_SLT, SUPEROPT_R, SUPEROPT_T, SUPEROPT_X, 0}}},
+    // ge x, -65535: lui t, 1048560; slt r, t, x
+    {SSA_GE, -65535, 2, 2, {{RV_OP_LUI, SUPEROPT_T, -1, -1, 1048560}, {RV_OP_SLT, SUPEROPT_R, SUPEROPT_T, SUPEROPT_X, 0}}},
+    // ge x, -32767: lui t, 1048568; slt r, t, x
+    {SSA_GE, -32767, 2, 2, {{RV_OP_LUI, SUPEROPT_T, -1, -1, 1048568}, {RV_OP_SLT, SUPEROPT_R, SUPEROPT_T, SUPEROPT_X, 0}}},
+    // ge x, -16383: lui t, 1048572; slt r, t, x
+    {SSA_GE, -16383, 2, 2, {{RV_OP_LUI, SUPEROPT_T, -1, -1, 1048572}, {RV_OP_SLT, SUPEROPT_R, SUPEROPT_T, SUPEROPT_X, 0}}},
+    // ge x, -8191: lui t, 1048574; slt r, t, x
+    {SSA_GE, -8191, 2, 2, {{RV_OP_LUI, SUPEROPT_T, -1, -1, 1048574}, {RV_OP_SLT, SUPEROPT_R, SUPEROPT_T, SUPEROPT_X, 0}}},
+    // ge x, -4095: lui t, 1048575; slt r, t, x
+    {SSA_GE, -4095, 2, 2, {{RV_OP_LUI, SUPEROPT_T, -1, -1, 1048575}, {RV_OP_SLT, SUPEROPT_R, SUPEROPT_T, SUPEROPT_X, 0}}},
+    // ge x, 1: slt r, zero, x
+    {SSA_GE, 1, 1, 1, {{RV_OP_SLT, SUPEROPT_R, SUPEROPT_ZERO, SUPEROPT_X, 0}}},
+    // ge x, 2048: li t, 2047; slt r, t, x
+    {SSA_GE, 2048, 2, 2, {{RV_OP_LI, SUPEROPT_T, -1, -1, 2047}, {RV_OP_SLT, SUPEROPT_R, SUPEROPT_T, SUPEROPT_X, 0}}},
+    // ge x, 4096: srai t, x, 12; slt r, zero, t
+    {SSA_GE, 4096, 2, 2, {{RV_OP_SRAI, SUPEROPT_T, SUPEROPT_X, -1, 12}, {RV_OP_SLT, SUPEROPT_R, SUPEROPT_ZERO, SUPEROPT_T, 0}}},
+    // ge x, 4097: lui t, 1; slt r, t, x
+    {SSA_GE, 4097, 2, 2, {{RV_OP_LUI, SUPEROPT_T, -1, -1, 1}, {RV_OP_SLT, SUPEROPT_R, SUPEROPT_T, SUPEROPT_X, 0}}},
+    // ge x, 8192: srai t, x, 13; slt r, zero, t
+    {SSA_GE, 8192, 2, 2, {{RV_OP_SRAI, SUPEROPT_T, SUPEROPT_X, -1, 13}, {RV_OP_SLT, SUPEROPT_R, SUPEROPT_ZERO, SUPEROPT_T, 0}}},
+    // ge x, 8193: lui t, 2; slt r, t, x
+    {SSA_GE, 8193, 2, 2, {{RV_OP_LUI, SUPEROPT_T, -1, -1, 2}, {RV_OP_SLT, SUPEROPT_R, SUPEROPT_T, SUPEROPT_X, 0}}},
+    // ge x, 16384: srai t, x, 14; slt r, zero, t
+    {SSA_GE, 16384, 2, 2, {{RV_OP_SRAI, SUPEROPT_T, SUPEROPT_X, -1, 14}, {RV_OP_SLT, SUPEROPT_R, SUPEROPT_ZERO, SUPEROPT_T, 0}}},
+    // ge x, 16385: lui t, 4; slt r, t, x
+    {SSA_GE, 16385, 2, 2, {{RV_OP_LUI, SUPEROPT_T, -1, -1, 4}, {RV_OP_SLT, SUPEROPT_R, SUPEROPT_T, SUPEROPT_X, 0}}},
+    // ge x, 32768: srai t, x, 15; slt r, zero, t
+    {SSA_GE, 32768, 2, 2, {{RV_OP_SRAI, SUPEROPT_T, SUPEROPT_X, -1, 15}, {RV_OP_SLT, SUPEROPT_R, SUPEROPT_ZERO, SUPEROPT_T, 0}}},
+    // ge x, 32769: lui t, 8; slt r, t, x
+    {SSA_GE, 32769, 2, 2, {{RV_OP_LUI, SUPEROPT_T, -1, -1, 8}, {RV_OP_SLT, SUPEROPT_R, SUPEROPT_T, SUPEROPT_X, 0}}},
+    // ge x, 65536: srai t, x, 16; slt r, zero, t
+    {SSA_GE, 65536, 2, 2, {{RV_OP_SRAI, SUPEROPT_T, SUPEROPT_X, -1, 16}, {RV_OP_SLT, SUPEROPT_R, SUPEROPT_ZERO, SUPEROPT_T, 0}}},
+    // ge x, 65537: lui t, 16; slt r, t, x
+    {SSA_GE, 65537, 2, 2, {{RV_OP_LUI, SUPEROPT_T, -1, -1, 16}, {RV_OP_SLT, SUPEROPT_R, SUPEROPT_T, SUPEROPT_X, 0}}},
+    // ge x, 131072: srai t, x, 17; slt r, zero, t
+    {SSA_GE, 131072, 2, 2, {{RV_OP_SRAI, SUPEROPT_T, SUPEROPT_X, -1, 17}, {RV_OP_SLT, SUPEROPT_R, SUPEROPT_ZERO, SUPEROPT_T, 0}}},
+    // ge x, 131073: lui t, 32; slt r, t, x
+    {SSA_GE, 131073, 2, 2, {{RV_OP_LUI, SUPEROPT_T, -1, -1, 32}, {RV_OP_SLT, SUPEROPT_R, SUPEROPT_T, SUPEROPT_X, 0}}},
+    // ge x, 262144: srai t, x, 18; slt r, zero, t
+    {SSA_GE, 262144, 2, 2, {{RV_OP_SRAI, SUPEROPT_T, SUPEROPT_X, -1, 18}, {RV_OP_SLT, SUPEROPT_R, SUPEROPT_ZERO, SUPEROPT_T, 0}}},
+    // ge x, 262145: lui t, 64; slt r, t, x
+    {SSA_GE, 262145, 2, 2, {{RV_OP_LUI, SUPEROPT_T, -1, -1, 64}, {RV_OP_SLT, SUPEROPT_R, SUPEROPT_T, SUPEROPT_X, 0}}},
+    // ge x, 524288: srai t, x, 19; slt r, zero, t
+    {SSA_GE, 524288, 2, 2, {{RV_OP_SRAI, SUPEROPT_T, SUPEROPT_X, -1, 19}, {RV_OP_SLT, SUPEROPT_R, SUPEROPT_ZERO, SUPEROPT_T, 0}}},
+    // ge x, 524289: lui t, 128; slt r, t, x
+    {SSA_GE, 524289, 2, 2, {{RV_OP_LUI, SUPEROPT_T, -1, -1, 128}, {RV_OP_SLT, SUPEROPT_R, SUPEROPT_T, SUPEROPT_X, 0}}},
+    // ge x, 1048576: srai t, x, 20; slt r, zero, t
+    {SSA_GE, 1048576, 2, 2, {{RV_OP_SRAI, SUPEROPT_T, SUPEROPT_X, -1, 20}, {RV_OP_SLT, SUPEROPT_R, SUPEROPT_ZERO, SUPEROPT_T, 0}}},
+    // ge x, 1048577: lui t, 256; slt r, t, x
+    {SSA_GE, 1048577, 2, 2, {{RV_OP_LUI, SUPEROPT_T, -1, -1, 256}, {RV_OP_SLT, SUPEROPT_R, SUPEROPT_T, SUPEROPT_X, 0}}},
+    // ge x, 2097152: srai t, x, 21; slt r, zero, t
+    {SSA_GE, 2097152, 2, 2, {{RV_OP_SRAI, SUPEROPT_T, SUPEROPT_X, -1, 21}, {RV_OP_SLT, SUPEROPT_R, SUPEROPT_ZERO, SUPEROPT_T, 0}}},
+    // ge x, 2097153: lui t, 512; slt r, t, x
+    {SSA_GE, 2097153, 2, 2, {{RV_OP_LUI, SUPEROPT_T, -1, -1, 512}, {RV_OP_SLT, SUPEROPT_R, SUPEROPT_T, SUPEROPT_X, 0}}},
+    // ge x, 4194304: srai t, x, 22; slt r, zero, t
+    {SSA_GE, 4194304, 2, 2, {{RV_OP_SRAI, SUPEROPT_T, SUPEROPT_X, -1, 22}, {RV_OP_SLT, SUPEROPT_R, SUPEROPT_ZERO, SUPEROPT_T, 0}}},
+    // ge x, 4194305: lui t, 1024; slt r, t, x
+    {SSA_GE, 4194305, 2, 2, {{RV_OP_LUI, SUPEROPT_T, -1, -1, 1024}, {RV_OP_SLT, SUPEROPT_R, SUPEROPT_T, SUPEROPT_X, 0}}},
+    // ge x, 8388608: srai t, x, 23; slt r, zero, t
+    {SSA_GE, 8388608, 2, 2, {{RV_OP_SRAI, SUPEROPT_T, SUPEROPT_X, -1, 23}, {RV_OP_SLT, SUPEROPT_R, SUPEROPT_ZERO, SUPEROPT_T, 0}}},
+    // ge x, 8388609: lui t, 2048; slt r, t, x
+    {SSA_GE, 8388609, 2, 2, {{RV_OP_LUI, SUPEROPT_T, -1, -1, 2048}, {RV_OP_SLT, SUPEROPT_R, SUPEROPT_T, SUPEROPT_X, 0}}},
+    // ge x, 16777216: srai t, x, 24; slt r, zero, t
+    {SSA_GE, 16777216, 2, 2, {{RV_OP_SRAI, SUPEROPT_T, SUPEROPT_X, -1, 24}, {RV_OP_SLT, SUPEROPT_R, SUPEROPT_ZERO, SUPEROPT_T, 0}}},
+    // ge x, 16777217: lui t, 4096; slt r, t, x
+    {SSA_GE, 16777217, 2, 2, {{RV_OP_LUI, SUPEROPT_T, -1, -1, 4096}, {RV_OP_SLT, SUPEROPT_R, SUPEROPT_T, SUPEROPT_X, 0}}},
+    // ge x, 33554432: srai t, x, 25; slt r, zero, t
+    {SSA_GE, 33554432, 2, 2, {{RV_OP_SRAI, SUPEROPT_T, SUPEROPT_X, -1, 25}, {RV_OP_SLT, SUPEROPT_R, SUPEROPT_ZERO, SUPEROPT_T, 0}}},
+    // ge x, 33554433: lui t, 8192; slt r, t, x
+    {SSA_GE, 33554433, 2, 2, {{RV_OP_LUI, SUPEROPT_T, -1, -1, 8192}, {RV_OP_SLT, SUPEROPT_R, SUPEROPT_T, SUPEROPT_X, 0}}},
+    // ge x, 67108864: srai t, x, 26; slt r, zero, t
+    {SSA_GE, 67108864, 2, 2, {{RV_OP_SRAI, SUPEROPT_T, SUPEROPT_X, -1, 26}, {RV_OP_SLT, SUPEROPT_R, SUPEROPT_ZERO, SUPEROPT_T, 0}}},
+    // ge x, 67108865: lui t, 16384; slt r, t, x
+    {SSA_GE, 67108865, 2, 2, {{RV_OP_LUI, SUPEROPT_T, -1, -1, 16384}, {RV_OP_SLT, SUPEROPT_R, SUPEROPT_T, SUPEROPT_X, 0}}},
+    // ge x, 134217728: srai t, x, 27; slt r, zero, t
+    {SSA_GE, 134217728, 2, 2, {{RV_OP_SRAI, SUPEROPT_T, SUPEROPT_X, -1, 27}, {RV_OP_SLT, SUPEROPT_R, SUPEROPT_ZERO, SUPEROPT_T, 0}}},
+    // ge x, 134217729: lui t, 32768; slt r, t, x
+    {SSA_GE, 134217729, 2, 2, {{RV_OP_LUI, SUPEROPT_T, -1, -1, 32768}, {RV_OP_SLT, SUPEROPT_R, SUPEROPT_T, SUPEROPT_X, 0}}},
+    // ge x, 268435456: srai t, x, 28; slt r, zero, t
+    {SSA_GE, 268435456, 2, 2, {{RV_OP_SRAI, SUPEROPT_T, SUPEROPT_X, -1, 28}, {RV_OP_SLT, SUPEROPT_R, SUPEROPT_ZERO, SUPEROPT_T, 0}}},
+    // ge x, 268435457: lui t, 65536; slt r, t, x
+    {SSA_GE, 268435457, 2, 2, {{RV_OP_LUI, SUPEROPT_T, -1, -1, 65536}, {RV_OP_SLT, SUPEROPT_R, SUPEROPT_T, SUPEROPT_X, 0}}},
+    // ge x, 536870912: srai t, x, 29; slt r, zero, t
+    {SSA_GE, 536870912, 2, 2, {{RV_OP_SRAI, SUPEROPT_T, SUPEROPT_X, -1, 29}, {RV_OP_SLT, SUPEROPT_R, SUPEROPT_ZERO, SUPEROPT_T, 0}}},
+    // ge x, 536870913: lui t, 131072; slt r, t, x
+    {SSA_GE, 536870913, 2, 2, {{RV_OP_LUI, SUPEROPT_T, -1, -1, 131072}, {RV_OP_SLT, SUPEROPT_R, SUPEROPT_T, SUPEROPT_X, 0}}},
+    // ge x, 1073741824: srai t, x, 30; slt r, zero, t
+    {SSA_GE, 1073741824, 2, 2, {{RV_OP_SRAI, SUPEROPT_T, SUPEROPT_X, -1, 30}, {RV_OP_SLT, SUPEROPT_R, SUPEROPT_ZERO, SUPEROPT_T, 0}}},
+    // ge x, 1073741825: lui t, 262144; slt r, t, x
+    {SSA_GE, 1073741825, 2, 2, {{RV_OP_LUI, SUPEROPT_T, -1, -1, 262144}, {RV_OP_SLT, SUPEROPT_R, SUPEROPT_T, SUPEROPT_X, 0}}},
+    // ge x, 2147483647: addi t, x, 1; slt r, t, x
+    {SSA_GE, 2147483647, 2, 2, {{RV_OP_ADDI, SUPEROPT_T, SUPEROPT_X, -1, 1}, {RV_OP_SLT, SUPEROPT_R, SUPEROPT_T, SUPEROPT_X, 0}}},
+    // le x, -2147483648: addi t, x, -1; slt r, x, t
+    {SSA_LE, INT32_MIN, 2, 2, {{RV_OP_ADDI, SUPEROPT_T, SUPEROPT_X, -1, -1}, {RV_OP_SLT, SUPEROPT_R, SUPEROPT_X, SUPEROPT_T, 0}}},
+    // le x, -2147483647: addi t, x, -2; slt r, x, t
+    {SSA_LE, -2147483647, 2, 2, {{RV_OP_ADDI, SUPEROPT_T, SUPEROPT_X, -1, -2}, {RV_OP_SLT, SUPEROPT_R, SUPEROPT_X, SUPEROPT_T, 0}}},
+    // le x, -1073741825: lui t, 786432; slt r, x, t
+    {SSA_LE, -1073741825, 2, 2, {{RV_OP_LUI, SUPEROPT_T, -1, -1, 786432}, {RV_OP_SLT, SUPEROPT_R, SUPEROPT_X, SUPEROPT_T, 0}}},
+    // le x, -536870913: lui t, 917504; slt r, x, t
+    {SSA_LE, -536870913, 2, 2, {{RV_OP_LUI, SUPEROPT_T, -1, -1, 917504}, {RV_OP_SLT, SUPEROPT_R, SUPEROPT_X, SUPEROPT_T, 0}}},
+    // le x, -268435457: lui t, 983040; slt r, x, t
+    {SSA_LE, -268435457, 2, 2, {{RV_OP_LUI, SUPEROPT_T, -1, -1, 983040}, {RV_OP_SLT, SUPEROPT_R, SUPEROPT_X, SUPEROPT_T, 0}}},
+    // le x, -134217729: lui t, 1015808; slt r, x, t
+    {SSA_LE, -134217729, 2, 2, {{RV_OP_LUI, SUPEROPT_T, -1, -1, 1015808}, {RV_OP_SLT, SUPEROPT_R, SUPEROPT_X, SUPEROPT_T, 0}}},
+    // le x, -67108865: lui t, 1032192; slt r, x, t
+    {SSA_LE, -67108865, 2, 2, {{RV_OP_LUI, SUPEROPT_T, -1, -1, 1032192}, {RV_OP_SLT, SUPEROPT_R, SUPEROPT_X, SUPEROPT_T, 0}}},
+    // le x, -33554433: lui t, 1040384; slt r, x, t
+    {SSA_LE, -33554433, 2, 2, {{RV_OP_LUI, SUPEROPT_T, -1, -1, 1040384}, {RV_OP_SLT, SUPEROPT_R, SUPEROPT_X, SUPEROPT_T, 0}}},
+    // le x, -16777217: lui t, 1044480; slt r, x, t
+    {SSA_LE, -16777217, 2, 2, {{RV_OP_LUI, SUPEROPT_T, -1, -1, 1044480}, {RV_OP_SLT, SUPEROPT_R, SUPEROPT_X, SUPEROPT_T, 0}}},
+    // le x, -8388609: lui t, 1046528; slt r, x, t
+    {SSA_LE, -8388609, 2, 2, {{RV_OP_LUI, SUPEROPT_T, -1, -1, 1046528}, {RV_OP_SLT, SUPEROPT_R, SUPEROPT_X, SUPEROPT_T, 0}}},
+    // le x, -4194305: lui t, 1047552; slt r, x, t
+    {SSA_LE, -4194305, 2, 2, {{RV_OP_LUI, SUPEROPT_T, -1, -1, 1047552}, {RV_OP_SLT, SUPEROPT_R, SUPEROPT_X, SUPEROPT_T, 0}}},
+    // le x, -2097153: lui t, 1048064; slt r, x, t
+    {SSA_LE, -2097153, 2, 2, {{RV_OP_LUI, SUPEROPT_T, -1, -1, 1048064}, {RV_OP_SLT, SUPEROPT_R, SUPEROPT_X, SUPEROPT_T, 0}}},
+    // le x, -1048577: lui t, 1048320; slt r, x, t
+    {SSA_LE, -1048577, 2, 2, {{RV_OP_LUI, SUPEROPT_T, -1, -1, 1048320}, {RV_OP_SLT, SUPEROPT_R, SUPEROPT_X, SUPEROPT_T, 0}}},
+    // le x, -524289: lui t, 1048448; slt r, x, t
+    {SSA_LE, -524289, 2, 2, {{RV_OP_LUI, SUPEROPT_T, -1, -1, 1048448}, {RV_OP_SLT, SUPEROPT_R, SUPEROPT_X, SUPEROPT_T, 0}}},
+    // le x, -262145: lui t, 1048512; slt r, x, t
+    {SSA_LE, -262145, 2, 2, {{RV_OP_LUI, SUPEROPT_T, -1, -1, 1048512}, {RV_OP_SLT, SUPEROPT_R, SUPEROPT_X, SUPEROPT_T, 0}}},
+    // le x, -131073: lui t, 1048544; slt r, x, t
+    {SSA_LE, -131073, 2, 2, {{RV_OP_LUI, SUPEROPT_T, -1, -1, 1048544}, {RV_OP_SLT, SUPEROPT_R, SUPEROPT_X, SUPEROPT_T, 0}}},
+    // le x, -65537: lui t, 1048560; slt r, x, t
+    {SSA_LE, -65537, 2, 2, {{RV_OP_LUI, SUPEROPT_T, -1, -1, 1048560}, {RV_OP_SLT, SUPEROPT_R, SUPEROPT_X, SUPEROPT_T, 0}}},
+    // le x, -32769: lui t, 1048568; slt r, x, t
+    {SSA_LE, -32769, 2, 2, {{RV_OP_LUI, SUPEROPT_T, -1, -1, 1048568}, {RV_OP_SLT, SUPEROPT_R, SUPEROPT_X, SUPEROPT_T, 0}}},
+    // le x, -16385: lui t, 1048572; slt r, x, t
+    {SSA_LE, -16385, 2, 2, {{RV_OP_LUI, SUPEROPT_T, -1, -1, 1048572}, {RV_OP_SLT, SUPEROPT_R, SUPEROPT_X, SUPEROPT_T, 0}}},
+    // le x, -8193: lui t, 1048574; slt r, x, t
+    {SSA_LE, -8193, 2, 2, {{RV_OP_LUI, SUPEROPT_T, -1, -1, 1048574}, {RV_OP_SLT, SUPEROPT_R, SUPEROPT_X, SUPEROPT_T, 0}}},
+    // le x, -4097: lui t, 1048575; slt r, x, t
+    {SSA_LE, -4097, 2, 2, {{RV_OP_LUI, SUPEROPT_T, -1, -1, 1048575}, {RV_OP_SLT, SUPEROPT_R, SUPEROPT_X, SUPEROPT_T, 0}}},
+    // le x, 2047: andi t, x, -2; slti r, t, 2047
+    {SSA_LE, 2047, 2, 2, {{RV_OP_ANDI, SUPEROPT_T, SUPEROPT_X, -1, -2}, {RV_OP_SLTI, SUPEROPT_R, SUPEROPT_T, -1, 2047}}},
+    // le x, 4095: lui t, 1; slt r, x, t
+    {SSA_LE, 4095, 2, 2, {{RV_OP_LUI, SUPEROPT_T, -1, -1, 1}, {RV_OP_SLT, SUPEROPT_R, SUPEROPT_X, SUPEROPT_T, 0}}},
+    // le x, 8191: lui t, 2; slt r, x, t
+    {SSA_LE, 8191, 2, 2, {{RV_OP_LUI, SUPEROPT_T, -1, -1, 2}, {RV_OP_SLT, SUPEROPT_R, SUPEROPT_X, SUPEROPT_T, 0}}},
+    // le x, 16383: lui t, 4; slt r, x, t
+    {SSA_LE, 16383, 2, 2, {{RV_OP_LUI, SUPEROPT_T, -1, -1, 4}, {RV_OP_SLT, SUPEROPT_R, SUPEROPT_X, SUPEROPT_T, 0}}},
+    // le x, 32767: lui t, 8; slt r, x, t
+    {SSA_LE, 32767, 2, 2, {{RV_OP_LUI, SUPEROPT_T, -1, -1, 8}, {RV_OP_SLT, SUPEROPT_R, SUPEROPT_X, SUPEROPT_T, 0}}},
+    // le x, 65535: lui t, 16; slt r, x, t
+    {SSA_LE, 65535, 2, 2, {{RV_OP_LUI, SUPEROPT_T, -1, -1, 16}, {RV_OP_SLT, SUPEROPT_R, SUPEROPT_X, SUPEROPT_T, 0}}},
+    // le x, 131071: lui t, 32; slt r, x, t
+    {SSA_LE, 131071, 2, 2, {{RV_OP_LUI, SUPEROPT_T, -1, -1, 32}, {RV_OP_SLT, SUPEROPT_R, SUPEROPT_X, SUPEROPT_T, 0}}},
+    // le x, 262143: lui t, 64; slt r, x, t
+    {SSA_LE, 262143, 2, 2, {{RV_OP_LUI, SUPEROPT_T, -1, -1, 64}, {RV_OP_SLT, SUPEROPT_R, SUPEROPT_X, SUPEROPT_T, 0}}},
+    // le x, 524287: lui t, 128; slt r, x, t
+    {SSA_LE, 524287, 2, 2, {{RV_OP_LUI, SUPEROPT_T, -1, -1, 128}, {RV_OP_SLT, SUPEROPT_R, SUPEROPT_X, SUPEROPT_T, 0}}},
+    // le x, 1048575: lui t, 256; slt r, x, t
+    {SSA_LE, 1048575, 2, 2, {{RV_OP_LUI, SUPEROPT_T, -1, -1, 256}, {RV_OP_SLT, SUPEROPT_R, SUPEROPT_X, SUPEROPT_T, 0}}},
+    // le x, 2097151: lui t, 512; slt r, x, t
+    {SSA_LE, 2097151, 2, 2, {{RV_OP_LUI, SUPEROPT_T, -1, -1, 512}, {RV_OP_SLT, SUPEROPT_R, SUPEROPT_X, SUPEROPT_T, 0}}},
+    // le x, 4194303: lui t, 1024; slt r, x, t
+    {SSA_LE, 4194303, 2, 2, {{RV_OP_LUI, SUPEROPT_T, -1, -1, 1024}, {RV_OP_SLT, SUPEROPT_R, SUPEROPT_X, SUPEROPT_T, 0}}},
+    // le x, 8388607: lui t, 2048; slt r, x, t
+    {SSA_LE, 8388607, 2, 2, {{RV_OP_LUI, SUPEROPT_T, -1, -1, 2048}, {RV_OP_SLT, SUPEROPT_R, SUPEROPT_X, SUPEROPT_T, 0}}},
+    // le x, 16777215: lui t, 4096; slt r, x, t
+    {SSA_LE, 16777215, 2, 2, {{RV_OP_LUI, SUPEROPT_T, -1, -1, 4096}, {RV_OP_SLT, SUPEROPT_R, SUPEROPT_X, SUPEROPT_T, 0}}},
+    // le x, 33554431: lui t, 8192; slt r, x, t
+    {SSA_LE, 33554431, 2, 2, {{RV_OP_LUI, SUPEROPT_T, -1, -1, 8192}, {RV_OP_SLT, SUPEROPT_R, SUPEROPT_X, SUPEROPT_T, 0}}},
+    // le x, 67108863: lui t, 16384; slt r, x, t
+    {SSA_LE, 67108863, 2, 2, {{RV_OP_LUI, SUPEROPT_T, -1, -1, 16384}, {RV_OP_SLT, SUPEROPT_R, SUPEROPT_X, SUPEROPT_T, 0}}},
+    // le x, 134217727: lui t, 32768; slt r, x, t
+    {SSA_LE, 134217727, 2, 2, {{RV_OP_LUI, SUPEROPT_T, -1, -1, 32768}, {RV_OP_SLT, SUPEROPT_R, SUPEROPT_X, SUPEROPT_T, 0}}},
+    // le x, 268435455: lui t, 65536; slt r, x, t
+    {SSA_LE, 268435455, 2, 2, {{RV_OP_LUI, SUPEROPT_T, -1, -1, 65536}, {RV_OP_SLT, SUPEROPT_R, SUPEROPT_X, SUPEROPT_T, 0}}},
+    // le x, 536870911: lui t, 131072; slt r, x, t
+    {SSA_LE, 536870911, 2, 2, {{RV_OP_LUI, SUPEROPT_T, -1, -1, 131072}, {RV_OP_SLT, SUPEROPT_R, SUPEROPT_X, SUPEROPT_T, 0}}},
+    // le x, 1073741823: lui t, 262144; slt r, x, t
+    {SSA_LE, 1073741823, 2, 2, {{RV_OP_LUI, SUPEROPT_T, -1, -1, 262144}, {RV_OP_SLT, SUPEROPT_R, SUPEROPT_X, SUPEROPT_T, 0}}},
+    // le x, 2147483647: li r, 1
+    {SSA_LE, 2147483647, 1, 1, {{RV_OP_LI, SUPEROPT_R, -1, -1, 1}}},
+    // mul x, -2147483648: slli r, x, 31
+    {SSA_MUL, INT32_MIN, 1, 1, {{RV_OP_SLLI, SUPEROPT_R, SUPEROPT_X, -1, 31}}},
+    // mul x, -2147483647: slli t, x, 31; add r, x, t
+    {SSA_MUL, -2147483647, 2, 2, {{RV_OP_SLLI, SUPEROPT_T, SUPEROPT_X, -1, 31}, {RV_OP_ADD, SUPEROPT_R, SUPEROPT_X, SUPEROPT_T, 0}}},
+    // mul x, -1073741823: slli t, x, 30; sub r, x, t
+    {SSA_MUL, -1073741823, 2, 2, {{RV_OP_SLLI, SUPEROPT_T, SUPEROPT_X, -1, 30}, {RV_OP_SUB, SUPEROPT_R, SUPEROPT_X, SUPEROPT_T, 0}}},
+    // mul x, -536870911: slli t, x, 29; sub r, x, t
+    {SSA_MUL, -536870911, 2, 2, {{RV_OP_SLLI, SUPEROPT_T, SUPEROPT_X, -1, 29}, {RV_OP_SUB, SUPEROPT_R, SUPEROPT_X, SUPEROPT_T, 0}}},
+    // mul x, -268435455: slli t, x, 28; sub r, x, t
+    {SSA_MUL, -268435455, 2, 2, {{RV_OP_SLLI, SUPEROPT_T, SUPEROPT_X, -1, 28}, {RV_OP_SUB, SUPEROPT_R, SUPEROPT_X, SUPEROPT_T, 0}}},
+    // mul x, -134217727: slli t, x, 27; sub r, x, t
+    {SSA_MUL, -134217727, 2, 2, {{RV_OP_SLLI, SUPEROPT_T, SUPEROPT_X, -1, 27}, {RV_OP_SUB, SUPEROPT_R, SUPEROPT_X, SUPEROPT_T, 0}}},
+    // mul x, -67108863: slli t, x, 26; sub r, x, t
+    {SSA_MUL, -67108863, 2, 2, {{RV_OP_SLLI, SUPEROPT_T, SUPEROPT_X, -1, 26}, {RV_OP_SUB, SUPEROPT_R, SUPEROPT_X, SUPEROPT_T, 0}}},
+    // mul x, -33554431: slli t, x, 25; sub r, x, t
+    {SSA_MUL, -33554431, 2, 2, {{RV_OP_SLLI, SUPEROPT_T, SUPEROPT_X, -1, 25}, {RV_OP_SUB, SUPEROPT_R, SUPEROPT_X, SUPEROPT_T, 0}}},
+    // mul x, -16777215: slli t, x, 24; sub r, x, t
+    {SSA_MUL, -16777215, 2, 2, {{RV_OP_SLLI, SUPEROPT_T, SUPEROPT_X, -1, 24}, {RV_OP_SUB, SUPEROPT_R, SUPEROPT_X, SUPEROPT_T, 0}}},
+    // mul x, -8388607: slli t, x, 23; sub r, x, t
+    {SSA_MUL, -8388607, 2, 2, {{RV_OP_SLLI, SUPEROPT_T, SUPEROPT_X, -1, 23}, {RV_OP_SUB, SUPEROPT_R, SUPEROPT_X, SUPEROPT_T, 0}}},
+    // mul x, -4194303: slli t, x, 22; sub r, x, t
+    {SSA_MUL, -4194303, 2, 2, {{RV_OP_SLLI, SUPEROPT_T, SUPEROPT_X, -1, 22}, {RV_OP_SUB, SUPEROPT_R, SUPEROPT_X, SUPEROPT_T, 0}}},
+    // mul x, -2097151: slli t, x, 21; sub r, x, t
+    {SSA_MUL, -2097151, 2, 2, {{RV_OP_SLLI, SUPEROPT_T, SUPEROPT_X, -1, 21}, {RV_OP_SUB, SUPEROPT_R, SUPEROPT_X, SUPEROPT_T, 0}}},
+    // mul x, -1048575: slli t, x, 20; sub r, x, t
+    {SSA_MUL, -1048575, 2, 2, {{RV_OP_SLLI, SUPEROPT_T, SUPEROPT_X, -1, 20}, {RV_OP_SUB, SUPEROPT_R, SUPEROPT_X, SUPEROPT_T, 0}}},
+    // mul x, -524287: slli t, x, 19; sub r, x, t
+    {SSA_MUL, -524287, 2, 2, {{RV_OP_SLLI, SUPEROPT_T, SUPEROPT_X, -1, 19}, {RV_OP_SUB, SUPEROPT_R, SUPEROPT_X, SUPEROPT_T, 0}}},
+    // mul x, -262143: slli t, x, 18; sub r, x, t
+    {SSA_MUL, -262143, 2, 2, {{RV_OP_SLLI, SUPEROPT_T, SUPEROPT_X, -1, 18}, {RV_OP_SUB, SUPEROPT_R, SUPEROPT_X, SUPEROPT_T, 0}}},
+    // mul x, -131071: slli t, x, 17; sub r, x, t
+    {SSA_MUL, -131071, 2, 2, {{RV_OP_SLLI, SUPEROPT_T, SUPEROPT_X, -1, 17}, {RV_OP_SUB, SUPEROPT_R, SUPEROPT_X, SUPEROPT_T, 0}}},
+    // mul x, -65535: slli t, x, 16; sub r, x, t
+    {SSA_MUL, -65535, 2, 2, {{RV_OP_SLLI, SUPEROPT_T, SUPEROPT_X, -1, 16}, {RV_OP_SUB, SUPEROPT_R, SUPEROPT_X, SUPEROPT_T, 0}}},
+    // mul x, -32767: slli t, x, 15; sub r, x, t
+    {SSA_MUL, -32767, 2, 2, {{RV_OP_SLLI, SUPEROPT_T, SUPEROPT_X, -1, 15}, {RV_OP_SUB, SUPEROPT_R, SUPEROPT_X, SUPEROPT_T, 0}}},
+    // mul x, -16383: slli t, x, 14; sub r, x, t
+    {SSA_MUL, -16383, 2, 2, {{RV_OP_SLLI, SUPEROPT_T, SUPEROPT_X, -1, 14}, {RV_OP_SUB, SUPEROPT_R, SUPEROPT_X, SUPEROPT_T, 0}}},
+    // mul x, -8191: slli t, x, 13; sub r, x, t
+    {SSA_MUL, -8191, 2, 2, {{RV_OP_SLLI, SUPEROPT_T, SUPEROPT_X, -1, 13}, {RV_OP_SUB, SUPEROPT_R, SUPEROPT_X, SUPEROPT_T, 0}}},
+    // mul x, -4095: slli t, x, 12; sub r, x, t
+    {SSA_MUL, -4095, 2, 2, {{RV_OP_SLLI, SUPEROPT_T, SUPEROPT_X, -1, 12}, {RV_OP_SUB, SUPEROPT_R, SUPEROPT_X, SUPEROPT_T, 0}}},
+    // mul x, -1: sub r, zero, x
+    {SSA_MUL, -1, 1, 1, {{RV_OP_SUB, SUPEROPT_R, SUPEROPT_ZERO, SUPEROPT_X, 0}}},
+    // mul x, 2049: slli t, x, 11; add r, x, t
+    {SSA_MUL, 2049, 2, 2, {{RV_OP_SLLI, SUPEROPT_T, SUPEROPT_X, -1, 11}, {RV_OP_ADD, SUPEROPT_R, SUPEROPT_X, SUPEROPT_T, 0}}},
+    // mul x, 4095: slli t, x, 12; sub r, t, x
+    {SSA_MUL, 4095, 2, 2, {{RV_OP_SLLI, SUPEROPT_T, SUPEROPT_X, -1, 12}, {RV_OP_SUB, SUPEROPT_R, SUPEROPT_T, SUPEROPT_X, 0}}},
+    // mul x, 4097: slli t, x, 12; add r, x, t
+    {SSA_MUL, 4097, 2, 2, {{RV_OP_SLLI, SUPEROPT_T, SUPEROPT_X, -1, 12}, {RV_OP_ADD, SUPEROPT_R, SUPEROPT_X, SUPEROPT_T, 0}}},
+    // mul x, 8191: slli t, x, 13; sub r, t, x
+    {SSA_MUL, 8191, 2, 2, {{RV_OP_SLLI, SUPEROPT_T, SUPEROPT_X, -1, 13}, {RV_OP_SUB, SUPEROPT_R, SUPEROPT_T, SUPEROPT_X, 0}}},
+    // mul x, 8193: slli t, x, 13; add r, x, t
+    {SSA_MUL, 8193, 2, 2, {{RV_OP_SLLI, SUPEROPT_T, SUPEROPT_X, -1, 13}, {RV_OP_ADD, SUPEROPT_R, SUPEROPT_X, SUPEROPT_T, 0}}},
+    // mul x, 16383: slli t, x, 14; sub r, t, x
+    {SSA_MUL, 16383, 2, 2, {{RV_OP_SLLI, SUPEROPT_T, SUPEROPT_X, -1, 14}, {RV_OP_SUB, SUPEROPT_R, SUPEROPT_T, SUPEROPT_X, 0}}},
+    // mul x, 16385: slli t, x, 14; add r, x, t
+    {SSA_MUL, 16385, 2, 2, {{RV_OP_SLLI, SUPEROPT_T, SUPEROPT_X, -1, 14}, {RV_OP_ADD, SUPEROPT_R, SUPEROPT_X, SUPEROPT_T, 0}}},
+    // mul x, 32767: slli t, x, 15; sub r, t, x
+    {SSA_MUL, 32767, 2, 2, {{RV_OP_SLLI, SUPEROPT_T, SUPEROPT_X, -1, 15}, {RV_OP_SUB, SUPEROPT_R, SUPEROPT_T, SUPEROPT_X, 0}}},
+    // mul x, 32769: slli t, x, 15; add r, x, t
+    {SSA_MUL, 32769, 2, 2, {{RV_OP_SLLI, SUPEROPT_T, SUPEROPT_X, -1, 15}, {RV_OP_ADD, SUPEROPT_R, SUPEROPT_X, SUPEROPT_T, 0}}},
+    // mul x, 65535: slli t, x, 16; sub r, t, x
+    {SSA_MUL, 65535, 2, 2, {{RV_OP_SLLI, SUPEROPT_T, SUPEROPT_X, -1, 16}, {RV_OP_SUB, SUPEROPT_R, SUPEROPT_T, SUPEROPT_X, 0}}},
+    // mul x, 65537: slli t, x, 16; add r, x, t
+    {SSA_MUL, 65537, 2, 2, {{RV_OP_SLLI, SUPEROPT_T, SUPEROPT_X, -1, 16}, {RV_OP_ADD, SUPEROPT_R, SUPEROPT_X, SUPEROPT_T, 0}}},
+    // mul x, 131071: slli t, x, 17; sub r, t, x
+    {SSA_MUL, 131071, 2, 2, {{RV_OP_SLLI, SUPEROPT_T, SUPEROPT_X, -1, 17}, {RV_OP_SUB, SUPEROPT_R, SUPEROPT_T, SUPEROPT_X, 0}}},
+    // mul x, 131073: slli t, x, 17; add r, x, t
+    {SSA_MUL, 131073, 2, 2, {{RV_OP_SLLI, SUPEROPT_T, SUPEROPT_X, -1, 17}, {RV_OP_ADD, SUPEROPT_R, SUPEROPT_X, SUPEROPT_T, 0}}},
+    // mul x, 262143: slli t, x, 18; sub r, t, x
+    {SSA_MUL, 262143, 2, 2, {{RV_OP_SLLI, SUPEROPT_T, SUPEROPT_X, -1, 18}, {RV_OP_SUB, SUPEROPT_R, SUPEROPT_T, SUPEROPT_X, 0}}},
+    // mul x, 262145: slli t, x, 18; add r, x, t
+    {SSA_MUL, 262145, 2, 2, {{RV_OP_SLLI, SUPEROPT_T, SUPEROPT_X, -1, 18}, {RV_OP_ADD, SUPEROPT_R, SUPEROPT_X, SUPEROPT_T, 0}}},
+    // mul x, 524287: slli t, x, 19; sub r, t, x
+    {SSA_MUL, 524287, 2, 2, {{RV_OP_SLLI, SUPEROPT_T, SUPEROPT_X, -1, 19}, {RV_OP_SUB, SUPEROPT_R, SUPEROPT_T, SUPEROPT_X, 0}}},
+    // mul x, 524289: slli t, x, 19; add r, x, t
+    {SSA_MUL, 524289, 2, 2, {{RV_OP_SLLI, SUPEROPT_T, SUPEROPT_X, -1, 19}, {RV_OP_ADD, SUPEROPT_R, SUPEROPT_X, SUPEROPT_T, 0}}},
+    // mul x, 1048575: slli t, x, 20; sub r, t, x
+    {SSA_MUL, 1048575, 2, 2, {{RV_OP_SLLI, SUPEROPT_T, SUPEROPT_X, -1, 20}, {RV_OP_SUB, SUPEROPT_R, SUPEROPT_T, SUPEROPT_X, 0}}},
+    // mul x, 1048577: slli t, x, 20; add r, x, t
+    {SSA_MUL, 1048577, 2, 2, {{RV_OP_SLLI, SUPEROPT_T, SUPEROPT_X, -1, 20}, {RV_OP_ADD, SUPEROPT_R, SUPEROPT_X, SUPEROPT_T, 0}}},
+    // mul x, 2097151: slli t, x, 21; sub r, t, x
+    {SSA_MUL, 2097151, 2, 2, {{RV_OP_SLLI, SUPEROPT_T, SUPEROPT_X, -1, 21}, {RV_OP_SUB, SUPEROPT_R, SUPEROPT_T, SUPEROPT_X, 0}}},
+    // mul x, 2097153: slli t, x, 21; add r, x, t
+    {SSA_MUL, 2097153, 2, 2, {{RV_OP_SLLI, SUPEROPT_T, SUPEROPT_X, -1, 21}, {RV_OP_ADD, SUPEROPT_R, SUPEROPT_X, SUPEROPT_T, 0}}},
+    // mul x, 4194303: slli t, x, 22; sub r, t, x
+    {SSA_MUL, 4194303, 2, 2, {{RV_OP_SLLI, SUPEROPT_T, SUPEROPT_X, -1, 22}, {RV_OP_SUB, SUPEROPT_R, SUPEROPT_T, SUPEROPT_X, 0}}},
+    // mul x, 4194305: slli t, x, 22; add r, x, t
+    {SSA_MUL, 4194305, 2, 2, {{RV_OP_SLLI, SUPEROPT_T, SUPEROPT_X, -1, 22}, {RV_OP_ADD, SUPEROPT_R, SUPEROPT_X, SUPEROPT_T, 0}}},
+    // mul x, 8388607: slli t, x, 23; sub r, t, x
+    {SSA_MUL, 8388607, 2, 2, {{RV_OP_SLLI, SUPEROPT_T, SUPEROPT_X, -1, 23}, {RV_OP_SUB, SUPEROPT_R, SUPEROPT_T, SUPEROPT_X, 0}}},
+    // mul x, 8388609: slli t, x, 23; add r, x, t
+    {SSA_MUL, 8388609, 2, 2, {{RV_OP_SLLI, SUPEROPT_T, SUPEROPT_X, -1, 23}, {RV_OP_ADD, SUPEROPT_R, SUPEROPT_X, SUPEROPT_T, 0}}},
+    // mul x, 16777215: slli t, x, 24; sub r, t, x
+    {SSA_MUL, 16777215, 2, 2, {{RV_OP_SLLI, SUPEROPT_T, SUPEROPT_X, -1, 24}, {RV_OP_SUB, SUPEROPT_R, SUPEROPT_T, SUPEROPT_X, 0}}},
+    // mul x, 16777217: slli t, x, 24; add r, x, t
+    {SSA_MUL, 16777217, 2, 2, {{RV_OP_SLLI, SUPEROPT_T, SUPEROPT_X, -1, 24}, {RV_OP_ADD, SUPEROPT_R, SUPEROPT_X, SUPEROPT_T, 0}}},
+    // mul x, 33554431: slli t, x, 25; sub r, t, x
+    {SSA_MUL, 33554431, 2, 2, {{RV_OP_SLLI, SUPEROPT_T, SUPEROPT_X, -1, 25}, {RV_OP_SUB, SUPEROPT_R, SUPEROPT_T, SUPEROPT_X, 0}}},
+    // mul x, 33554433: slli t, x, 25; add r, x, t
+    {SSA_MUL, 33554433, 2, 2, {{RV_OP_SLLI, SUPEROPT_T, SUPEROPT_X, -1, 25}, {RV_OP_ADD, SUPEROPT_R, SUPEROPT_X, SUPEROPT_T, 0}}},
+    // mul x, 67108863: slli t, x, 26; sub r, t, x
+    {SSA_MUL, 67108863, 2, 2, {{RV_OP_SLLI, SUPEROPT_T, SUPEROPT_X, -1, 26}, {RV_OP_SUB, SUPEROPT_R, SUPEROPT_T, SUPEROPT_X, 0}}},
+    // mul x, 67108865: slli t, x, 26; add r, x, t
+    {SSA_MUL, 67108865, 2, 2, {{RV_OP_SLLI, SUPEROPT_T, SUPEROPT_X, -1, 26}, {RV_OP_ADD, SUPEROPT_R, SUPEROPT_X, SUPEROPT_T, 0}}},
+    // mul x, 134217727: slli t, x, 27; sub r, t, x
+    {SSA_MUL, 134217727, 2, 2, {{RV_OP_SLLI, SUPEROPT_T, SUPEROPT_X, -1, 27}, {RV_OP_SUB, SUPEROPT_R, SUPEROPT_T, SUPEROPT_X, 0}}},
+    // mul x, 134217729: slli t, x, 27; add r, x, t
+    {SSA_MUL, 134217729, 2, 2, {{RV_OP_SLLI, SUPEROPT_T, SUPEROPT_X, -1, 27}, {RV_OP_ADD, SUPEROPT_R, SUPEROPT_X, SUPEROPT_T, 0}}},
+    // mul x, 268435455: slli t, x, 28; sub r, t, x
+    {SSA_MUL, 268435455, 2, 2, {{RV_OP_SLLI, SUPEROPT_T, SUPEROPT_X, -1, 28}, {RV_OP_SUB, SUPEROPT_R, SUPEROPT_T, SUPEROPT_X, 0}}},
+    // mul x, 268435457: slli t, x, 28; add r, x, t
+    {SSA_MUL, 268435457, 2, 2, {{RV_OP_SLLI, SUPEROPT_T, SUPEROPT_X, -1, 28}, {RV_OP_ADD, SUPEROPT_R, SUPEROPT_X, SUPEROPT_T, 0}}},
+    // mul x, 536870911: slli t, x, 29; sub r, t, x
+    {SSA_MUL, 536870911, 2, 2, {{RV_OP_SLLI, SUPEROPT_T, SUPEROPT_X, -1, 29}, {RV_OP_SUB, SUPEROPT_R, SUPEROPT_T, SUPEROPT_X, 0}}},
+    // mul x, 536870913: slli t, x, 29; add r, x, t
+    {SSA_MUL, 536870913, 2, 2, {{RV_OP_SLLI, SUPEROPT_T, SUPEROPT_X, -1, 29}, {RV_OP_ADD, SUPEROPT_R, SUPEROPT_X, SUPEROPT_T, 0}}},
+    // mul x, 1073741823: slli t, x, 30; sub r, t, x
+    {SSA_MUL, 1073741823, 2, 2, {{RV_OP_SLLI, SUPEROPT_T, SUPEROPT_X, -1, 30}, {RV_OP_SUB, SUPEROPT_R, SUPEROPT_T, SUPEROPT_X, 0}}},
+    // mul x, 1073741825: slli t, x, 30; add r, x, t
+    {SSA_MUL, 1073741825, 2, 2, {{RV_OP_SLLI, SUPEROPT_T, SUPEROPT_X, -1, 30}, {RV_OP_ADD, SUPEROPT_R, SUPEROPT_X, SUPEROPT_T, 0}}},
+    // mul x, 2147483647: slli t, x, 31; sub r, t, x
+    {SSA_MUL, 2147483647, 2, 2, {{RV_OP_SLLI, SUPEROPT_T, SUPEROPT_X, -1, 31}, {RV_OP_SUB, SUPEROPT_R, SUPEROPT_T, SUPEROPT_X, 0}}},
+    // div x, -1: sub r, zero, x
+    {SSA_DIV, -1, 1, 1, {{RV_OP_SUB, SUPEROPT_R, SUPEROPT_ZERO, SUPEROPT_X, 0}}},
+    // div x, 1: mv r, x
+    {SSA_DIV, 1, 1, 1, {{RV_OP_MV, SUPEROPT_R, SUPEROPT_X, -1, 0}}},
+    // mod x, -1: li r, 0
+    {SSA_MOD, -1, 1, 1, {{RV_OP_LI, SUPEROPT_R, -1, -1, 0}}},
+    // mod x, 1: li r, 0
+    {SSA_MOD, 1, 1, 1, {{RV_OP_LI, SUPEROPT_R, -1, -1, 0}}},
+    // mod x, 2048: li t, -2048; rem r, x, t
+    {SSA_MOD, 2048, 2, 17, {{RV_OP_LI, SUPEROPT_T, -1, -1, -2048}, {RV_OP_REM, SUPEROPT_R, SUPEROPT_X, SUPEROPT_T, 0}}},
+};
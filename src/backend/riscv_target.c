@@ -0,0 +1,221 @@
+#include "riscv_target.h"
+#include <assert.h>
+#include <string.h>
+
+static const RiscvTarget targets[] = {
+    {"rv32", 32, 4, false, RV_OP_LW, RV_OP_SW},
+    {"rv64", 64, 8, true,  RV_OP_LD, RV_OP_SD},
+};
+#define TARGET_COUNT ((int)(sizeof(targets) / sizeof(targets[0])))
+
+const RiscvTarget *riscv_target_lookup(const char *name) {
+    for (int i = 0; i < TARGET_COUNT; i++) {
+        if (strcmp(targets[i].name, name) == 0) return &targets[i];
+    }
+    return NULL;
+}
+
+const RiscvTarget *riscv_target_default(void) {
+    return &targets[0];
+}
+
+RiscvOpcode riscv_target_op(const RiscvTarget *target, RiscvOpcode op) {
+    RiscvOpcode word_op = riscv_op_info(op)->word_op;
+    return target->word_ops && word_op != RV_OP_NONE ? word_op : op;
+}
+
+// ========================================
+// C 扩展压缩编码
+// ========================================
+
+typedef enum {
+    C_FMT_RI,       // c.op rd, imm
+    C_FMT_RR,       // c.op rd, rs
+    C_FMT_MEM,      // c.op reg, imm(base)
+    C_FMT_SPN,      // c.addi4spn rd, sp, imm
+    C_FMT_R,        // c.jr rs
+} CompressedFormat;
+
+typedef struct {
+    const char *name;
+    CompressedFormat format;
+    RiscvReg r1;        // rd（存储指令为源寄存器）
+    RiscvReg r2;        // rs / 基址寄存器
+    int32_t imm;
+} CompressedInst;
+
+static bool fits_signed(int32_t imm, int bits) {
+    return imm >= -(1 << (bits - 1)) && imm < (1 << (bits - 1));
+}
+
+// 压缩寄存器 x8 ~ x15（s0, s1, a0 ~ a5），三位编码的指令只能使用这些寄存器
+static bool is_creg(RiscvReg reg) {
+    return reg >= RV_REG_S0 && reg <= RV_REG_A5;
+}
+
+// 偏移是否为 scale 的非负整数倍且不超过 max
+static bool fits_scaled(int32_t offset, int scale, int max) {
+    return offset >= 0 && offset <= max && offset % scale == 0;
+}
+
+static bool make(CompressedInst *out, const char *name, CompressedFormat format, RiscvReg r1, RiscvReg r2, int32_t imm) {
+    out->name = name;
+    out->format = format;
+    out->r1 = r1;
+    out->r2 = r2;
+    out->imm = imm;
+    return true;
+}
+
+// rd = rd op rs 形式的两操作数压缩指令；commutative 时 rd == rs2 也可交换操作数
+static bool compress_two_operand(const RiscvInst *inst, const char *name, bool commutative, bool creg_only,
+                                 CompressedInst *out) {
+    RiscvReg other = RV_REG_NONE;
+    if (inst->rd == inst->rs1) other = inst->rs2;
+    else if (commutative && inst->rd == inst->rs2) other = inst->rs1;
+    if (other == RV_REG_NONE || inst->rd == RV_REG_ZERO || other == RV_REG_ZERO) return false;
+    if (creg_only && (!is_creg(inst->rd) || !is_creg(other))) return false;
+    return make(out, name, C_FMT_RR, inst->rd, other, 0);
+}
+
+// 访存指令：以 sp 为基址时用 *sp 形式，否则两个寄存器都须为压缩寄存器
+static bool compress_mem(const RiscvInst *inst, RiscvReg reg, const char *sp_name, const char *name,
+                         int scale, CompressedInst *out) {
+    if (inst->rs1 == RV_REG_SP) {
+        if (!fits_scaled(inst->imm, scale, 64 * scale - scale)) return false;
+        // c.lwsp / c.ldsp 的目的寄存器不能为 x0
+        if (riscv_op_info(inst->op)->format == RV_FMT_LOAD && reg == RV_REG_ZERO) return false;
+        return make(out, sp_name, C_FMT_MEM, reg, RV_REG_SP, inst->imm);
+    }
+    if (!is_creg(reg) || !is_creg(inst->rs1) || !fits_scaled(inst->imm, scale, 32 * scale - scale)) return false;
+    return make(out, name, C_FMT_MEM, reg, inst->rs1, inst->imm);
+}
+
+static bool compress(const RiscvInst *inst, const RiscvTarget *target, CompressedInst *out) {
+    if (inst->frame_slot >= 0) return false;
+    bool rv64 = target->xlen == 64;
+    switch (inst->op) {
+        case RV_OP_LI:
+            if (inst->rd == RV_REG_ZERO || !fits_signed(inst->imm, 6)) return false;
+            return make(out, "c.li", C_FMT_RI, inst->rd, RV_REG_NONE, inst->imm);
+        case RV_OP_LUI: {
+            // c.lui 的立即数为符号扩展的 6 位非零值（以 20 位形式书写）
+            int32_t high = (int32_t)((uint32_t)inst->imm << 12) >> 12;
+            if (inst->rd == RV_REG_ZERO || inst->rd == RV_REG_SP || high == 0 || !fits_signed(high, 6)) return false;
+            return make(out, "c.lui", C_FMT_RI, inst->rd, RV_REG_NONE, inst->imm);
+        }
+        case RV_OP_SLLI:
+            if (inst->rd == RV_REG_ZERO || inst->rd != inst->rs1 || inst->imm == 0) return false;
+            return make(out, "c.slli", C_FMT_RI, inst->rd, RV_REG_NONE, inst->imm);
+        case RV_OP_SRLI:
+        case RV_OP_SRAI:
+            if (!is_creg(inst->rd) || inst->rd != inst->rs1 || inst->imm == 0) return false;
+            return make(out, inst->op == RV_OP_SRLI ? "c.srli" : "c.srai", C_FMT_RI, inst->rd, RV_REG_NONE, inst->imm);
+        case RV_OP_ANDI:
+            if (!is_creg(inst->rd) || inst->rd != inst->rs1 || !fits_signed(inst->imm, 6)) return false;
+            return make(out, "c.andi", C_FMT_RI, inst->rd, RV_REG_NONE, inst->imm);
+        case RV_OP_MV:
+            if (inst->rd == RV_REG_ZERO) return false;
+            if (inst->rs1 == RV_REG_ZERO) return make(out, "c.li", C_FMT_RI, inst->rd, RV_REG_NONE, 0);
+            return make(out, "c.mv", C_FMT_RR, inst->rd, inst->rs1, 0);
+        case RV_OP_ADDI:
+            if (inst->rd == RV_REG_ZERO) return false;
+            if (inst->rd == RV_REG_SP && inst->rs1 == RV_REG_SP) {
+                if (inst->imm == 0 || inst->imm % 16 != 0 || !fits_signed(inst->imm, 10)) return false;
+                return make(out, "c.addi16sp", C_FMT_RI, RV_REG_SP, RV_REG_NONE, inst->imm);
+            }
+            if (inst->rs1 == RV_REG_SP) {
+                if (!is_creg(inst->rd) || inst->imm == 0 || !fits_scaled(inst->imm, 4, 1020)) return false;
+                return make(out, "c.addi4spn", C_FMT_SPN, inst->rd, RV_REG_SP, inst->imm);
+            }
+            if (inst->imm == 0 && inst->rs1 != RV_REG_ZERO) return make(out, "c.mv", C_FMT_RR, inst->rd, inst->rs1, 0);
+            if (inst->rd != inst->rs1 || inst->imm == 0 || !fits_signed(inst->imm, 6)) return false;
+            return make(out, "c.addi", C_FMT_RI, inst->rd, RV_REG_NONE, inst->imm);
+        case RV_OP_ADDIW:
+            if (inst->rd == RV_REG_ZERO || inst->rd != inst->rs1 || !fits_signed(inst->imm, 6)) return false;
+            return make(out, "c.addiw", C_FMT_RI, inst->rd, RV_REG_NONE, inst->imm);
+        case RV_OP_ADD:
+            // 一侧为 x0 时即为 mv
+            if (inst->rd != RV_REG_ZERO && (inst->rs1 == RV_REG_ZERO) != (inst->rs2 == RV_REG_ZERO)) {
+                RiscvReg src = inst->rs1 == RV_REG_ZERO ? inst->rs2 : inst->rs1;
+                return make(out, "c.mv", C_FMT_RR, inst->rd, src, 0);
+            }
+            return compress_two_operand(inst, "c.add", true, false, out);
+        case RV_OP_SUB:
+            return compress_two_operand(inst, "c.sub", false, true, out);
+        case RV_OP_XOR:
+            return compress_two_operand(inst, "c.xor", true, true, out);
+        case RV_OP_OR:
+            return compress_two_operand(inst, "c.or", true, true, out);
+        case RV_OP_AND:
+            return compress_two_operand(inst, "c.and", true, true, out);
+        case RV_OP_ADDW:
+            return rv64 && compress_two_operand(inst, "c.addw", true, true, out);
+        case RV_OP_SUBW:
+            return rv64 && compress_two_operand(inst, "c.subw", false, true, out);
+        case RV_OP_LW:
+            return compress_mem(inst, inst->rd, "c.lwsp", "c.lw", 4, out);
+        case RV_OP_SW:
+            return compress_mem(inst, inst->rs2, "c.swsp", "c.sw", 4, out);
+        case RV_OP_LD:
+            return rv64 && compress_mem(inst, inst->rd, "c.ldsp", "c.ld", 8, out);
+        case RV_OP_SD:
+            return rv64 && compress_mem(inst, inst->rs2, "c.sdsp", "c.sd", 8, out);
+        case RV_OP_RET:
+            return make(out, "c.jr", C_FMT_R, RV_REG_RA, RV_REG_NONE, 0);
+        default:
+            return false;
+    }
+}
+
+int riscv_inst_size(const RiscvInst *inst, const RiscvTarget *target, bool compress_enabled) {
+    CompressedInst c;
+    if (compress_enabled && compress(inst, target, &c)) return 2;
+    // call 伪指令展开为 auipc + jalr，la 展开为 auipc + addi
+    if (inst->op == RV_OP_CALL || inst->op == RV_OP_LA) return 8;
+    if (inst->op == RV_OP_LI && !riscv_imm12_fits(inst->imm)) {
+        // 汇编器将 li 展开为 lui 装入高 20 位，低 12 位非零时再接一条 addi(w)；
+        // 开启压缩时两者在立即数足够小时也会被压缩为 c.lui / c.addi(w)
+        int32_t low = (int32_t)((uint32_t)inst->imm << 20) >> 20;
+        int32_t high = (int32_t)((uint32_t)inst->imm - (uint32_t)low) >> 12;
+        bool c_lui = compress_enabled && inst->rd != RV_REG_SP && high != 0 && fits_signed(high, 6);
+        int size = c_lui ? 2 : 4;
+        if (low != 0) size += compress_enabled && fits_signed(low, 6) ? 2 : 4;
+        return size;
+    }
+    return 4;
+}
+
+int riscv_emit_inst_for(FILE *output, const RiscvInst *inst, const RiscvTarget *target, bool compress_enabled) {
+    CompressedInst c;
+    if (!compress_enabled || !compress(inst, target, &c)) {
+        riscv_emit_inst(output, inst);
+        return riscv_inst_size(inst, target, compress_enabled);
+    }
+    switch (c.format) {
+        case C_FMT_RI:
+            fprintf(output, "  %s %s, %d\n", c.name, riscv_reg_name(c.r1), c.imm);
+            break;
+        case C_FMT_RR:
+            fprintf(output, "  %s %s, %s\n", c.name, riscv_reg_name(c.r1), riscv_reg_name(c.r2));
+            break;
+        case C_FMT_MEM:
+            fprintf(output, "  %s %s, %d(%s)\n", c.name, riscv_reg_name(c.r1), c.imm, riscv_reg_name(c.r2));
+            break;
+        case C_FMT_SPN:
+            fprintf(output, "  %s %s, %s, %d\n", c.name, riscv_reg_name(c.r1), riscv_reg_name(c.r2), c.imm);
+            break;
+        case C_FMT_R:
+            fprintf(output, "  %s %s\n", c.name, riscv_reg_name(c.r1));
+            break;
+    }
+    return 2;
+}
+
+int riscv_emit_buffer_for(FILE *output, const RiscvInstBuffer *buf, const RiscvTarget *target, bool compress_enabled) {
+    int bytes = 0;
+    for (int i = 0; i < buf->len; i++) {
+        bytes += riscv_emit_inst_for(output, &buf->insts[i], target, compress_enabled);
+    }
+    return bytes;
+}
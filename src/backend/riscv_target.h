@@ -0,0 +1,50 @@
+#pragma once
+
+#include <stdbool.h>
+#include <stdio.h>
+#include "riscv_inst.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * 目标描述
+ * 指令选择与栈帧中与目标相关的选择都经由此表，而不是直接写死助记符
+ */
+typedef struct {
+    const char *name;           // 目标名称（-target 参数）
+    int xlen;                   // 通用寄存器位宽
+    int reg_size;               // 保存一个寄存器所需字节数
+    bool word_ops;              // 32 位值运算是否使用 *w 指令（RV64）
+    RiscvOpcode load_reg;       // 恢复整个寄存器（lw / ld）
+    RiscvOpcode store_reg;      // 保存整个寄存器（sw / sd）
+} RiscvTarget;
+
+// 按名称查找目标（rv32 / rv64），不存在时返回 NULL
+const RiscvTarget *riscv_target_lookup(const char *name);
+
+// 默认目标 rv32
+const RiscvTarget *riscv_target_default(void);
+
+// 对 32 位值执行 op 时在该目标上实际使用的指令（RV64 上 add → addw 等）
+RiscvOpcode riscv_target_op(const RiscvTarget *target, RiscvOpcode op);
+
+/**
+ * 指令编码后的字节数
+ * compress 为 true 时可用 C 扩展压缩的指令计 2 字节；li 按展开后的 lui / addi 计算
+ */
+int riscv_inst_size(const RiscvInst *inst, const RiscvTarget *target, bool compress);
+
+/**
+ * 输出一条指令，compress 为 true 且操作数允许时输出 C 扩展压缩形式（c.li、c.mv、c.addi、c.add 等）
+ * @return 编码字节数
+ */
+int riscv_emit_inst_for(FILE *output, const RiscvInst *inst, const RiscvTarget *target, bool compress);
+
+// 输出整个缓冲区，返回编码字节数
+int riscv_emit_buffer_for(FILE *output, const RiscvInstBuffer *buf, const RiscvTarget *target, bool compress);
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,17 @@
+#include "diag.h"
+
+static _Thread_local FILE *thread_out = NULL;
+static _Thread_local FILE *thread_err = NULL;
+
+FILE *diag_out(void) {
+    return thread_out ? thread_out : stdout;
+}
+
+FILE *diag_err(void) {
+    return thread_err ? thread_err : stderr;
+}
+
+void diag_redirect(FILE *out, FILE *err) {
+    thread_out = out;
+    thread_err = err;
+}
@@ -0,0 +1,26 @@
+#pragma once
+
+#include <stdio.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * 编译过程的输出流
+ * 诊断信息、各种报告（-stats、-inline-stats 等）与 -ast 的输出都写到这里，默认为进程的 stdout / stderr；
+ * 编译服务为每个请求把当前线程的输出流换成内存流，随响应发回客户端，并发的请求互不交错
+ */
+
+// 当前线程的普通输出，默认为 stdout
+FILE *diag_out(void);
+
+// 当前线程的诊断与报告输出，默认为 stderr
+FILE *diag_err(void);
+
+// 设置当前线程的输出流，传 NULL 恢复为 stdout / stderr
+void diag_redirect(FILE *out, FILE *err);
+
+#ifdef __cplusplus
+}
+#endif
@@ -1,65 +1,92 @@
 #include "ast.h"
+#include "diag.h"
+
+// 以逗号分隔打印列表中的节点
+static void list_dump(const ASTList *list) {
+    for (int i = 0; i < list->count; i++) {
+        if (i > 0) fprintf(diag_out(), ", ");
+        list->items[i]->dump(list->items[i]);
+    }
+}
 
 static void comp_unit_dump(const BaseAST *self) {
     const CompUnitAST *comp_unit = (const CompUnitAST *)self;
-    printf("CompUnitAST { ");
-    comp_unit->func_def->dump(comp_unit->func_def);
-    printf(" }");
+    fprintf(diag_out(), "CompUnitAST { ");
+    list_dump(&comp_unit->func_defs);
+    fprintf(diag_out(), " }");
 }
 
 static void func_def_dump(const BaseAST *self) {
     const FuncDefAST *func_def = (const FuncDefAST *)self;
-    printf("FuncDefAST { ");
+    fprintf(diag_out(), "FuncDefAST { ");
     func_def->func_type->dump(func_def->func_type);
-    printf(", %s, ", func_def->ident);
+    fprintf(diag_out(), ", %s, ", func_def->ident);
+    if (func_def->params.count > 0) {
+        fprintf(diag_out(), "(");
+        list_dump(&func_def->params);
+        fprintf(diag_out(), "), ");
+    }
     func_def->block->dump(func_def->block);
-    printf(" }");
+    fprintf(diag_out(), " }");
+}
+
+static void func_param_dump(const BaseAST *self) {
+    fprintf(diag_out(), "int %s", ((const FuncParamAST *)self)->ident);
 }
 
 static void func_type_dump(const BaseAST *self) {
-    printf("FuncTypeAST { int }");
+    fprintf(diag_out(), "FuncTypeAST { int }");
 }
 
 static void block_dump(const BaseAST *self) {
     const BlockAST *block = (const BlockAST *)self;
-    printf("BlockAST { ");
+    fprintf(diag_out(), "BlockAST { ");
     block->stmt->dump(block->stmt);
-    printf(" }");
+    fprintf(diag_out(), " }");
 }
 
 static void stmt_dump(const BaseAST *self) {
     const StmtAST *stmt = (const StmtAST *)self;
-    printf("StmtAST { ");
+    fprintf(diag_out(), "StmtAST { ");
     stmt->expr->dump(stmt->expr);
-    printf(" }");
+    fprintf(diag_out(), " }");
 }
 
 static void number_dump(const BaseAST *self) {
     const NumberAST *number = (const NumberAST *)self;
-    printf("%d", number->value);
+    fprintf(diag_out(), "%d", number->value);
 }
 
 static void unary_dump(const BaseAST *self) {
     const UnaryAST *unary = (const UnaryAST *)self;
-    printf("UnaryAST { %c, ", unary->op);
+    fprintf(diag_out(), "UnaryAST { %c, ", unary->op);
     unary->operand->dump(unary->operand);
-    printf(" }");
+    fprintf(diag_out(), " }");
 }
 
 static void binary_dump(const BaseAST *self) {
     const BinaryAST *binary = (const BinaryAST *)self;
-    printf("BinaryAST { ");
+    fprintf(diag_out(), "BinaryAST { ");
     binary->left->dump(binary->left);
-    printf(" %c ", binary->op);
+    fprintf(diag_out(), " %c ", binary->op);
     binary->right->dump(binary->right);
-    printf(" }");
+    fprintf(diag_out(), " }");
+}
+
+static void lval_dump(const BaseAST *self) {
+    fprintf(diag_out(), "LValAST { %s }", ((const LValAST *)self)->ident);
+}
+
+static void call_dump(const BaseAST *self) {
+    const CallAST *call = (const CallAST *)self;
+    fprintf(diag_out(), "CallAST { %s(", call->ident);
+    list_dump(&call->args);
+    fprintf(diag_out(), ") }");
 }
 
 static void comp_unit_destroy(BaseAST *self) {
     CompUnitAST *comp_unit = (CompUnitAST *)self;
-    if (comp_unit->func_def) {
-        comp_unit->func_def->destroy(comp_unit->func_def);
-    }
+    ast_list_destroy(&comp_unit->func_defs);
     free(comp_unit);
 }
 
@@ -71,12 +98,19 @@ static void func_def_destroy(BaseAST *self) {
     if (func_def->ident) {
         free(func_def->ident);  // 释放函数名字符串
     }
+    ast_list_destroy(&func_def->params);
     if (func_def->block) {
         func_def->block->destroy(func_def->block);
     }
     free(func_def);
 }
 
+static void func_param_destroy(BaseAST *self) {
+    FuncParamAST *param = (FuncParamAST *)self;
+    free(param->ident);
+    free(param);
+}
+
 static void func_type_destroy(BaseAST *self) {
     free(self);
 }
@@ -114,26 +148,71 @@ static void binary_destroy(BaseAST *self) {
     free(binary);
 }
 
-BaseAST* create_comp_unit_ast(BaseAST *func_def) {
+static void lval_destroy(BaseAST *self) {
+    LValAST *lval = (LValAST *)self;
+    free(lval->ident);
+    free(lval);
+}
+
+static void call_destroy(BaseAST *self) {
+    CallAST *call = (CallAST *)self;
+    free(call->ident);
+    ast_list_destroy(&call->args);
+    free(call);
+}
+
+void ast_list_init(ASTList *list) {
+    list->items = NULL;
+    list->count = 0;
+    list->cap = 0;
+}
+
+void ast_list_push(ASTList *list, BaseAST *item) {
+    if (list->count == list->cap) {
+        list->cap = list->cap ? list->cap * 2 : 4;
+        list->items = realloc(list->items, list->cap * sizeof(BaseAST *));
+    }
+    list->items[list->count++] = item;
+}
+
+void ast_list_destroy(ASTList *list) {
+    for (int i = 0; i < list->count; i++) {
+        destroy_ast(list->items[i]);
+    }
+    free(list->items);
+    ast_list_init(list);
+}
+
+BaseAST* create_comp_unit_ast(ASTList func_defs) {
     CompUnitAST *comp_unit = malloc(sizeof(CompUnitAST));
     comp_unit->base.type = AST_COMP_UNIT;
     comp_unit->base.dump = comp_unit_dump;
     comp_unit->base.destroy = comp_unit_destroy;
-    comp_unit->func_def = func_def;
+    comp_unit->func_defs = func_defs;
     return (BaseAST *)comp_unit;
 }
 
-BaseAST* create_func_def_ast(BaseAST *func_type, char *ident, BaseAST *block) {
+BaseAST* create_func_def_ast(BaseAST *func_type, char *ident, ASTList params, BaseAST *block) {
     FuncDefAST *func_def = malloc(sizeof(FuncDefAST));
     func_def->base.type = AST_FUNC_DEF;
     func_def->base.dump = func_def_dump;
     func_def->base.destroy = func_def_destroy;
     func_def->func_type = func_type;
     func_def->ident = ident;  // 这里直接使用传入的字符串指针
+    func_def->params = params;
     func_def->block = block;
     return (BaseAST *)func_def;
 }
 
+BaseAST* create_func_param_ast(char *ident) {
+    FuncParamAST *param = malloc(sizeof(FuncParamAST));
+    param->base.type = AST_FUNC_PARAM;
+    param->base.dump = func_param_dump;
+    param->base.destroy = func_param_destroy;
+    param->ident = ident;
+    return (BaseAST *)param;
+}
+
 BaseAST* create_func_type_ast(void) {
     FuncTypeAST *func_type = malloc(sizeof(FuncTypeAST));
     func_type->base.type = AST_FUNC_TYPE;
@@ -200,5 +279,25 @@ BaseAST* create_binary_ast(char op, BaseAST *left, BaseAST *right) {
     b->op = op;
     b->left = left;
     b->right = right;
+    b->right_first = false;
     return (BaseAST *)b;
 }
+
+BaseAST* create_lval_ast(char *ident) {
+    LValAST *lval = malloc(sizeof(LValAST));
+    lval->base.type = AST_LVAL;
+    lval->base.dump = lval_dump;
+    lval->base.destroy = lval_destroy;
+    lval->ident = ident;
+    return (BaseAST *)lval;
+}
+
+BaseAST* create_call_ast(char *ident, ASTList args) {
+    CallAST *call = malloc(sizeof(CallAST));
+    call->base.type = AST_CALL;
+    call->base.dump = call_dump;
+    call->base.destroy = call_destroy;
+    call->ident = ident;
+    call->args = args;
+    return (BaseAST *)call;
+}
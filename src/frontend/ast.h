@@ -1,5 +1,6 @@
 #pragma once
 
+#include <stdbool.h>
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
@@ -12,7 +13,10 @@ typedef enum {
     AST_STMT,       // 语句
     AST_NUMBER,     // 数字字面量
     AST_UNARY,      // 一元表达式
-    AST_BINARY      // 二元表达式
+    AST_BINARY,     // 二元表达式
+    AST_FUNC_PARAM, // 函数形参
+    AST_LVAL,       // 左值（引用形参）
+    AST_CALL        // 函数调用
 } ASTNodeType;
 
 /**
@@ -29,28 +33,58 @@ struct BaseAST {
     void (*destroy)(BaseAST *self);
 };
 
+/**
+ * AST节点列表
+ * 用于编译单元中的函数定义、函数形参与调用实参
+ */
+typedef struct {
+    BaseAST **items;
+    int count;
+    int cap;
+} ASTList;
+
+/**
+ * 解析过程中逐个接收完成的函数定义（流式编译）
+ * func_def 返回 true 表示已接管该节点（负责释放），节点不再加入编译单元
+ */
+typedef struct {
+    bool (*func_def)(BaseAST *func_def, void *ctx);
+    void *ctx;
+} ASTSink;
+
 /**
  * 编译单元AST节点
- * CompUnit ::= FuncDef;
- * 表示整个程序的根节点，包含一个函数定义
+ * CompUnit ::= FuncDef {FuncDef};
+ * 表示整个程序的根节点，按出现顺序包含所有函数定义
  */
 typedef struct {
     BaseAST base;
-    BaseAST *func_def;  // 函数定义节点
+    ASTList func_defs;  // 函数定义节点
 } CompUnitAST;
 
 /**
  * 函数定义AST节点
- * FuncDef ::= FuncType IDENT "(" ")" Block;
- * 表示函数定义，包含函数类型、函数名和函数体
+ * FuncDef ::= FuncType IDENT "(" [FuncFParams] ")" Block;
+ * FuncFParams ::= FuncFParam {"," FuncFParam};
+ * 表示函数定义，包含函数类型、函数名、形参和函数体
  */
 typedef struct {
     BaseAST base;
     BaseAST *func_type;  // 函数返回类型
     char *ident;         // 函数名
+    ASTList params;      // 形参（FuncParamAST）
     BaseAST *block;      // 函数体代码块
 } FuncDefAST;
 
+/**
+ * 函数形参AST节点
+ * FuncFParam ::= "int" IDENT;
+ */
+typedef struct {
+    BaseAST base;
+    char *ident;         // 形参名
+} FuncParamAST;
+
 /**
  * 函数类型AST节点
  * FuncType ::= "int";
@@ -113,27 +147,66 @@ typedef struct {
     char op;           // '*', '/', '%', '+', '-'
     BaseAST *left;     // 左操作数
     BaseAST *right;    // 右操作数
+    bool right_first;  // 先求值右操作数（由求值顺序遍按 Sethi–Ullman 标号设置）
 } BinaryAST;
 
+/**
+ * 左值AST节点
+ * LVal ::= IDENT;
+ * 目前只能引用所在函数的形参
+ */
+typedef struct {
+    BaseAST base;
+    char *ident;
+} LValAST;
+
+/**
+ * 函数调用AST节点
+ * UnaryExp ::= IDENT "(" [FuncRParams] ")";
+ * FuncRParams ::= Exp {"," Exp};
+ */
+typedef struct {
+    BaseAST base;
+    char *ident;         // 被调用的函数名
+    ASTList args;        // 实参表达式
+} CallAST;
+
 // ========================================
 // AST节点创建函数
 // ========================================
 
+// 初始化空列表
+void ast_list_init(ASTList *list);
+
+// 追加一个节点，列表取得其所有权
+void ast_list_push(ASTList *list, BaseAST *item);
+
+// 销毁列表中的所有节点并释放列表
+void ast_list_destroy(ASTList *list);
+
 /**
  * 创建编译单元AST节点
- * @param func_def 函数定义节点
+ * @param func_defs 函数定义节点列表，所有权转移给新节点
  * @return 新创建的CompUnitAST节点
  */
-BaseAST* create_comp_unit_ast(BaseAST *func_def);
+BaseAST* create_comp_unit_ast(ASTList func_defs);
 
 /**
  * 创建函数定义AST节点
  * @param func_type 函数类型节点
  * @param ident 函数名字符串
+ * @param params 形参节点列表，所有权转移给新节点
  * @param block 函数体代码块节点
  * @return 新创建的FuncDefAST节点
  */
-BaseAST* create_func_def_ast(BaseAST *func_type, char *ident, BaseAST *block);
+BaseAST* create_func_def_ast(BaseAST *func_type, char *ident, ASTList params, BaseAST *block);
+
+/**
+ * 创建函数形参AST节点
+ * @param ident 形参名字符串
+ * @return 新创建的FuncParamAST节点
+ */
+BaseAST* create_func_param_ast(char *ident);
 
 /**
  * 创建函数类型AST节点
@@ -179,6 +252,21 @@ BaseAST* create_unary_ast(char op, BaseAST *operand);
  */
 BaseAST* create_binary_ast(char op, BaseAST *left, BaseAST *right);
 
+/**
+ * 创建左值AST节点
+ * @param ident 标识符字符串
+ * @return 新创建的LValAST节点
+ */
+BaseAST* create_lval_ast(char *ident);
+
+/**
+ * 创建函数调用AST节点
+ * @param ident 被调用的函数名
+ * @param args 实参表达式列表，所有权转移给新节点
+ * @return 新创建的CallAST节点
+ */
+BaseAST* create_call_ast(char *ident, ASTList args);
+
 // ========================================
 // AST操作函数
 // ========================================
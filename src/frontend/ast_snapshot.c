@@ -0,0 +1,606 @@
+#include "ast_snapshot.h"
+#include <assert.h>
+#include <fcntl.h>
+#include <stdint.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include "diag.h"
+
+#define SNAPSHOT_BYTE_ORDER 0x01020304u
+
+typedef struct {
+    char magic[4];              // AST_SNAPSHOT_MAGIC
+    uint16_t version;           // AST_SNAPSHOT_VERSION
+    uint16_t record_size;       // sizeof(SnapshotRecord)
+    uint32_t byte_order;        // SNAPSHOT_BYTE_ORDER，按写入方的字节序保存
+    uint32_t node_count;
+    uint32_t list_words;
+    uint32_t string_count;
+    uint32_t string_bytes;      // 字符串内容的字节数（不含对齐填充）
+    uint32_t reserved;
+} SnapshotHeader;
+
+/**
+ * 节点记录，各字段含义随节点类型而定：
+ *   CompUnit   c = 函数定义列表
+ *   FuncDef    a = 函数名，b = 代码块，c = 形参列表
+ *   FuncParam  a = 形参名
+ *   Block      b = 语句
+ *   Stmt       b = 表达式
+ *   Number     a = 值
+ *   Unary      op，b = 操作数
+ *   Binary     op，b = 左操作数，c = 右操作数
+ *   LVal       a = 标识符
+ *   Call       a = 函数名，c = 实参列表
+ * 名字为字符串表下标，列表为列表段中的偏移（单位为 u32）
+ */
+typedef struct {
+    uint8_t type;
+    uint8_t op;
+    uint16_t reserved;
+    uint32_t a;
+    uint32_t b;
+    uint32_t c;
+} SnapshotRecord;
+
+_Static_assert(sizeof(SnapshotHeader) == 32, "snapshot header must be 32 bytes");
+_Static_assert(sizeof(SnapshotRecord) == 16, "snapshot record must be 16 bytes");
+
+static uint32_t align4(uint32_t n) {
+    return (n + 3u) & ~3u;
+}
+
+// ========================================
+// 写入
+// ========================================
+
+typedef struct {
+    SnapshotRecord *records;
+    uint32_t record_count, record_cap;
+    uint32_t *lists;
+    uint32_t list_words, list_cap;
+    uint32_t *string_offsets;
+    uint32_t string_count, string_offset_cap;
+    char *strings;
+    uint32_t string_bytes, string_cap;
+    uint32_t *string_index;     // 开放寻址哈希表：字符串编号 + 1，0 表示空
+    uint32_t index_cap;
+} SnapshotWriter;
+
+// 保证数组至少能容纳 need 个元素
+static void *reserve(void *items, uint32_t *cap, uint32_t need, size_t elem_size) {
+    if (need <= *cap) return items;
+    uint32_t new_cap = *cap ? *cap : 64;
+    while (new_cap < need) new_cap *= 2;
+    items = realloc(items, (size_t)new_cap * elem_size);
+    assert(items);
+    *cap = new_cap;
+    return items;
+}
+
+static uint32_t hash_string(const char *s) {
+    uint32_t h = 2166136261u;
+    for (; *s; s++) h = (h ^ (uint8_t)*s) * 16777619u;
+    return h;
+}
+
+static uint32_t *find_string(SnapshotWriter *w, const char *s) {
+    uint32_t i = hash_string(s) & (w->index_cap - 1);
+    while (w->string_index[i] && strcmp(w->strings + w->string_offsets[w->string_index[i] - 1], s) != 0) {
+        i = (i + 1) & (w->index_cap - 1);
+    }
+    return &w->string_index[i];
+}
+
+static void grow_string_index(SnapshotWriter *w) {
+    uint32_t old_cap = w->index_cap;
+    uint32_t *old = w->string_index;
+    w->index_cap = old_cap ? old_cap * 2 : 64;
+    w->string_index = calloc(w->index_cap, sizeof(uint32_t));
+    assert(w->string_index);
+    for (uint32_t i = 0; i < old_cap; i++) {
+        if (old[i]) *find_string(w, w->strings + w->string_offsets[old[i] - 1]) = old[i];
+    }
+    free(old);
+}
+
+// 取得字符串的编号，相同的字符串只保存一次
+static uint32_t intern_string(SnapshotWriter *w, const char *s) {
+    if ((w->string_count + 1) * 2 > w->index_cap) grow_string_index(w);
+    uint32_t *slot = find_string(w, s);
+    if (*slot) return *slot - 1;
+
+    uint32_t len = (uint32_t)strlen(s) + 1;
+    w->strings = reserve(w->strings, &w->string_cap, w->string_bytes + len, 1);
+    memcpy(w->strings + w->string_bytes, s, len);
+    w->string_offsets = reserve(w->string_offsets, &w->string_offset_cap, w->string_count + 1, sizeof(uint32_t));
+    w->string_offsets[w->string_count] = w->string_bytes;
+    w->string_bytes += len;
+    *slot = ++w->string_count;
+    return w->string_count - 1;
+}
+
+static uint32_t push_record(SnapshotWriter *w, const BaseAST *node, uint8_t op, uint32_t a, uint32_t b, uint32_t c) {
+    w->records = reserve(w->records, &w->record_cap, w->record_count + 1, sizeof(SnapshotRecord));
+    SnapshotRecord record = {(uint8_t)node->type, op, 0, a, b, c};
+    w->records[w->record_count] = record;
+    return w->record_count++;
+}
+
+static uint32_t write_node(SnapshotWriter *w, const BaseAST *node);
+
+// 先写出列表中的节点，再写出列表本身，返回列表的偏移
+static uint32_t write_list(SnapshotWriter *w, const ASTList *list) {
+    uint32_t *indices = malloc((list->count ? list->count : 1) * sizeof(uint32_t));
+    assert(indices);
+    for (int i = 0; i < list->count; i++) indices[i] = write_node(w, list->items[i]);
+
+    uint32_t offset = w->list_words;
+    w->lists = reserve(w->lists, &w->list_cap, offset + 1 + (uint32_t)list->count, sizeof(uint32_t));
+    w->lists[offset] = (uint32_t)list->count;
+    memcpy(w->lists + offset + 1, indices, list->count * sizeof(uint32_t));
+    w->list_words += 1 + (uint32_t)list->count;
+    free(indices);
+    return offset;
+}
+
+// 按后序写出节点，返回其下标
+static uint32_t write_node(SnapshotWriter *w, const BaseAST *node) {
+    switch (node->type) {
+        case AST_COMP_UNIT:
+            return push_record(w, node, 0, 0, 0, write_list(w, &((const CompUnitAST *)node)->func_defs));
+        case AST_FUNC_DEF: {
+            const FuncDefAST *def = (const FuncDefAST *)node;
+            uint32_t params = write_list(w, &def->params);
+            uint32_t block = write_node(w, def->block);
+            return push_record(w, node, 0, intern_string(w, def->ident), block, params);
+        }
+        case AST_FUNC_PARAM:
+            return push_record(w, node, 0, intern_string(w, ((const FuncParamAST *)node)->ident), 0, 0);
+        case AST_BLOCK:
+            return push_record(w, node, 0, 0, write_node(w, ((const BlockAST *)node)->stmt), 0);
+        case AST_STMT:
+            return push_record(w, node, 0, 0, write_node(w, ((const StmtAST *)node)->expr), 0);
+        case AST_NUMBER:
+            return push_record(w, node, 0, (uint32_t)((const NumberAST *)node)->value, 0, 0);
+        case AST_UNARY: {
+            const UnaryAST *u = (const UnaryAST *)node;
+            return push_record(w, node, (uint8_t)u->op, 0, write_node(w, u->operand), 0);
+        }
+        case AST_BINARY: {
+            const BinaryAST *b = (const BinaryAST *)node;
+            uint32_t left = write_node(w, b->left);
+            uint32_t right = write_node(w, b->right);
+            return push_record(w, node, (uint8_t)b->op, 0, left, right);
+        }
+        case AST_LVAL:
+            return push_record(w, node, 0, intern_string(w, ((const LValAST *)node)->ident), 0, 0);
+        case AST_CALL: {
+            const CallAST *call = (const CallAST *)node;
+            uint32_t args = write_list(w, &call->args);
+            return push_record(w, node, 0, intern_string(w, call->ident), 0, args);
+        }
+        default:
+            assert(0 && "Unexpected AST node in snapshot");
+            return 0;
+    }
+}
+
+static void writer_free(SnapshotWriter *w) {
+    free(w->records);
+    free(w->lists);
+    free(w->string_offsets);
+    free(w->strings);
+    free(w->string_index);
+}
+
+int ast_snapshot_write(FILE *output, const BaseAST *ast) {
+    assert(ast && ast->type == AST_COMP_UNIT);
+    SnapshotWriter w;
+    memset(&w, 0, sizeof(w));
+    write_node(&w, ast);
+
+    SnapshotHeader header;
+    memset(&header, 0, sizeof(header));
+    memcpy(header.magic, AST_SNAPSHOT_MAGIC, 4);
+    header.version = AST_SNAPSHOT_VERSION;
+    header.record_size = sizeof(SnapshotRecord);
+    header.byte_order = SNAPSHOT_BYTE_ORDER;
+    header.node_count = w.record_count;
+    header.list_words = w.list_words;
+    header.string_count = w.string_count;
+    header.string_bytes = w.string_bytes;
+
+    static const char padding[4] = {0};
+    fwrite(&header, sizeof(header), 1, output);
+    fwrite(w.records, sizeof(SnapshotRecord), w.record_count, output);
+    fwrite(w.lists, sizeof(uint32_t), w.list_words, output);
+    fwrite(w.string_offsets, sizeof(uint32_t), w.string_count, output);
+    fwrite(w.strings, 1, w.string_bytes, output);
+    fwrite(padding, 1, align4(w.string_bytes) - w.string_bytes, output);
+    writer_free(&w);
+    return ferror(output) ? -1 : 0;
+}
+
+// ========================================
+// 载入
+// ========================================
+
+typedef struct {
+    const SnapshotRecord *records;
+    uint32_t node_count;
+    const uint32_t *lists;
+    uint32_t list_words;
+    const uint32_t *string_offsets;
+    uint32_t string_count;
+    const char *strings;
+    uint32_t string_bytes;
+    BaseAST **nodes;            // 已重建、尚未被父节点取走的节点
+    const char *error;
+} SnapshotReader;
+
+#define TYPE_BIT(t) (1u << (t))
+#define EXPR_TYPES (TYPE_BIT(AST_NUMBER) | TYPE_BIT(AST_UNARY) | TYPE_BIT(AST_BINARY) | \
+                    TYPE_BIT(AST_LVAL) | TYPE_BIT(AST_CALL))
+
+static void *fail(SnapshotReader *r, const char *error) {
+    if (!r->error) r->error = error;
+    return NULL;
+}
+
+// 取走第 index 个节点交给第 parent 个节点，子节点须在父节点之前且只能被取走一次
+static BaseAST *take_node(SnapshotReader *r, uint32_t index, uint32_t parent, uint32_t allowed_types) {
+    if (index >= parent) return fail(r, "child node does not precede its parent");
+    BaseAST *node = r->nodes[index];
+    if (!node) return fail(r, "node referenced more than once");
+    if (!(TYPE_BIT(node->type) & allowed_types)) return fail(r, "unexpected child node type");
+    r->nodes[index] = NULL;
+    return node;
+}
+
+static bool is_ident_char(char c) {
+    return (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') || (c >= '0' && c <= '9') || c == '_';
+}
+
+/**
+ * 校验字符串表：与写入时一样依次紧接存放、各以 '\0' 结尾，内容都是词法分析器能给出的标识符
+ * （[A-Za-z_][A-Za-z0-9_]*，且不是关键字），否则生成的 Koopa IR 中会出现非法的符号名
+ */
+static bool check_strings(SnapshotReader *r) {
+    uint32_t offset = 0;
+    for (uint32_t id = 0; id < r->string_count; id++) {
+        if (r->string_offsets[id] != offset) return fail(r, "string offsets out of order");
+        const char *s = r->strings + offset;
+        uint32_t len = 0;
+        while (offset + len < r->string_bytes && is_ident_char(s[len])) len++;
+        if (offset + len == r->string_bytes) return fail(r, "unterminated string");
+        if (s[len] != '\0') return fail(r, "invalid character in identifier");
+        if (len == 0) return fail(r, "empty identifier");
+        if (s[0] >= '0' && s[0] <= '9') return fail(r, "identifier starts with a digit");
+        if (strcmp(s, "int") == 0 || strcmp(s, "return") == 0) return fail(r, "keyword used as identifier");
+        offset += len + 1;
+    }
+    if (offset != r->string_bytes) return fail(r, "unused bytes in string table");
+    return true;
+}
+
+// 复制第 id 个字符串，字符串表已由 check_strings 校验
+static char *copy_string(SnapshotReader *r, uint32_t id) {
+    if (id >= r->string_count) return fail(r, "string index out of range");
+    uint32_t offset = r->string_offsets[id];
+    uint32_t end = id + 1 < r->string_count ? r->string_offsets[id + 1] : r->string_bytes;
+    char *copy = malloc(end - offset);
+    assert(copy);
+    return memcpy(copy, r->strings + offset, end - offset);
+}
+
+static bool take_list(SnapshotReader *r, uint32_t offset, uint32_t parent, uint32_t allowed_types, ASTList *list) {
+    ast_list_init(list);
+    if (offset >= r->list_words || r->lists[offset] > r->list_words - offset - 1) {
+        fail(r, "list out of range");
+        return false;
+    }
+    for (uint32_t i = 0; i < r->lists[offset]; i++) {
+        BaseAST *item = take_node(r, r->lists[offset + 1 + i], parent, allowed_types);
+        if (!item) {
+            ast_list_destroy(list);
+            return false;
+        }
+        ast_list_push(list, item);
+    }
+    return true;
+}
+
+// 由第 i 条记录重建节点，失败时已取走的子节点一并释放
+static BaseAST *build_node(SnapshotReader *r, uint32_t i) {
+    const SnapshotRecord *rec = &r->records[i];
+    switch (rec->type) {
+        case AST_COMP_UNIT: {
+            ASTList defs;
+            if (!take_list(r, rec->c, i, TYPE_BIT(AST_FUNC_DEF), &defs)) return NULL;
+            return create_comp_unit_ast(defs);
+        }
+        case AST_FUNC_DEF: {
+            ASTList params;
+            if (!take_list(r, rec->c, i, TYPE_BIT(AST_FUNC_PARAM), &params)) return NULL;
+            BaseAST *block = take_node(r, rec->b, i, TYPE_BIT(AST_BLOCK));
+            char *ident = block ? copy_string(r, rec->a) : NULL;
+            if (!ident) {
+                destroy_ast(block);
+                ast_list_destroy(&params);
+                return NULL;
+            }
+            return create_func_def_ast(create_func_type_ast(), ident, params, block);
+        }
+        case AST_FUNC_PARAM: {
+            char *ident = copy_string(r, rec->a);
+            return ident ? create_func_param_ast(ident) : NULL;
+        }
+        case AST_BLOCK: {
+            BaseAST *stmt = take_node(r, rec->b, i, TYPE_BIT(AST_STMT));
+            return stmt ? create_block_ast(stmt) : NULL;
+        }
+        case AST_STMT: {
+            BaseAST *expr = take_node(r, rec->b, i, EXPR_TYPES);
+            return expr ? create_stmt_ast(expr) : NULL;
+        }
+        case AST_NUMBER:
+            return create_number_ast((int32_t)rec->a);
+        case AST_UNARY: {
+            if (!rec->op || !strchr("+-!", rec->op)) return fail(r, "invalid unary operator");
+            BaseAST *operand = take_node(r, rec->b, i, EXPR_TYPES);
+            return operand ? create_unary_ast((char)rec->op, operand) : NULL;
+        }
+        case AST_BINARY: {
+            if (!rec->op || !strchr("+-*/%<>lgen&|", rec->op)) return fail(r, "invalid binary operator");
+            BaseAST *left = take_node(r, rec->b, i, EXPR_TYPES);
+            BaseAST *right = left ? take_node(r, rec->c, i, EXPR_TYPES) : NULL;
+            if (!right) {
+                destroy_ast(left);
+                return NULL;
+            }
+            return create_binary_ast((char)rec->op, left, right);
+        }
+        case AST_LVAL: {
+            char *ident = copy_string(r, rec->a);
+            return ident ? create_lval_ast(ident) : NULL;
+        }
+        case AST_CALL: {
+            ASTList args;
+            if (!take_list(r, rec->c, i, EXPR_TYPES, &args)) return NULL;
+            char *ident = copy_string(r, rec->a);
+            if (!ident) {
+                ast_list_destroy(&args);
+                return NULL;
+            }
+            return create_call_ast(ident, args);
+        }
+        default:
+            return fail(r, "invalid node type");
+    }
+}
+
+// 校验头部并定位各段
+static bool map_sections(SnapshotReader *r, const void *data, size_t size) {
+    SnapshotHeader header;
+    if (size < sizeof(header)) return fail(r, "truncated header");
+    memcpy(&header, data, sizeof(header));
+    if (memcmp(header.magic, AST_SNAPSHOT_MAGIC, 4) != 0) return fail(r, "bad magic");
+    if (header.byte_order != SNAPSHOT_BYTE_ORDER) return fail(r, "byte order mismatch");
+    if (header.version != AST_SNAPSHOT_VERSION) return fail(r, "unsupported version");
+    if (header.record_size != sizeof(SnapshotRecord)) return fail(r, "unexpected record size");
+    if (header.node_count == 0) return fail(r, "empty snapshot");
+
+    uint64_t records = sizeof(header);
+    uint64_t lists = records + (uint64_t)header.node_count * sizeof(SnapshotRecord);
+    uint64_t offsets = lists + (uint64_t)header.list_words * sizeof(uint32_t);
+    uint64_t strings = offsets + (uint64_t)header.string_count * sizeof(uint32_t);
+    if (strings + header.string_bytes > size) return fail(r, "truncated sections");
+
+    const char *base = data;
+    r->records = (const SnapshotRecord *)(base + records);
+    r->node_count = header.node_count;
+    r->lists = (const uint32_t *)(base + lists);
+    r->list_words = header.list_words;
+    r->string_offsets = (const uint32_t *)(base + offsets);
+    r->string_count = header.string_count;
+    r->strings = base + strings;
+    r->string_bytes = header.string_bytes;
+    return true;
+}
+
+BaseAST *ast_snapshot_decode(const void *data, size_t size) {
+    SnapshotReader r;
+    memset(&r, 0, sizeof(r));
+    BaseAST *root = NULL;
+    if (map_sections(&r, data, size) && check_strings(&r)) {
+        r.nodes = calloc(r.node_count, sizeof(BaseAST *));
+        assert(r.nodes);
+        uint32_t i = 0;
+        for (; i < r.node_count; i++) {
+            r.nodes[i] = build_node(&r, i);
+            if (!r.nodes[i]) break;
+        }
+
+        // 根为最后一个节点，其余节点都应已被各自的父节点取走
+        if (i == r.node_count) {
+            uint32_t last = r.node_count - 1;
+            for (uint32_t j = 0; j < last && !r.error; j++) {
+                if (r.nodes[j]) fail(&r, "unreferenced node");
+            }
+            if (r.nodes[last]->type != AST_COMP_UNIT) fail(&r, "root is not a compilation unit");
+            if (!r.error) {
+                root = r.nodes[last];
+                r.nodes[last] = NULL;
+            }
+        }
+        for (uint32_t j = 0; j < r.node_count; j++) destroy_ast(r.nodes[j]);
+        free(r.nodes);
+    }
+    if (!root) fprintf(diag_err(), "Invalid AST snapshot: %s\n", r.error ? r.error : "unknown error");
+    return root;
+}
+
+BaseAST *ast_snapshot_load(const char *path) {
+    int fd = open(path, O_RDONLY);
+    if (fd < 0) {
+        fprintf(diag_err(), "Failed to open AST snapshot: %s\n", path);
+        return NULL;
+    }
+    struct stat st;
+    if (fstat(fd, &st) != 0 || st.st_size == 0) {
+        close(fd);
+        return ast_snapshot_decode("", 0);
+    }
+    void *data = mmap(NULL, (size_t)st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (data == MAP_FAILED) {
+        fprintf(diag_err(), "Failed to map AST snapshot: %s\n", path);
+        return NULL;
+    }
+    BaseAST *ast = ast_snapshot_decode(data, (size_t)st.st_size);
+    munmap(data, (size_t)st.st_size);
+    return ast;
+}
+
+bool ast_snapshot_is_file(const char *path) {
+    FILE *f = fopen(path, "rb");
+    if (!f) return false;
+    char magic[4];
+    bool match = fread(magic, 1, 4, f) == 4 && memcmp(magic, AST_SNAPSHOT_MAGIC, 4) == 0;
+    fclose(f);
+    return match;
+}
+
+// ========================================
+// 自检
+// ========================================
+
+static char *dup_name(const char *s) {
+    char *copy = malloc(strlen(s) + 1);
+    assert(copy);
+    return strcpy(copy, s);
+}
+
+// int f(val) { return val; }  int main() { return f(1) + 2; }
+static BaseAST *build_check_ast(void) {
+    ASTList params, args, defs;
+    ast_list_init(&params);
+    ast_list_push(&params, create_func_param_ast(dup_name("val")));
+    BaseAST *f = create_func_def_ast(create_func_type_ast(), dup_name("f"), params,
+                                     create_block_ast(create_stmt_ast(create_lval_ast(dup_name("val")))));
+    ast_list_init(&args);
+    ast_list_push(&args, create_number_ast(1));
+    BaseAST *sum = create_binary_ast('+', create_call_ast(dup_name("f"), args), create_number_ast(2));
+    ast_list_init(&params);
+    BaseAST *main_def = create_func_def_ast(create_func_type_ast(), dup_name("main"), params,
+                                            create_block_ast(create_stmt_ast(sum)));
+    ast_list_init(&defs);
+    ast_list_push(&defs, f);
+    ast_list_push(&defs, main_def);
+    return create_comp_unit_ast(defs);
+}
+
+// 快照中各段的位置，data 为可修改的副本
+typedef struct {
+    SnapshotHeader header;
+    SnapshotRecord *records;
+    uint32_t *string_offsets;
+    char *strings;
+} SnapshotView;
+
+static SnapshotView view_snapshot(char *data) {
+    SnapshotView v;
+    memcpy(&v.header, data, sizeof(v.header));
+    v.records = (SnapshotRecord *)(data + sizeof(SnapshotHeader));
+    uint32_t *lists = (uint32_t *)(v.records + v.header.node_count);
+    v.string_offsets = lists + v.header.list_words;
+    v.strings = (char *)(v.string_offsets + v.header.string_count);
+    return v;
+}
+
+static char *find_name(SnapshotView *v, const char *name) {
+    for (uint32_t i = 0; i < v->header.string_count; i++) {
+        if (strcmp(v->strings + v->string_offsets[i], name) == 0) return v->strings + v->string_offsets[i];
+    }
+    return NULL;
+}
+
+static void corrupt_char(SnapshotView *v) { find_name(v, "main")[2] = '-'; }
+static void corrupt_digit(SnapshotView *v) { find_name(v, "main")[0] = '1'; }
+static void corrupt_keyword(SnapshotView *v) { memcpy(find_name(v, "val"), "int", 3); }
+static void corrupt_empty(SnapshotView *v) { find_name(v, "main")[0] = '\0'; }
+static void corrupt_terminator(SnapshotView *v) { v->strings[v->header.string_bytes - 1] = 'x'; }
+static void corrupt_offsets(SnapshotView *v) { v->string_offsets[v->header.string_count - 1] = 0; }
+
+static void corrupt_ident(SnapshotView *v) {
+    for (uint32_t i = 0; i < v->header.node_count; i++) {
+        if (v->records[i].type == AST_LVAL) v->records[i].a = v->header.string_count;
+    }
+}
+
+typedef struct {
+    const char *name;
+    void (*corrupt)(SnapshotView *v);
+    const char *expected;       // 载入失败时报告的原因
+} CorruptCase;
+
+static const CorruptCase corrupt_cases[] = {
+    {"char", corrupt_char, "invalid character in identifier"},
+    {"digit", corrupt_digit, "identifier starts with a digit"},
+    {"keyword", corrupt_keyword, "keyword used as identifier"},
+    {"empty", corrupt_empty, "empty identifier"},
+    {"terminator", corrupt_terminator, "unterminated string"},
+    {"offsets", corrupt_offsets, "string offsets out of order"},
+    {"ident", corrupt_ident, "string index out of range"},
+};
+
+// 载入 data，返回载入是否成功；报告的错误写入 error
+static bool decode_quietly(const char *data, size_t size, char *error, size_t error_size) {
+    char *text = NULL;
+    size_t len = 0;
+    FILE *err = open_memstream(&text, &len);
+    diag_redirect(NULL, err);
+    BaseAST *ast = ast_snapshot_decode(data, size);
+    diag_redirect(NULL, NULL);
+    fclose(err);
+    snprintf(error, error_size, "%s", text);
+    free(text);
+    if (!ast) return false;
+    destroy_ast(ast);
+    return true;
+}
+
+int ast_snapshot_self_check(FILE *report) {
+    int failures = 0;
+    BaseAST *ast = build_check_ast();
+    char *data = NULL;
+    size_t size = 0;
+    FILE *stream = open_memstream(&data, &size);
+    ast_snapshot_write(stream, ast);
+    fclose(stream);
+    destroy_ast(ast);
+
+    char error[256];
+    bool ok = decode_quietly(data, size, error, sizeof(error));
+    failures += !ok;
+    fprintf(report, "%-10s %s%s\n", "intact", ok ? "loaded" : "rejected", ok ? "" : "  FAILED");
+
+    char *copy = malloc(size);
+    assert(copy);
+    for (size_t i = 0; i < sizeof(corrupt_cases) / sizeof(corrupt_cases[0]); i++) {
+        memcpy(copy, data, size);
+        SnapshotView v = view_snapshot(copy);
+        corrupt_cases[i].corrupt(&v);
+        bool loaded = decode_quietly(copy, size, error, sizeof(error));
+        error[strcspn(error, "\n")] = '\0';
+        ok = !loaded && strstr(error, corrupt_cases[i].expected) != NULL;
+        failures += !ok;
+        fprintf(report, "%-10s %s%s%s\n", corrupt_cases[i].name, loaded ? "loaded" : "rejected: ",
+                loaded ? "" : error, ok ? "" : "  FAILED");
+    }
+    free(copy);
+    free(data);
+    return failures;
+}
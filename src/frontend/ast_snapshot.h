@@ -0,0 +1,57 @@
+#pragma once
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdio.h>
+#include "ast.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * AST 二进制快照
+ * 解析一次后保存，之后的检查、生成 IR 与后端等步骤直接载入，无需再次词法、语法分析
+ *
+ * 格式（本机字节序，头部记录字节序标记，不匹配时拒绝载入）：
+ *   头部        32 字节，见 ast_snapshot.c 中的 SnapshotHeader
+ *   节点记录    node_count 个，每个 16 字节；按后序排列，子节点总在父节点之前，根为最后一个
+ *   列表        list_words 个 u32；每个列表为元素个数 + 各元素的节点下标
+ *   字符串表    string_count 个 u32 偏移，随后为以 '\0' 结尾的字符串内容；相同的标识符只保存一次
+ * 各段按 4 字节对齐，函数类型目前只有 int，不单独保存
+ */
+
+#define AST_SNAPSHOT_MAGIC "SYAS"
+#define AST_SNAPSHOT_VERSION 1
+
+/**
+ * 将以 CompUnitAST 为根的 AST 写为快照
+ * @return 成功返回 0
+ */
+int ast_snapshot_write(FILE *output, const BaseAST *ast);
+
+/**
+ * 由内存中的快照重建 AST，不调用语法分析器
+ * 快照的每个字段都会校验（版本、越界、节点类型与运算符、每个节点恰好被引用一次、名字都是合法标识符），
+ * 损坏或不兼容时在 stderr 报告原因并返回 NULL
+ */
+BaseAST *ast_snapshot_decode(const void *data, size_t size);
+
+// 以 mmap 映射快照文件并重建 AST，失败返回 NULL
+BaseAST *ast_snapshot_load(const char *path);
+
+// 文件是否以快照的魔数开头
+bool ast_snapshot_is_file(const char *path);
+
+/**
+ * 快照载入的自检
+ * 写出一个小的 AST 后检查其能原样载入，再逐一破坏字符串表与标识符字段（非法字符、数字开头、关键字、
+ * 空名字、缺少结尾的 '\0'、偏移错乱、越界的名字下标），检查载入被拒绝并报告相应的原因
+ * @param report 每个用例一行结果
+ * @return 失败的用例数，0 表示全部通过
+ */
+int ast_snapshot_self_check(FILE *report);
+
+#ifdef __cplusplus
+}
+#endif
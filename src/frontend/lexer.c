@@ -0,0 +1,531 @@
+#include "lexer.h"
+#include <limits.h>
+#include <stdbool.h>
+#include <stdlib.h>
+#include <string.h>
+#include "ast.h"
+#include "sysy.tab.h"
+
+#if (defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || defined(__i386__)) && defined(__SSE2__)
+#define LEXER_SIMD 1
+#include <immintrin.h>
+#endif
+
+FILE *yyin = NULL;
+
+static char *buf_begin = NULL;     // 整个输入文件
+static const char *cur = NULL;     // 当前扫描位置
+static const char *buf_end = NULL; // 有效内容末尾（之后为零填充）
+
+// 回放的 token 序列，replay_tokens 为 NULL 时从 yyin 扫描
+static const char *replay_source = NULL;
+static const LexToken *replay_tokens = NULL;
+static size_t replay_count = 0;
+static size_t replay_next = 0;
+
+// ========================================
+// 字符分类
+// ========================================
+
+static inline bool is_space(char c) {
+    return c == ' ' || c == '\t' || c == '\n' || c == '\r';
+}
+
+static inline bool is_alpha(char c) {
+    return (unsigned)((c | 0x20) - 'a') < 26u || c == '_';
+}
+
+static inline bool is_digit(char c) {
+    return (unsigned)(c - '0') < 10u;
+}
+
+static inline bool is_ident(char c) {
+    return is_alpha(c) || is_digit(c);
+}
+
+static inline bool is_hex(char c) {
+    return is_digit(c) || (unsigned)((c | 0x20) - 'a') < 6u;
+}
+
+static inline bool is_octal(char c) {
+    return (unsigned)(c - '0') < 8u;
+}
+
+// ========================================
+// 扫描内核：返回第一个不满足条件的位置（或 "*/"、换行的位置），不超过 end
+// ========================================
+
+typedef const char *(*ScanFn)(const char *p, const char *end);
+
+typedef struct {
+    const char *name;
+    ScanFn skip_space;        // 跳过空白
+    ScanFn skip_ident;        // 跳过 [a-zA-Z0-9_]*
+    ScanFn skip_digits;       // 跳过 [0-9]*
+    ScanFn skip_hex;          // 跳过 [0-9a-fA-F]*
+    ScanFn find_newline;      // 查找 '\n'
+    ScanFn find_comment_end;  // 查找 "*/"，返回 '*' 的位置
+} LexerKernels;
+
+#define SCALAR_SKIP(fn, pred)                                \
+    static const char *fn(const char *p, const char *end) {  \
+        while (p < end && pred(*p)) p++;                     \
+        return p;                                            \
+    }
+
+SCALAR_SKIP(scalar_skip_space, is_space)
+SCALAR_SKIP(scalar_skip_ident, is_ident)
+SCALAR_SKIP(scalar_skip_digits, is_digit)
+SCALAR_SKIP(scalar_skip_hex, is_hex)
+
+static const char *scalar_find_newline(const char *p, const char *end) {
+    const char *nl = memchr(p, '\n', end - p);
+    return nl ? nl : end;
+}
+
+static const char *scalar_find_comment_end(const char *p, const char *end) {
+    for (; p + 1 < end; p++) {
+        if (p[0] == '*' && p[1] == '/') return p;
+    }
+    return end;
+}
+
+static const LexerKernels scalar_kernels = {
+    "scalar",
+    scalar_skip_space, scalar_skip_ident, scalar_skip_digits, scalar_skip_hex,
+    scalar_find_newline, scalar_find_comment_end,
+};
+
+#ifdef LEXER_SIMD
+
+// 由块内掩码推进指针：mask 中第一个置位的字节即为停止位置
+#define SIMD_SCAN(attr, fn, vec_t, width, load, mask_of)          \
+    static attr const char *fn(const char *p, const char *end) {  \
+        while (p < end) {                                         \
+            vec_t v = load((const vec_t *)p);                     \
+            unsigned m = mask_of(v);                              \
+            if (m) {                                              \
+                p += __builtin_ctz(m);                            \
+                return p < end ? p : end;                         \
+            }                                                     \
+            p += width;                                           \
+        }                                                         \
+        return end;                                               \
+    }
+
+// ---------- SSE2：16 字节块 ----------
+
+#define B16(c) _mm_set1_epi8((char)(c))
+// 有符号比较：>= 0x80 的字节视为负数，自然落在所有 ASCII 区间之外
+#define IN16(v, lo, hi) _mm_and_si128(_mm_cmpgt_epi8(v, B16((lo) - 1)), _mm_cmpgt_epi8(B16((hi) + 1), v))
+
+static inline unsigned sse2_not_space(__m128i v) {
+    __m128i m = _mm_or_si128(_mm_or_si128(_mm_cmpeq_epi8(v, B16(' ')), _mm_cmpeq_epi8(v, B16('\t'))),
+                             _mm_or_si128(_mm_cmpeq_epi8(v, B16('\n')), _mm_cmpeq_epi8(v, B16('\r'))));
+    return ~(unsigned)_mm_movemask_epi8(m) & 0xFFFFu;
+}
+
+static inline unsigned sse2_not_ident(__m128i v) {
+    __m128i lower = _mm_or_si128(v, B16(0x20));
+    __m128i m = _mm_or_si128(_mm_or_si128(IN16(lower, 'a', 'z'), IN16(v, '0', '9')),
+                             _mm_cmpeq_epi8(v, B16('_')));
+    return ~(unsigned)_mm_movemask_epi8(m) & 0xFFFFu;
+}
+
+static inline unsigned sse2_not_digit(__m128i v) {
+    return ~(unsigned)_mm_movemask_epi8(IN16(v, '0', '9')) & 0xFFFFu;
+}
+
+static inline unsigned sse2_not_hex(__m128i v) {
+    __m128i lower = _mm_or_si128(v, B16(0x20));
+    __m128i m = _mm_or_si128(IN16(v, '0', '9'), IN16(lower, 'a', 'f'));
+    return ~(unsigned)_mm_movemask_epi8(m) & 0xFFFFu;
+}
+
+static inline unsigned sse2_newline(__m128i v) {
+    return (unsigned)_mm_movemask_epi8(_mm_cmpeq_epi8(v, B16('\n')));
+}
+
+SIMD_SCAN(, sse2_skip_space, __m128i, 16, _mm_loadu_si128, sse2_not_space)
+SIMD_SCAN(, sse2_skip_ident, __m128i, 16, _mm_loadu_si128, sse2_not_ident)
+SIMD_SCAN(, sse2_skip_digits, __m128i, 16, _mm_loadu_si128, sse2_not_digit)
+SIMD_SCAN(, sse2_skip_hex, __m128i, 16, _mm_loadu_si128, sse2_not_hex)
+SIMD_SCAN(, sse2_find_newline, __m128i, 16, _mm_loadu_si128, sse2_newline)
+
+static const char *sse2_find_comment_end(const char *p, const char *end) {
+    while (p < end) {
+        // p[i] == '*' 且 p[i + 1] == '/'
+        __m128i star = _mm_cmpeq_epi8(_mm_loadu_si128((const __m128i *)p), B16('*'));
+        __m128i slash = _mm_cmpeq_epi8(_mm_loadu_si128((const __m128i *)(p + 1)), B16('/'));
+        unsigned m = (unsigned)_mm_movemask_epi8(_mm_and_si128(star, slash));
+        if (m) {
+            p += __builtin_ctz(m);
+            return p < end ? p : end;
+        }
+        p += 16;
+    }
+    return end;
+}
+
+static const LexerKernels sse2_kernels = {
+    "sse2",
+    sse2_skip_space, sse2_skip_ident, sse2_skip_digits, sse2_skip_hex,
+    sse2_find_newline, sse2_find_comment_end,
+};
+
+// ---------- AVX2：32 字节块，运行时检测 CPU 支持后启用 ----------
+
+#define AVX2 __attribute__((target("avx2")))
+#define B32(c) _mm256_set1_epi8((char)(c))
+#define IN32(v, lo, hi) _mm256_and_si256(_mm256_cmpgt_epi8(v, B32((lo) - 1)), _mm256_cmpgt_epi8(B32((hi) + 1), v))
+
+static AVX2 inline unsigned avx2_not_space(__m256i v) {
+    __m256i m = _mm256_or_si256(_mm256_or_si256(_mm256_cmpeq_epi8(v, B32(' ')), _mm256_cmpeq_epi8(v, B32('\t'))),
+                                _mm256_or_si256(_mm256_cmpeq_epi8(v, B32('\n')), _mm256_cmpeq_epi8(v, B32('\r'))));
+    return ~(unsigned)_mm256_movemask_epi8(m);
+}
+
+static AVX2 inline unsigned avx2_not_ident(__m256i v) {
+    __m256i lower = _mm256_or_si256(v, B32(0x20));
+    __m256i m = _mm256_or_si256(_mm256_or_si256(IN32(lower, 'a', 'z'), IN32(v, '0', '9')),
+                                _mm256_cmpeq_epi8(v, B32('_')));
+    return ~(unsigned)_mm256_movemask_epi8(m);
+}
+
+static AVX2 inline unsigned avx2_not_digit(__m256i v) {
+    return ~(unsigned)_mm256_movemask_epi8(IN32(v, '0', '9'));
+}
+
+static AVX2 inline unsigned avx2_not_hex(__m256i v) {
+    __m256i lower = _mm256_or_si256(v, B32(0x20));
+    return ~(unsigned)_mm256_movemask_epi8(_mm256_or_si256(IN32(v, '0', '9'), IN32(lower, 'a', 'f')));
+}
+
+static AVX2 inline unsigned avx2_newline(__m256i v) {
+    return (unsigned)_mm256_movemask_epi8(_mm256_cmpeq_epi8(v, B32('\n')));
+}
+
+static AVX2 inline __m256i avx2_load(const __m256i *p) {
+    return _mm256_loadu_si256(p);
+}
+
+SIMD_SCAN(AVX2, avx2_skip_space, __m256i, 32, avx2_load, avx2_not_space)
+SIMD_SCAN(AVX2, avx2_skip_ident, __m256i, 32, avx2_load, avx2_not_ident)
+SIMD_SCAN(AVX2, avx2_skip_digits, __m256i, 32, avx2_load, avx2_not_digit)
+SIMD_SCAN(AVX2, avx2_skip_hex, __m256i, 32, avx2_load, avx2_not_hex)
+SIMD_SCAN(AVX2, avx2_find_newline, __m256i, 32, avx2_load, avx2_newline)
+
+static AVX2 const char *avx2_find_comment_end(const char *p, const char *end) {
+    while (p < end) {
+        __m256i star = _mm256_cmpeq_epi8(_mm256_loadu_si256((const __m256i *)p), B32('*'));
+        __m256i slash = _mm256_cmpeq_epi8(_mm256_loadu_si256((const __m256i *)(p + 1)), B32('/'));
+        unsigned m = (unsigned)_mm256_movemask_epi8(_mm256_and_si256(star, slash));
+        if (m) {
+            p += __builtin_ctz(m);
+            return p < end ? p : end;
+        }
+        p += 32;
+    }
+    return end;
+}
+
+static const LexerKernels avx2_kernels = {
+    "avx2",
+    avx2_skip_space, avx2_skip_ident, avx2_skip_digits, avx2_skip_hex,
+    avx2_find_newline, avx2_find_comment_end,
+};
+
+#endif  // LEXER_SIMD
+
+static const LexerKernels *kernels = NULL;
+
+static const LexerKernels *select_kernels(void) {
+    if (!kernels) {
+#ifdef LEXER_SIMD
+        __builtin_cpu_init();
+        kernels = __builtin_cpu_supports("avx2") ? &avx2_kernels : &sse2_kernels;
+#else
+        kernels = &scalar_kernels;
+#endif
+        // 允许通过环境变量强制使用逐字节实现，便于对比与排查
+        if (getenv("SYSY_LEXER_SCALAR")) kernels = &scalar_kernels;
+    }
+    return kernels;
+}
+
+const char *lexer_kernel_name(void) {
+    return select_kernels()->name;
+}
+
+// ========================================
+// 输入缓冲区
+// ========================================
+
+// 读入整个输入文件，末尾追加零填充
+static bool lexer_load(FILE *in) {
+    if (!in) return false;
+    size_t cap = 1 << 16, len = 0;
+    char *data = malloc(cap + LEXER_PADDING);
+    if (!data) return false;
+    for (;;) {
+        len += fread(data + len, 1, cap - len, in);
+        if (len < cap) break;
+        cap *= 2;
+        char *grown = realloc(data, cap + LEXER_PADDING);
+        if (!grown) {
+            free(data);
+            return false;
+        }
+        data = grown;
+    }
+    memset(data + len, 0, LEXER_PADDING);
+    buf_begin = data;
+    cur = data;
+    buf_end = data + len;
+    return true;
+}
+
+// 输入结束后释放缓冲区，下一次调用 yylex 会重新读入 yyin
+static void lexer_release(void) {
+    free(buf_begin);
+    buf_begin = NULL;
+    cur = NULL;
+    buf_end = NULL;
+}
+
+void yyrestart(FILE *input) {
+    lexer_release();
+    replay_tokens = NULL;
+    yyin = input;
+}
+
+// 与 strtol(text, NULL, 0) 的结果一致：溢出时饱和到 LONG_MAX，再截断为 int
+static int lexer_number_value(const char *p, const char *end, int base) {
+    unsigned long long value = 0;
+    for (; p < end; p++) {
+        int digit = is_digit(*p) ? *p - '0' : (*p | 0x20) - 'a' + 10;
+        // 先判断再乘，value * base 本身就可能超出 unsigned long long
+        if (value > (LONG_MAX - digit) / base) {
+            value = LONG_MAX;
+            break;
+        }
+        value = value * base + digit;
+    }
+    return (int)(long)value;
+}
+
+// ========================================
+// 词法分析主循环
+// ========================================
+
+// 与 strtol(text, NULL, 0) 的结果一致，由整数常量的文本求值
+static int lexer_number_token(const char *start, const char *end) {
+    if (start[0] != '0') return lexer_number_value(start, end, 10);
+    if (end - start > 2 && (start[1] == 'x' || start[1] == 'X')) return lexer_number_value(start + 2, end, 16);
+    return lexer_number_value(start, end, 8);
+}
+
+/**
+ * 自 p 扫描下一个 token，[*start, *stop) 为其文本；不分配内存，不修改全局状态
+ * 返回 token 类型，输入结束时返回 0
+ */
+static inline int lexer_next(const LexerKernels *k, const char *p, const char *end,
+                             const char **start, const char **stop) {
+    // 跳过空白与注释
+    for (;;) {
+        p = k->skip_space(p, end);
+        // 内嵌的 '\0' 同样结束输入：Flex 的单字符规则对它返回 yytext[0]，即 0，解析器同样视为输入结束
+        if (p >= end || *p == '\0') return 0;
+        if (p[0] == '/' && p[1] == '/') {
+            p = k->find_newline(p + 2, end);
+            continue;
+        }
+        if (p[0] == '/' && p[1] == '*') {
+            const char *comment_end = k->find_comment_end(p + 2, end);
+            if (comment_end < end) {
+                p = comment_end + 2;
+                continue;
+            }
+            // 未闭合的块注释不构成注释，与 Flex 规则一致按单字符 '/' 返回
+        }
+        break;
+    }
+
+    *start = p;
+    char c = *p;
+
+    // 关键字与标识符
+    if (is_alpha(c)) {
+        p = k->skip_ident(p + 1, end);
+        *stop = p;
+        size_t len = p - *start;
+        if (len == 3 && memcmp(*start, "int", 3) == 0) return INT;
+        if (len == 6 && memcmp(*start, "return", 6) == 0) return RETURN;
+        return IDENT;
+    }
+
+    // 整数常量：十进制、八进制（0 开头）、十六进制（0x 开头）
+    if (is_digit(c)) {
+        if (c != '0') {
+            p = k->skip_digits(p + 1, end);
+        } else if ((p[1] == 'x' || p[1] == 'X') && is_hex(p[2])) {
+            p = k->skip_hex(p + 2, end);
+        } else {
+            p++;
+            while (p < end && is_octal(*p)) p++;
+        }
+        *stop = p;
+        return INT_CONST;
+    }
+
+    // 双字符运算符
+    char next = p[1];
+    int kind = (unsigned char)c;
+    switch (c) {
+        case '<': if (next == '=') kind = LE; break;
+        case '>': if (next == '=') kind = GE; break;
+        case '=': if (next == '=') kind = EQ; break;
+        case '!': if (next == '=') kind = NE; break;
+        case '&': if (next == '&') kind = AND; break;
+        case '|': if (next == '|') kind = OR; break;
+        default: break;
+    }
+
+    // 其余字符原样作为单字符 token
+    *stop = p + (kind == (unsigned char)c ? 1 : 2);
+    return kind;
+}
+
+// 为标识符与整数常量设置 yylval；标识符复制一份，由调用方释放
+static int lexer_token_value(int kind, const char *start, const char *stop) {
+    if (kind == IDENT) {
+        size_t len = stop - start;
+        char *ident = malloc(len + 1);
+        memcpy(ident, start, len);
+        ident[len] = '\0';
+        yylval.str_val = ident;
+    } else if (kind == INT_CONST) {
+        yylval.int_val = lexer_number_token(start, stop);
+    }
+    return kind;
+}
+
+int lexer_scan(const char *source, size_t len, size_t offset, LexToken *token) {
+    const char *start, *stop;
+    int kind = lexer_next(select_kernels(), source + offset, source + len, &start, &stop);
+    if (kind == 0) return 0;
+    token->kind = kind;
+    token->offset = (uint32_t)(start - source);
+    token->length = (uint32_t)(stop - start);
+    return kind;
+}
+
+void lexer_replay(const char *source, const LexToken *tokens, size_t count) {
+    lexer_release();
+    replay_source = source;
+    replay_tokens = tokens;
+    replay_count = count;
+    replay_next = 0;
+}
+
+int yylex(void) {
+    if (replay_tokens) {
+        if (replay_next == replay_count) {
+            replay_tokens = NULL;
+            return 0;
+        }
+        const LexToken *token = &replay_tokens[replay_next++];
+        const char *start = replay_source + token->offset;
+        return lexer_token_value(token->kind, start, start + token->length);
+    }
+
+    if (!cur && !lexer_load(yyin)) return 0;
+    const char *start;
+    int kind = lexer_next(select_kernels(), cur, buf_end, &start, &cur);
+    if (kind == 0) {
+        lexer_release();
+        return 0;
+    }
+    return lexer_token_value(kind, start, cur);
+}
+
+// ========================================
+// 自检
+// ========================================
+
+// 固定的整数常量：边界值与各进制的溢出
+static const char *const check_literals[] = {
+    "0", "7", "2147483647", "2147483648", "4294967295", "4294967296",
+    "9223372036854775807", "9223372036854775808", "18446744073709551615", "18446744073709551616",
+    "99999999999999999999999999", "0x7fffffff", "0X80000000", "0xffffffff", "0x7fffffffffffffff",
+    "0x8000000000000000", "0x10000000000000000", "0xFFFFFFFFFFFFFFFFFFFF", "017", "037777777777",
+    "0777777777777777777777", "01000000000000000000000", "07777777777777777777777777",
+};
+
+// 扫描 text 中的一个整数常量，检查其覆盖整个文本且值与 strtol(text, NULL, 0) 一致
+static bool check_literal(const char *text) {
+    char source[64 + LEXER_PADDING] = {0};
+    size_t len = strlen(text);
+    if (len > 64) return false;
+    memcpy(source, text, len);
+    LexToken token;
+    if (lexer_scan(source, len, 0, &token) != INT_CONST || token.length != len) return false;
+    return lexer_number_token(source, source + len) == (int)strtol(text, NULL, 0);
+}
+
+int lexer_self_check(int iterations, unsigned seed, FILE *report) {
+    int failures = 0;
+
+    int mismatches = 0;
+    for (size_t i = 0; i < sizeof(check_literals) / sizeof(check_literals[0]); i++) {
+        if (!check_literal(check_literals[i])) {
+            fprintf(report, "  mismatch: %s\n", check_literals[i]);
+            mismatches++;
+        }
+    }
+    failures += mismatches != 0;
+    fprintf(report, "%-10s %6zu literals, %d mismatch(es)%s\n", "fixed", sizeof(check_literals) / sizeof(check_literals[0]),
+            mismatches, mismatches ? "  FAILED" : "");
+
+    // 随机数字串，长度 1 ~ 30，三种进制各占三分之一
+    unsigned state = seed ? seed : 1;
+    mismatches = 0;
+    for (int it = 0; it < iterations; it++) {
+        char text[40];
+        size_t n = 0;
+        state = state * 1103515245u + 12345u;
+        int base = (int)(state >> 16) % 3;
+        state = state * 1103515245u + 12345u;
+        size_t digits = 1 + (state >> 16) % 30;
+        if (base == 1) {
+            text[n++] = '0';
+            text[n++] = 'x';
+        } else if (base == 2) {
+            text[n++] = '0';
+        }
+        for (size_t i = 0; i < digits; i++) {
+            state = state * 1103515245u + 12345u;
+            unsigned r = state >> 16;
+            if (base == 1) text[n++] = "0123456789abcdefABCDEF"[r % 22];
+            else if (base == 2) text[n++] = (char)('0' + r % 8);
+            else text[n++] = (char)((i == 0 ? '1' : '0') + r % (i == 0 ? 9 : 10));
+        }
+        text[n] = '\0';
+        if (!check_literal(text)) {
+            if (mismatches < 10) fprintf(report, "  mismatch: %s\n", text);
+            mismatches++;
+        }
+    }
+    failures += mismatches != 0;
+    fprintf(report, "%-10s %6d literals, %d mismatch(es)%s\n", "random", iterations, mismatches,
+            mismatches ? "  FAILED" : "");
+
+    // 内嵌的 '\0' 结束输入，之后的内容不再扫描
+    char source[8 + LEXER_PADDING] = "1\0 2";
+    LexToken token;
+    bool ok = lexer_scan(source, 4, 0, &token) == INT_CONST && token.length == 1 &&
+              lexer_scan(source, 4, 1, &token) == 0;
+    failures += !ok;
+    fprintf(report, "%-10s %s\n", "nul", ok ? "ends input" : "does not end input  FAILED");
+    return failures;
+}
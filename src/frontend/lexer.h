@@ -0,0 +1,67 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+
+/**
+ * 手写词法分析器
+ * 与 sysy.l 保持同样的 token 约定：INT、RETURN、LE/GE/EQ/NE/AND/OR、
+ * IDENT（yylval.str_val，调用方负责释放）、INT_CONST（yylval.int_val）以及单字符 token。
+ * 空白、注释、标识符与数字串在 x86 上按 16/32 字节块（SSE2/AVX2）扫描，其他平台退化为逐字节扫描。
+ */
+
+// 输入缓冲区末尾的零填充，保证块读取越过末尾时不会访问非法内存
+#define LEXER_PADDING 64
+
+// 输入文件，与 Flex 的 yyin 同名，可直接替换
+extern FILE *yyin;
+
+/**
+ * 返回下一个 token，输入结束时返回 0
+ * 首次调用时一次性读入 yyin 的全部内容
+ */
+int yylex(void);
+
+/**
+ * 丢弃未读完的输入（如上次解析出错时），之后从 input 开始读取
+ * 与 Flex 的 yyrestart 同名同义
+ */
+void yyrestart(FILE *input);
+
+// 一个 token 在源码中的位置
+typedef struct {
+    int kind;           // 与 yylex 的返回值相同
+    uint32_t offset;    // 起始位置
+    uint32_t length;
+} LexToken;
+
+/**
+ * 扫描 source 中自 offset 起的下一个 token，不分配内存，也不影响 yylex 的状态
+ * source 的 len 字节之后须有 LEXER_PADDING 字节的零填充
+ * @return token 类型，输入结束时返回 0
+ */
+int lexer_scan(const char *source, size_t len, size_t offset, LexToken *token);
+
+/**
+ * 之后的 yylex 依次返回 tokens 中的 token（标识符与整数常量的值取自 source），
+ * 返回完 count 个后给出输入结束，再之后恢复为读取 yyin；用于只重新解析源码中的一部分
+ * yyrestart 会取消尚未返回完的回放
+ */
+void lexer_replay(const char *source, const LexToken *tokens, size_t count);
+
+/**
+ * 当前使用的扫描实现名称（"avx2"、"sse2" 或 "scalar"）
+ */
+const char *lexer_kernel_name(void);
+
+/**
+ * 词法分析器的自检
+ * 整数常量（固定的边界值与溢出值，以及随机数字串）的值须与 Flex 规则所用的 strtol(text, NULL, 0) 一致，
+ * 输入中内嵌的 '\0' 须结束输入（Flex 对它返回 0，解析器同样视为输入结束）
+ * @param iterations 随机数字串的个数
+ * @param seed 随机种子
+ * @param report 每项检查一行结果
+ * @return 失败的检查数，0 表示全部通过
+ */
+int lexer_self_check(int iterations, unsigned seed, FILE *report);
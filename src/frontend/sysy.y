@@ -3,17 +3,21 @@
 #include <stdlib.h>
 #include <string.h>
 #include "ast.h"
+#include "diag.h"
 
 int yylex();
-void yyerror(BaseAST **ast, const char *s);
+void yyerror(BaseAST **ast, ASTSink *sink, const char *s);
+static void add_func_def(ASTSink *sink, ASTList *list, BaseAST *func_def);
 %}
 
-%parse-param { BaseAST **ast }
+// sink 不为 NULL 时，每个函数定义归约后立即交给它处理
+%parse-param { BaseAST **ast } { ASTSink *sink }
 
 %union {
   char *str_val;
   int int_val;
   BaseAST *ast_val;
+  ASTList list_val;
 }
 
 %token INT RETURN
@@ -21,19 +25,53 @@ void yyerror(BaseAST **ast, const char *s);
 %token <str_val> IDENT
 %token <int_val> INT_CONST
 
-%type <ast_val> FuncDef FuncType Block Stmt Exp PrimaryExp UnaryExp MulExp AddExp RelExp EqExp LAndExp LOrExp Number
+%type <ast_val> FuncDef FuncType FuncFParam Block Stmt Exp PrimaryExp UnaryExp MulExp AddExp RelExp EqExp LAndExp LOrExp Number
+%type <list_val> FuncDefs FuncFParams FuncRParams
 
 %%
 
 CompUnit
-  : FuncDef {
+  : FuncDefs {
     *ast = create_comp_unit_ast($1);
   }
   ;
 
+FuncDefs
+  : FuncDef {
+    ast_list_init(&$$);
+    add_func_def(sink, &$$, $1);
+  }
+  | FuncDefs FuncDef {
+    $$ = $1;
+    add_func_def(sink, &$$, $2);
+  }
+  ;
+
 FuncDef
   : FuncType IDENT '(' ')' Block {
-    $$ = create_func_def_ast($1, $2, $5);
+    ASTList params;
+    ast_list_init(&params);
+    $$ = create_func_def_ast($1, $2, params, $5);
+  }
+  | FuncType IDENT '(' FuncFParams ')' Block {
+    $$ = create_func_def_ast($1, $2, $4, $6);
+  }
+  ;
+
+FuncFParams
+  : FuncFParam {
+    ast_list_init(&$$);
+    ast_list_push(&$$, $1);
+  }
+  | FuncFParams ',' FuncFParam {
+    $$ = $1;
+    ast_list_push(&$$, $3);
+  }
+  ;
+
+FuncFParam
+  : INT IDENT {
+    $$ = create_func_param_ast($2);
   }
   ;
 
@@ -66,6 +104,7 @@ Exp
 PrimaryExp
   : '(' Exp ')' { $$ = $2; }
   | Number { $$ = $1; }
+  | IDENT { $$ = create_lval_ast($1); }
   ;
 
 UnaryExp
@@ -73,6 +112,23 @@ UnaryExp
   | '+' UnaryExp { $$ = $2; }
   | '-' UnaryExp { $$ = create_unary_ast('-', $2); }
   | '!' UnaryExp { $$ = create_unary_ast('!', $2); }
+  | IDENT '(' ')' {
+    ASTList args;
+    ast_list_init(&args);
+    $$ = create_call_ast($1, args);
+  }
+  | IDENT '(' FuncRParams ')' { $$ = create_call_ast($1, $3); }
+  ;
+
+FuncRParams
+  : Exp {
+    ast_list_init(&$$);
+    ast_list_push(&$$, $1);
+  }
+  | FuncRParams ',' Exp {
+    $$ = $1;
+    ast_list_push(&$$, $3);
+  }
   ;
 
 MulExp
@@ -114,6 +170,11 @@ LOrExp
 
 %%
 
-void yyerror(BaseAST **ast, const char *s) {
-  fprintf(stderr, "error: %s\n", s);
+void yyerror(BaseAST **ast, ASTSink *sink, const char *s) {
+  fprintf(diag_err(), "error: %s\n", s);
+}
+
+static void add_func_def(ASTSink *sink, ASTList *list, BaseAST *func_def) {
+  if (sink && sink->func_def(func_def, sink->ctx)) return;
+  ast_list_push(list, func_def);
 }
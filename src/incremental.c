@@ -0,0 +1,437 @@
+#include "incremental.h"
+#include <assert.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include "diag.h"
+#include "codegen.h"
+#include "evalorder.h"
+#include "koopa_ir.h"
+#include "simplify.h"
+
+// 一个顶层函数：token 序列中的一段
+typedef struct {
+    uint32_t token_start;
+    uint32_t token_count;
+    FuncDefAST *def;            // 尚未解析或解析失败时为 NULL
+    uint32_t version;           // 每次重新解析时取新的编号
+    CallGraphRefs refs;         // 化简前收集的引用，用于重建调用图
+    int base_size;              // 化简后函数体中调用以外部分的大小
+    bool prepared;              // 已通过检查并做过化简与求值顺序
+    bool emitted;               // 本次编译需要输出
+    uint32_t *deps;             // 生成 text 时自身及展开进来的内联函数的 version，按展开顺序
+    uint32_t dep_count;
+    char *text;                 // 该函数的 Koopa IR 或汇编，尚未生成时为 NULL
+    size_t text_len;
+} IncrementalFunc;
+
+struct IncrementalSession {
+    IncrementalOptions options;
+    char *source;               // 上次的源码，之后为 LEXER_PADDING 字节的零填充
+    size_t len;
+    size_t cap;
+    char *scratch;              // 新源码的缓冲区，与 source 交替使用
+    size_t scratch_cap;
+
+    LexToken *tokens;
+    size_t token_count;
+    size_t token_cap;
+    size_t unclosed_comment;    // 第一个未闭合块注释（按 '/' '*' 两个 token 返回）的下标，没有时为 token_count
+
+    IncrementalFunc *funcs;     // 按源码顺序
+    int func_count;
+    uint32_t next_version;
+};
+
+IncrementalSession *incremental_session_create(const IncrementalOptions *options) {
+    IncrementalSession *session = calloc(1, sizeof(IncrementalSession));
+    assert(session);
+    session->options = *options;
+    session->options.riscv_options.stats = NULL;
+    return session;
+}
+
+static void func_free(IncrementalFunc *func) {
+    destroy_ast((BaseAST *)func->def);
+    callgraph_refs_free(&func->refs);
+    free(func->deps);
+    free(func->text);
+}
+
+void incremental_session_free(IncrementalSession *session) {
+    if (!session) return;
+    for (int i = 0; i < session->func_count; i++) func_free(&session->funcs[i]);
+    free(session->funcs);
+    free(session->tokens);
+    free(session->source);
+    free(session->scratch);
+    free(session);
+}
+
+// ========================================
+// 增量词法分析
+// ========================================
+
+static void reserve_tokens(IncrementalSession *s, size_t count) {
+    if (count <= s->token_cap) return;
+    size_t cap = s->token_cap ? s->token_cap : 1024;
+    while (cap < count) cap *= 2;
+    s->tokens = realloc(s->tokens, cap * sizeof(LexToken));
+    assert(s->tokens);
+    s->token_cap = cap;
+}
+
+static inline size_t token_end(const LexToken *token) {
+    return token->offset + token->length;
+}
+
+/**
+ * 扫描新源码中修改过的部分并替换原 token 序列中对应的 token
+ * 从修改处之前最后一个不受影响的 token 之后开始扫描，直到扫描出的 token 起始于修改之后未变的部分、
+ * 且恰好与原序列中的某个 token 对齐：此后的文本相同，扫描结果也必然相同
+ * 新序列中 [*first, *last) 为重新扫描得到的 token，它们替换了原序列中的 [*first, *old_last)
+ */
+static void relex(IncrementalSession *s, const char *src, size_t n, size_t *first, size_t *last, size_t *old_last) {
+    const char *old = s->source;
+    size_t m = s->len;
+    size_t limit = n < m ? n : m;
+    size_t prefix = 0;
+    while (prefix < limit && src[prefix] == old[prefix]) prefix++;
+    size_t suffix = 0;
+    while (suffix < limit - prefix && src[n - 1 - suffix] == old[m - 1 - suffix]) suffix++;
+
+    // 结束位置距修改处不到两个字符的 token 可能因修改而改变（如与插入的字符连成一个 token，
+    // 或 0x 前缀之后的字符），未闭合的块注释在修改中出现 */ 时也会改变
+    size_t lo = 0, hi = s->token_count;
+    while (lo < hi) {
+        size_t mid = lo + (hi - lo) / 2;
+        if (token_end(&s->tokens[mid]) + 1 < prefix) lo = mid + 1;
+        else hi = mid;
+    }
+    size_t start = lo < s->unclosed_comment ? lo : s->unclosed_comment;
+    size_t pos = start > 0 ? token_end(&s->tokens[start - 1]) : 0;
+
+    LexToken *fresh = NULL;
+    size_t fresh_count = 0, fresh_cap = 0;
+    ptrdiff_t delta = (ptrdiff_t)n - (ptrdiff_t)m;
+    size_t resume = s->token_count;
+    size_t j = start;
+    LexToken token;
+    while (lexer_scan(src, n, pos, &token)) {
+        if (token.offset >= n - suffix) {
+            size_t old_offset = (size_t)((ptrdiff_t)token.offset - delta);
+            while (j < s->token_count && s->tokens[j].offset < old_offset) j++;
+            if (j < s->token_count && s->tokens[j].offset == old_offset) {
+                resume = j;
+                break;
+            }
+        }
+        if (fresh_count == fresh_cap) {
+            fresh_cap = fresh_cap ? fresh_cap * 2 : 64;
+            fresh = realloc(fresh, fresh_cap * sizeof(LexToken));
+            assert(fresh);
+        }
+        fresh[fresh_count++] = token;
+        pos = token_end(&token);
+    }
+
+    // 拼接：未受影响的前缀、重新扫描的 token、平移后的原有后缀
+    size_t tail = s->token_count - resume;
+    reserve_tokens(s, start + fresh_count + tail);
+    memmove(s->tokens + start + fresh_count, s->tokens + resume, tail * sizeof(LexToken));
+    if (fresh_count) memcpy(s->tokens + start, fresh, fresh_count * sizeof(LexToken));
+    s->token_count = start + fresh_count + tail;
+    for (size_t i = start + fresh_count; i < s->token_count; i++) {
+        s->tokens[i].offset = (uint32_t)((ptrdiff_t)s->tokens[i].offset + delta);
+    }
+    free(fresh);
+
+    *first = start;
+    *last = start + fresh_count;
+    *old_last = resume;
+}
+
+// 把新源码复制到 scratch 并补零填充，与 source 中的上一次源码比较之后再交换两者
+static void load_source(IncrementalSession *s, const char *source, size_t len) {
+    if (s->scratch_cap < len + LEXER_PADDING) {
+        free(s->scratch);
+        s->scratch_cap = len + LEXER_PADDING;
+        s->scratch = malloc(s->scratch_cap);
+        assert(s->scratch);
+    }
+    memcpy(s->scratch, source, len);
+    memset(s->scratch + len, 0, LEXER_PADDING);
+}
+
+static void swap_source(IncrementalSession *s, size_t len) {
+    char *old = s->source;
+    size_t old_cap = s->cap;
+    s->source = s->scratch;
+    s->cap = s->scratch_cap;
+    s->len = len;
+    s->scratch = old;
+    s->scratch_cap = old_cap;
+}
+
+// ========================================
+// 函数划分与重新解析
+// ========================================
+
+/**
+ * 按花括号把 token 序列重新划分为顶层函数：每个函数止于使花括号层数回到 0 的 '}'，
+ * 最后一个函数之后剩余的 token 单独成为一段（解析时报错）
+ * 完全位于重新扫描范围之前或之后、且范围与原先某个函数一致的段沿用原函数，其余需要重新解析
+ */
+static void split_functions(IncrementalSession *s, size_t first, size_t last, size_t old_last) {
+    IncrementalFunc *old = s->funcs;
+    int old_count = s->func_count;
+    ptrdiff_t shift = (ptrdiff_t)last - (ptrdiff_t)old_last;
+
+    int cap = old_count > 0 ? old_count + 1 : 16;
+    IncrementalFunc *funcs = malloc(cap * sizeof(IncrementalFunc));
+    assert(funcs);
+    int count = 0;
+    int o = 0;
+    int depth = 0;
+    size_t seg_start = 0;
+    s->unclosed_comment = s->token_count;
+    for (size_t i = 0; i < s->token_count; i++) {
+        int kind = s->tokens[i].kind;
+        if (kind == '/' && s->unclosed_comment == s->token_count && i + 1 < s->token_count &&
+            s->tokens[i + 1].kind == '*' && s->tokens[i + 1].offset == s->tokens[i].offset + 1) {
+            s->unclosed_comment = i;
+        }
+        if (kind == '{') depth++;
+        if (kind == '}' && depth > 0) depth--;
+        if (!(kind == '}' && depth == 0) && i + 1 < s->token_count) continue;
+
+        size_t seg_end = i + 1;
+        if (count == cap) {
+            cap *= 2;
+            funcs = realloc(funcs, cap * sizeof(IncrementalFunc));
+            assert(funcs);
+        }
+        IncrementalFunc *func = &funcs[count++];
+
+        ptrdiff_t old_start = -1;
+        if (seg_end <= first) old_start = (ptrdiff_t)seg_start;
+        else if (seg_start >= last) old_start = (ptrdiff_t)seg_start - shift;
+        if (old_start >= 0) {
+            while (o < old_count && (ptrdiff_t)old[o].token_start < old_start) func_free(&old[o++]);
+            if (o < old_count && (ptrdiff_t)old[o].token_start == old_start &&
+                old[o].token_count == seg_end - seg_start) {
+                *func = old[o++];
+                func->token_start = (uint32_t)seg_start;
+                seg_start = seg_end;
+                continue;
+            }
+        }
+        memset(func, 0, sizeof(*func));
+        func->token_start = (uint32_t)seg_start;
+        func->token_count = (uint32_t)(seg_end - seg_start);
+        seg_start = seg_end;
+    }
+    while (o < old_count) func_free(&old[o++]);
+    free(old);
+    s->funcs = funcs;
+    s->func_count = count;
+}
+
+// 重新解析得到的函数定义依次交给尚未解析的函数
+typedef struct {
+    IncrementalSession *session;
+    int next;                   // 下一个尚未解析的函数
+} ParseState;
+
+static bool take_func_def(BaseAST *node, void *ctx) {
+    ParseState *st = ctx;
+    IncrementalSession *s = st->session;
+    while (st->next < s->func_count && s->funcs[st->next].def) st->next++;
+    if (st->next == s->func_count) return false;
+    IncrementalFunc *func = &s->funcs[st->next++];
+    func->def = (FuncDefAST *)node;
+    func->version = ++s->next_version;
+    callgraph_collect_refs(&func->refs, func->def);
+    func->prepared = false;
+    return true;
+}
+
+// 解析所有尚未解析的函数：它们的 token 拼接为一个序列一次解析完
+static int parse_functions(IncrementalSession *s, int *parsed) {
+    size_t count = 0;
+    *parsed = 0;
+    for (int i = 0; i < s->func_count; i++) {
+        if (!s->funcs[i].def) {
+            count += s->funcs[i].token_count;
+            (*parsed)++;
+        }
+    }
+    // 没有函数时同样交给解析器，报告与完整编译相同的错误
+    if (*parsed == 0 && s->func_count > 0) return 0;
+
+    LexToken *tokens = malloc((count ? count : 1) * sizeof(LexToken));
+    assert(tokens);
+    size_t n = 0;
+    for (int i = 0; i < s->func_count; i++) {
+        const IncrementalFunc *func = &s->funcs[i];
+        if (func->def) continue;
+        memcpy(tokens + n, s->tokens + func->token_start, func->token_count * sizeof(LexToken));
+        n += func->token_count;
+    }
+
+    ParseState st = {s, 0};
+    ASTSink sink = {take_func_def, &st};
+    int ret = s->options.parse(s->source, tokens, count, &sink);
+    free(tokens);
+    // 每段恰好解析出一个函数定义，否则（如花括号不配对）同样是语法错误
+    for (int i = 0; i < s->func_count && !ret; i++) ret = s->funcs[i].def == NULL;
+    if (ret) fprintf(diag_err(), "Parse error\n");
+    return ret;
+}
+
+// ========================================
+// 生成
+// ========================================
+
+typedef struct {
+    uint32_t *items;
+    uint32_t count;
+    uint32_t cap;
+} DepList;
+
+// 函数 f 生成的 IR 所依赖的 AST：自身及调用点上展开的内联函数（递归）
+static void collect_deps(const IncrementalSession *s, const CallGraph *cg, int f, DepList *deps) {
+    if (deps->count == deps->cap) {
+        deps->cap = deps->cap ? deps->cap * 2 : 16;
+        deps->items = realloc(deps->items, deps->cap * sizeof(uint32_t));
+        assert(deps->items);
+    }
+    deps->items[deps->count++] = s->funcs[f].version;
+    const CallGraphFunc *func = &cg->funcs[f];
+    for (int i = 0; i < func->callee_count; i++) {
+        if (cg->funcs[func->callees[i]].inlined) collect_deps(s, cg, func->callees[i], deps);
+    }
+}
+
+// 生成函数 f 的 Koopa IR，需要时再生成汇编
+static int generate_function(IncrementalSession *s, const CallGraph *cg, int f) {
+    IncrementalFunc *func = &s->funcs[f];
+    free(func->text);
+    func->text = NULL;
+
+    // 汇编：IR 连同被调用函数的声明一起单独解析，与流式编译相同
+    char *ir_buf = NULL;
+    size_t ir_size = 0;
+    FILE *ir_file = open_memstream(&ir_buf, &ir_size);
+    assert(ir_file);
+    CodeGenerator gen;
+    codegen_init(&gen, ir_file, cg);
+    if (s->options.riscv) codegen_callee_decls(&gen, f);
+    codegen_func_def(&gen, func->def);
+    fclose(ir_file);
+    if (!s->options.riscv) {
+        func->text = ir_buf;
+        func->text_len = ir_size;
+        return 0;
+    }
+
+    koopa_raw_program_builder_t builder;
+    koopa_raw_program_t raw;
+    if (parse_ir_from_string(ir_buf, &builder, &raw) != 0) {
+        fprintf(diag_err(), "Failed to parse Koopa IR\n");
+        free(ir_buf);
+        return -1;
+    }
+    FILE *code_file = open_memstream(&func->text, &func->text_len);
+    assert(code_file);
+    int ret = generate_riscv_from_raw_program(code_file, raw, &s->options.riscv_options);
+    fclose(code_file);
+    koopa_delete_raw_program_builder(builder);
+    free(ir_buf);
+    return ret;
+}
+
+int incremental_compile(IncrementalSession *s, const char *source, size_t len, IncrementalStats *stats) {
+    size_t first, last, old_last;
+    load_source(s, source, len);
+    relex(s, s->scratch, len, &first, &last, &old_last);
+    swap_source(s, len);
+    split_functions(s, first, last, old_last);
+
+    int parsed = 0;
+    if (parse_functions(s, &parsed) != 0) return 1;
+
+    // 语义检查与内联决策针对整个程序，未变的函数使用保存的引用与大小，不再遍历 AST
+    CallGraph cg;
+    callgraph_init(&cg);
+    int ret = 0;
+    for (int i = 0; i < s->func_count; i++) {
+        const IncrementalFunc *func = &s->funcs[i];
+        ret += callgraph_add_collected(&cg, func->def, &func->refs, func->prepared ? func->base_size : -1);
+    }
+    ret += callgraph_check_main(&cg);
+    if (ret) {
+        callgraph_free(&cg);
+        return 1;
+    }
+
+    // 化简与求值顺序只对新解析的函数进行，与完整编译一样化简在检查之后、内联决策之前
+    SimplifyStats simplify_stats;
+    simplify_stats_init(&simplify_stats);
+    for (int i = 0; i < s->func_count; i++) {
+        IncrementalFunc *func = &s->funcs[i];
+        if (func->prepared) continue;
+        if (s->options.simplify) simplify_func_def(func->def, &simplify_stats);
+        func->base_size = callgraph_base_size(func->def);
+        cg.funcs[i].base_size = func->base_size;
+    }
+    callgraph_plan_inlining(&cg, &s->options.inlining);
+    for (int i = 0; i < s->func_count; i++) {
+        if (!s->funcs[i].prepared && s->options.eval_order) eval_order_label_func_def(s->funcs[i].def);
+        s->funcs[i].prepared = true;
+    }
+
+    int generated = 0;
+    DepList deps = {NULL, 0, 0};
+    for (int i = 0; i < s->func_count && !ret; i++) {
+        IncrementalFunc *func = &s->funcs[i];
+        func->emitted = cg.funcs[i].emitted;
+        if (!func->emitted) continue;
+        deps.count = 0;
+        collect_deps(s, &cg, i, &deps);
+        if (func->text && func->dep_count == deps.count &&
+            memcmp(func->deps, deps.items, deps.count * sizeof(uint32_t)) == 0) {
+            continue;
+        }
+        free(func->deps);
+        func->deps = NULL;
+        func->dep_count = 0;
+        if (generate_function(s, &cg, i) != 0) {
+            ret = 1;
+            break;
+        }
+        func->deps = malloc(deps.count * sizeof(uint32_t));
+        assert(func->deps);
+        memcpy(func->deps, deps.items, deps.count * sizeof(uint32_t));
+        func->dep_count = deps.count;
+        generated++;
+    }
+    free(deps.items);
+    callgraph_free(&cg);
+
+    if (stats) {
+        stats->tokens = s->token_count;
+        stats->relexed_tokens = last - first;
+        stats->functions = s->func_count;
+        stats->parsed = parsed;
+        stats->generated = generated;
+    }
+    return ret;
+}
+
+void incremental_write(const IncrementalSession *s, FILE *output) {
+    for (int i = 0; i < s->func_count; i++) {
+        const IncrementalFunc *func = &s->funcs[i];
+        if (func->emitted) fwrite(func->text, 1, func->text_len, output);
+    }
+}
@@ -0,0 +1,71 @@
+#pragma once
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdio.h>
+#include "ast.h"
+#include "callgraph.h"
+#include "lexer.h"
+#include "riscv_gen.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * 以函数为粒度的增量编译
+ * 会话保留上一次编译的源码、token 序列、各函数的 AST 以及各函数的 IR 与汇编，
+ * 每次以新的完整源码编译时：
+ *   1. 与上次的源码比较出修改的字节范围，只重新扫描该范围内的 token，之后与原 token 序列重新对齐
+ *   2. 按花括号把 token 序列划分为顶层函数，只重新解析包含修改的函数
+ *   3. 语义检查与内联决策对整个程序重新进行（只遍历 AST，开销很小）
+ *   4. 函数自身及内联展开进来的函数都未重新解析时，复用其 IR 与汇编
+ * 输出与完整编译相同
+ */
+
+typedef struct IncrementalSession IncrementalSession;
+
+/**
+ * 解析回放的 token（lexer_replay），函数定义逐个交给 sink
+ * 由调用者提供，须与其他解析互斥
+ * @return 解析成功返回 0
+ */
+typedef int (*IncrementalParseFn)(const char *source, const LexToken *tokens, size_t count, ASTSink *sink);
+
+// 会话的编译选项，在会话的生命期内不变
+typedef struct {
+    bool riscv;                     // 输出 RISC-V 汇编，否则输出 Koopa IR
+    bool simplify;                  // 代数化简
+    bool eval_order;                // 按 Sethi–Ullman 标号安排求值顺序
+    InlineOptions inlining;
+    RiscvGenOptions riscv_options;  // 不支持 stats 与向 stderr 的报告
+    IncrementalParseFn parse;
+} IncrementalOptions;
+
+// 一次增量编译复用与重新生成的数量
+typedef struct {
+    size_t tokens;                  // token 总数
+    size_t relexed_tokens;          // 重新扫描得到的 token 数
+    int functions;                  // 函数总数
+    int parsed;                     // 重新解析的函数数
+    int generated;                  // 重新生成 IR（及汇编）的函数数
+} IncrementalStats;
+
+IncrementalSession *incremental_session_create(const IncrementalOptions *options);
+
+void incremental_session_free(IncrementalSession *session);
+
+/**
+ * 以新的完整源码编译，结果保存在会话中
+ * 出错时与完整编译一样在 stderr 报告，会话仍记录本次的源码，下次只需重新处理出错的函数
+ * @param stats 不为 NULL 时记录本次复用与重新生成的数量
+ * @return 成功返回 0
+ */
+int incremental_compile(IncrementalSession *session, const char *source, size_t len, IncrementalStats *stats);
+
+// 输出 incremental_compile 成功编译的结果（Koopa IR 或 RISC-V 汇编）
+void incremental_write(const IncrementalSession *session, FILE *output);
+
+#ifdef __cplusplus
+}
+#endif
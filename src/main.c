@@ -1,61 +1,57 @@
 #include <assert.h>
+#include <pthread.h>
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
 #include <unistd.h>
-#include <time.h>
 #include "ast.h"
+#include "ast_snapshot.h"
 #include "codegen.h"
+#include "diag.h"
+#include "evalorder.h"
+#ifndef USE_FLEX_LEXER
+#include "incremental.h"
+#include "lexer.h"
+#endif
 #include "koopa_ir.h"
+#include "passes.h"
+#include "profile.h"
 #include "riscv_gen.h"
+#include "server.h"
+#include "simplify.h"
+#include "ssa.h"
+#include "ssa_check.h"
+#include "stats.h"
 
 extern FILE *yyin;                                // Flex生成的全局指针，指向输入文本
-extern int yyparse(BaseAST **ast);                // Bison生成的全局指针，指向解析结果
+extern void yyrestart(FILE *input);               // 丢弃词法分析器的缓冲状态，从新的输入开始
+extern int yyparse(BaseAST **ast, ASTSink *sink); // Bison生成的全局指针，指向解析结果
 
-// 生成Koopa IR到字符串
-static char* generate_ir_to_string(BaseAST *ast, size_t *ir_size) {
-  char temp_filename[256];
-  snprintf(temp_filename, sizeof(temp_filename), "/tmp/koopa_ir_%ld.tmp", time(NULL));
-  
-  FILE *temp_file = fopen(temp_filename, "w+");
-  if (!temp_file) {
-    fprintf(stderr, "Failed to create temp file: %s\n", temp_filename);
+// 词法、语法分析器使用全局状态（yyin、yylval 与输入缓冲区），同一时刻只允许一个线程解析
+static pthread_mutex_t parse_lock = PTHREAD_MUTEX_INITIALIZER;
+
+// 解析输入，得到编译单元；sink 不为 NULL 时函数定义在解析过程中逐个交给它
+static int parse_input(FILE *input, BaseAST **ast, ASTSink *sink) {
+  pthread_mutex_lock(&parse_lock);
+  yyrestart(input);
+  int ret = yyparse(ast, sink);                   // yyparse解析成功返回0
+  pthread_mutex_unlock(&parse_lock);
+  if (ret) fprintf(diag_err(), "Parse error\n");
+  return ret;
+}
+
+// 生成Koopa IR到字符串（内存流，多个编译可以并发进行）
+static char* generate_ir_to_string(BaseAST *ast, const CallGraph *callgraph, size_t *ir_size) {
+  char *ir_buf = NULL;
+  FILE *ir_file = open_memstream(&ir_buf, ir_size);
+  if (!ir_file) {
+    fprintf(diag_err(), "Failed to allocate memory\n");
     return NULL;
   }
-  
-  // 生成IR到临时文件
+
   CodeGenerator gen_mem;
-  codegen_program(&gen_mem, temp_file, ast);
-  
-  // 获取文件大小
-  fseek(temp_file, 0, SEEK_END);
-  long file_size = ftell(temp_file);
-  fseek(temp_file, 0, SEEK_SET);
-  
-  if (file_size < 0) {
-    fprintf(stderr, "Failed to get file size\n");
-    fclose(temp_file);
-    unlink(temp_filename);
-    return NULL;
-  }
-  
-  // 分配内存并读取文件内容
-  char *ir_buf = malloc(file_size + 1);
-  if (!ir_buf) {
-    fprintf(stderr, "Failed to allocate memory\n");
-    fclose(temp_file);
-    unlink(temp_filename);
-    return NULL;
-  }
-  
-  size_t read_size = fread(ir_buf, 1, file_size, temp_file);
-  ir_buf[read_size] = '\0';
-  *ir_size = read_size;
-  
-  // 销毁临时文件
-  fclose(temp_file);
-  unlink(temp_filename);
-  
+  codegen_program(&gen_mem, ir_file, ast, callgraph);
+  fclose(ir_file);
   return ir_buf;
 }
 
@@ -63,7 +59,7 @@ static char* generate_ir_to_string(BaseAST *ast, size_t *ir_size) {
 static int write_to_file(const char *filename, const char *content, size_t size) {
   FILE *output_file = fopen(filename, "w");
   if (!output_file) {
-    fprintf(stderr, "Failed to open output file: %s\n", filename);
+    fprintf(diag_err(), "Failed to open output file: %s\n", filename);
     return -1;
   }
   
@@ -75,83 +71,763 @@ static int write_to_file(const char *filename, const char *content, size_t size)
 // 解析Koopa IR为raw program
 static int parse_ir_to_raw_program(const char *ir_buf, koopa_raw_program_builder_t *builder, koopa_raw_program_t *raw) {
   if (parse_ir_from_string(ir_buf, builder, raw) != 0) {
-    fprintf(stderr, "Failed to parse Koopa IR\n");
+    fprintf(diag_err(), "Failed to parse Koopa IR\n");
     return -1;
   }
   return 0;
 }
 
-int main(int argc, const char *argv[]) {
-  assert(argc == 5);
-  const char *mode = argv[1];
-  const char *input = argv[2];
-  const char *output = argv[4];
+// 记录一个函数的化简规则触发次数
+static void record_simplify_stats(CompileStats *stats, const char *function, const SimplifyStats *simplify) {
+  FuncStats *func = compile_stats_function(stats, function);
+  char key[64];
+  for (int i = 0; simplify_rule_name(i); i++) {
+    if (simplify->counts[i] == 0) continue;
+    snprintf(key, sizeof(key), "passes.simplify.%s", simplify_rule_name(i));
+    func_stats_add(func, key, simplify->counts[i]);
+  }
+}
 
-  yyin = fopen(input, "r");                       // 打开输入文件
-  assert(yyin);                                   // 断言用于检测打开有效性，失败则终止
+// 记录函数中展开的内联调用点数
+static void record_inline_stats(CompileStats *stats, const CallGraph *callgraph, int index) {
+  const CallGraphFunc *caller = &callgraph->funcs[index];
+  int expanded = 0;
+  for (int i = 0; i < caller->callee_count; i++) expanded += callgraph->funcs[caller->callees[i]].inlined;
+  func_stats_set(compile_stats_function(stats, caller->name), "passes.inline.expanded_calls", expanded);
+}
 
-  BaseAST *ast = NULL;
-  int ret = yyparse(&ast);                        // yyparse解析成功返回0
-  if (ret) {
-    fprintf(stderr, "Parse error\n");
-    return 1;
+// 化简一个函数，累计到 total，需要统计时另按函数记录
+static void simplify_function(FuncDefAST *def, SimplifyStats *total, CompileStats *stats) {
+  SimplifyStats func_stats;
+  simplify_stats_init(&func_stats);
+  simplify_func_def(def, &func_stats);
+  for (int i = 0; i < SIMPLIFY_MAX_RULES; i++) total->counts[i] += func_stats.counts[i];
+  if (stats) record_simplify_stats(stats, def->ident, &func_stats);
+}
+
+// 为函数安排求值顺序，需要统计时记录改为先求值右侧的运算个数
+static void order_function(FuncDefAST *def, CompileStats *stats) {
+  int reordered = eval_order_label_func_def(def);
+  if (stats) func_stats_set(compile_stats_function(stats, def->ident), "passes.order.reordered", reordered);
+}
+
+// 流式编译状态：每个函数解析完成后立即生成代码并释放，峰值内存只取决于最大的单个函数
+typedef struct {
+  bool riscv;                                     // 输出 RISC-V 汇编，否则输出 Koopa IR
+  FILE *output;
+  CallGraph callgraph;
+  const InlineOptions *inline_options;
+  const RiscvGenOptions *riscv_options;
+  bool simplify;                                  // 生成前做代数化简
+  SimplifyStats simplify_stats;
+  bool eval_order;                                // 按标号安排求值顺序
+  CompileStats *stats;                            // 代码质量统计，不需要时为 NULL
+  int errors;
+} StreamState;
+
+// 由解析器在每个函数定义归约后调用：检查、生成并释放该函数
+static bool stream_func_def(BaseAST *node, void *ctx) {
+  StreamState *st = ctx;
+  const FuncDefAST *def = (const FuncDefAST *)node;
+  int errors = callgraph_add_function(&st->callgraph, def);
+  int index = st->callgraph.count - 1;
+  st->errors += errors;
+  if (errors == 0) {
+    if (st->simplify) simplify_function((FuncDefAST *)node, &st->simplify_stats, st->stats);
+    callgraph_plan_added(&st->callgraph, st->inline_options);
+    if (st->stats && st->inline_options->enabled) record_inline_stats(st->stats, &st->callgraph, index);
+    if (st->eval_order) order_function((FuncDefAST *)node, st->stats);
   }
 
-  if (strcmp(mode, "-koopa") == 0) {
-    // 生成 Koopa IR
-    size_t ir_size = 0;
-    char *ir_buf = generate_ir_to_string(ast, &ir_size);
-    if (!ir_buf) {
-      destroy_ast(ast);
-      return 1;
-    }
+  if (st->errors == 0) {
+    CodeGenerator gen;
+    if (!st->riscv && !st->stats) {
+      codegen_init(&gen, st->output, &st->callgraph);
+      codegen_func_def(&gen, def);
+    } else {
+      // 单个函数的 IR 连同其调用到的函数的声明一起解析，生成汇编或统计后即释放
+      char *ir_buf = NULL;
+      size_t ir_size = 0;
+      FILE *ir_file = open_memstream(&ir_buf, &ir_size);
+      assert(ir_file);
+      codegen_init(&gen, ir_file, &st->callgraph);
+      codegen_callee_decls(&gen, index);
+      fflush(ir_file);
+      size_t decl_size = ir_size;
+      codegen_func_def(&gen, def);
+      fclose(ir_file);
+      // 输出 Koopa IR 时不含声明
+      if (!st->riscv) fwrite(ir_buf + decl_size, 1, ir_size - decl_size, st->output);
 
-    // 将 IR 写入目标输出文件
-    if (write_to_file(output, ir_buf, ir_size) != 0) {
+      koopa_raw_program_builder_t builder;
+      koopa_raw_program_t raw;
+      if (parse_ir_to_raw_program(ir_buf, &builder, &raw) != 0) {
+        st->errors++;
+      } else {
+        if (st->stats) koopa_ir_record_stats(raw, st->stats);
+        if (st->riscv && generate_riscv_from_raw_program(st->output, raw, st->riscv_options) != 0) st->errors++;
+        koopa_delete_raw_program_builder(builder);
+      }
       free(ir_buf);
-      destroy_ast(ast);
-      return 1;
     }
-  } else if (strcmp(mode, "-riscv") == 0) {
-    // 生成 Koopa IR
-    size_t ir_size = 0;
-    char *ir_buf = generate_ir_to_string(ast, &ir_size);
-    if (!ir_buf) {
-      destroy_ast(ast);
+  }
+
+  // 内联的函数之后还要在调用点展开，保留其 AST
+  CallGraphFunc *func = &st->callgraph.funcs[index];
+  if (!func->inlined) {
+    func->def = NULL;
+    destroy_ast(node);
+  }
+  return true;
+}
+
+// 编译选项，由命令行中 -o output 之后的参数决定
+typedef struct {
+  PassPipeline passes;                            // 启用的优化遍，决定下面各阶段的开关
+  RiscvGenOptions riscv;
+  InlineOptions inlining;
+  bool stream;                                    // 流式编译
+  bool simplify;                                  // 代数化简（simplify 遍）
+  bool report_simplify;                           // 输出化简规则的触发次数
+  bool eval_order;                                // 按 Sethi–Ullman 标号安排求值顺序（order 遍）
+  bool stats;                                     // 输出每个函数的代码质量统计（JSON）
+  bool incremental;                               // 增量编译，复用同一输出上一次编译的结果
+  bool report_incremental;                        // 输出增量编译复用与重新生成的数量
+  const char *profile_use;                        // 剖析数据文件，用于内联与函数布局
+} CompileOptions;
+
+// 是否为优化级别选项 -O0 ~ -O2
+static bool is_level_option(const char *arg) {
+  return arg[0] == '-' && arg[1] == 'O' && arg[2] >= '0' && arg[2] <= '0' + PASS_MAX_LEVEL && arg[3] == '\0';
+}
+
+// 解析 -o 之后的可选参数，出错时返回非零
+static int parse_options(int argc, const char *const *argv, CompileOptions *options) {
+  riscv_gen_options_default(&options->riscv);
+  inline_options_default(&options->inlining);
+  options->stream = false;
+  options->report_simplify = false;
+  options->stats = false;
+  options->incremental = false;
+  options->report_incremental = false;
+  options->profile_use = NULL;
+
+  // 优化级别先于逐个启用、禁用遍的选项生效，与它们在命令行中的先后无关
+  int level = PASS_DEFAULT_LEVEL;
+  for (int i = 0; i < argc; i++) {
+    if (is_level_option(argv[i])) level = argv[i][2] - '0';
+  }
+  pass_pipeline_init(&options->passes, level);
+
+  for (int i = 0; i < argc; i++) {
+    if (is_level_option(argv[i])) {
+      continue;
+    } else if ((strcmp(argv[i], "-enable-pass") == 0 || strcmp(argv[i], "-disable-pass") == 0) && i + 1 < argc) {
+      bool enable = argv[i][1] == 'e';
+      if (pass_pipeline_set(&options->passes, argv[++i], enable) != 0) return 1;
+    } else if (strcmp(argv[i], "-stream") == 0) {
+      options->stream = true;
+    } else if (strcmp(argv[i], "-incremental") == 0) {
+      options->incremental = true;
+    } else if (strcmp(argv[i], "-incremental-stats") == 0) {
+      options->report_incremental = true;
+    } else if (strcmp(argv[i], "-no-simplify") == 0) {
+      options->passes.enabled[PASS_SIMPLIFY] = false;
+    } else if (strcmp(argv[i], "-simplify-stats") == 0) {
+      options->report_simplify = true;
+    } else if (strcmp(argv[i], "-stats") == 0) {
+      options->stats = true;
+    } else if (strcmp(argv[i], "-no-inline") == 0) {
+      options->passes.enabled[PASS_INLINE] = false;
+    } else if (strcmp(argv[i], "-inline-limit") == 0 && i + 1 < argc) {
+      options->inlining.limit = atoi(argv[++i]);
+    } else if (strcmp(argv[i], "-inline-stats") == 0) {
+      options->inlining.report = true;
+    } else if (strcmp(argv[i], "-inline-hot-limit") == 0 && i + 1 < argc) {
+      options->inlining.hot_limit = atoi(argv[++i]);
+    } else if (strcmp(argv[i], "-profile-gen") == 0 && i + 1 < argc) {
+      options->riscv.profile_gen = argv[++i];
+    } else if (strcmp(argv[i], "-profile-use") == 0 && i + 1 < argc) {
+      options->profile_use = argv[++i];
+    } else if (strcmp(argv[i], "-no-sched") == 0) {
+      options->passes.enabled[PASS_SCHED] = false;
+    } else if (strcmp(argv[i], "-target") == 0 && i + 1 < argc) {
+      options->riscv.target = riscv_target_lookup(argv[++i]);
+      if (!options->riscv.target) {
+        fprintf(diag_err(), "Unknown target: %s\n", argv[i]);
+        return 1;
+      }
+    } else if (strcmp(argv[i], "-rvc") == 0) {
+      options->riscv.compress = true;
+    } else if (strcmp(argv[i], "-size-stats") == 0) {
+      options->riscv.report_size = true;
+    } else if (strcmp(argv[i], "-no-dce") == 0) {
+      options->passes.enabled[PASS_DCE] = false;
+    } else if (strcmp(argv[i], "-sched-stats") == 0) {
+      options->riscv.report_cycles = true;
+    } else if (strcmp(argv[i], "-sched-latency") == 0 && i + 1 < argc) {
+      if (riscv_latency_parse(&options->riscv.latency, argv[++i]) != 0) {
+        fprintf(diag_err(), "Invalid latency model: %s\n", argv[i]);
+        return 1;
+      }
+    } else {
+      fprintf(diag_err(), "Unknown option: %s\n", argv[i]);
       return 1;
     }
+  }
+
+  const bool *enabled = options->passes.enabled;
+  options->simplify = enabled[PASS_SIMPLIFY];
+  options->inlining.enabled = enabled[PASS_INLINE];
+  options->eval_order = enabled[PASS_ORDER];
+  options->riscv.eliminate_dead = enabled[PASS_DCE];
+  options->riscv.fold = enabled[PASS_FOLD];
+  options->riscv.superopt = enabled[PASS_SUPEROPT];
+  options->riscv.schedule = enabled[PASS_SCHED];
+  return 0;
+}
+
+// 流式编译整个输入文件
+static int compile_streaming(const char *mode, FILE *input, const char *output, const CompileOptions *options,
+                             CompileStats *stats) {
+  StreamState st;
+  st.riscv = strcmp(mode, "-riscv") == 0;
+  st.output = fopen(output, "w");
+  if (!st.output) {
+    fprintf(diag_err(), "Failed to open output file: %s\n", output);
+    return 1;
+  }
+  callgraph_init(&st.callgraph);
+  st.inline_options = &options->inlining;
+  RiscvGenOptions riscv_options = options->riscv;
+  riscv_options.stats = stats;
+  st.riscv_options = &riscv_options;
+  st.simplify = options->simplify;
+  simplify_stats_init(&st.simplify_stats);
+  st.eval_order = options->eval_order;
+  st.stats = stats;
+  st.errors = 0;
+
+  // 各函数在解析过程中生成，整个编译都在解析锁内进行
+  BaseAST *ast = NULL;
+  ASTSink sink = {stream_func_def, &st};
+  int ret = parse_input(input, &ast, &sink);
+  if (!ret) st.errors += callgraph_check_main(&st.callgraph);
+  if (options->report_simplify) simplify_report(diag_err(), &st.simplify_stats);
 
-    // 解析 Koopa IR 为 raw program
-    koopa_raw_program_builder_t builder;
-    koopa_raw_program_t raw;
-    if (parse_ir_to_raw_program(ir_buf, &builder, &raw) != 0) {
+  for (int i = 0; i < st.callgraph.count; i++) {
+    if (st.callgraph.funcs[i].def) destroy_ast((BaseAST *)st.callgraph.funcs[i].def);
+  }
+  callgraph_free(&st.callgraph);
+  destroy_ast(ast);
+  fclose(st.output);
+  return ret || st.errors ? 1 : 0;
+}
+
+// 将 raw program 导入为 SSA IR，再导出为 Koopa IR 写入 output
+static int write_ssa_round_trip(koopa_raw_program_t raw, const char *output) {
+  SsaProgram prog;
+  if (ssa_import_koopa(&prog, raw) != 0) return 1;
+  FILE *output_file = fopen(output, "w");
+  if (!output_file) {
+    fprintf(diag_err(), "Failed to open output file: %s\n", output);
+    ssa_program_free(&prog);
+    return 1;
+  }
+  ssa_emit_koopa(output_file, &prog);
+  ssa_program_free(&prog);
+  return fclose(output_file) != 0;
+}
+
+// 由 AST 生成 Koopa IR、RISC-V 汇编或经 SSA IR 往返的 Koopa IR 并写入 output
+static int generate_output(const char *mode, BaseAST *ast, const CallGraph *callgraph, const char *output,
+                           const CompileOptions *options, CompileStats *stats) {
+  // 生成 Koopa IR
+  size_t ir_size = 0;
+  char *ir_buf = generate_ir_to_string(ast, callgraph, &ir_size);
+  if (!ir_buf) return 1;
+
+  bool riscv = strcmp(mode, "-riscv") == 0;
+  bool ssa = strcmp(mode, "-ssa") == 0;
+  if (!riscv && !ssa) {
+    // 将 IR 写入目标输出文件
+    int ret = write_to_file(output, ir_buf, ir_size) != 0;
+    if (ret || !stats) {
       free(ir_buf);
-      destroy_ast(ast);
-      return 1;
+      return ret;
     }
+  }
 
-    // 生成 RISC-V 汇编代码到文件
+  // 解析 Koopa IR 为 raw program
+  koopa_raw_program_builder_t builder;
+  koopa_raw_program_t raw;
+  if (parse_ir_to_raw_program(ir_buf, &builder, &raw) != 0) {
+    free(ir_buf);
+    return 1;
+  }
+  if (stats) koopa_ir_record_stats(raw, stats);
+
+  // 生成 RISC-V 汇编代码到文件
+  int ret = 0;
+  if (ssa) {
+    ret = write_ssa_round_trip(raw, output);
+  } else if (riscv) {
     FILE *output_file = fopen(output, "w");
     if (!output_file) {
-      fprintf(stderr, "Failed to open output file: %s\n", output);
-      koopa_delete_raw_program_builder(builder);
-      free(ir_buf);
-      destroy_ast(ast);
-      return 1;
+      fprintf(diag_err(), "Failed to open output file: %s\n", output);
+      ret = 1;
+    } else {
+      RiscvGenOptions riscv_options = options->riscv;
+      riscv_options.stats = stats;
+      ret = generate_riscv_from_raw_program(output_file, raw, &riscv_options) != 0;
+      fclose(output_file);
     }
-    
-    generate_riscv_from_raw_program(output_file, raw);
-    fclose(output_file);
-    
-    koopa_delete_raw_program_builder(builder);
-    free(ir_buf);
-  } else if (strcmp(mode, "-ast") == 0){
+  }
+
+  koopa_delete_raw_program_builder(builder);
+  free(ir_buf);
+  return ret;
+}
+
+// 将 AST 快照写入 output
+static int write_snapshot(const BaseAST *ast, const char *output) {
+  FILE *output_file = fopen(output, "wb");
+  if (!output_file) {
+    fprintf(diag_err(), "Failed to open output file: %s\n", output);
+    return 1;
+  }
+  int ret = ast_snapshot_write(output_file, ast) != 0;
+  if (fclose(output_file) != 0) ret = 1;
+  if (ret) fprintf(diag_err(), "Failed to write AST snapshot: %s\n", output);
+  return ret;
+}
+
+// 由解析得到（或自快照载入）的 AST 完成编译，ast 由本函数释放
+static int compile_ast(const char *mode, BaseAST *ast, const char *output, const CompileOptions *options) {
+  bool generate = strcmp(mode, "-koopa") == 0 || strcmp(mode, "-riscv") == 0 || strcmp(mode, "-ssa") == 0;
+  CompileStats stats;
+  compile_stats_init(&stats);
+  CompileStats *func_stats = options->stats && generate ? &stats : NULL;
+  int ret = 0;
+
+  if (generate) {
+    // 语义检查并建立调用图，决定内联
+    CallGraph callgraph;
+    ret = callgraph_build(&callgraph, (const CompUnitAST *)ast) != 0;
+    if (!ret) {
+      // 检查通过后再化简：化简可能消去对未声明标识符的引用，但不会消去调用
+      if (options->simplify) {
+        const CompUnitAST *unit = (const CompUnitAST *)ast;
+        SimplifyStats simplify_stats;
+        simplify_stats_init(&simplify_stats);
+        for (int i = 0; i < unit->func_defs.count; i++) {
+          simplify_function((FuncDefAST *)unit->func_defs.items[i], &simplify_stats, func_stats);
+        }
+        if (options->report_simplify) simplify_report(diag_err(), &simplify_stats);
+      }
+      callgraph_plan_inlining(&callgraph, &options->inlining);
+      if (func_stats && options->inlining.enabled) {
+        for (int i = 0; i < callgraph.count; i++) record_inline_stats(func_stats, &callgraph, i);
+      }
+      if (options->eval_order) {
+        const CompUnitAST *unit = (const CompUnitAST *)ast;
+        for (int i = 0; i < unit->func_defs.count; i++) {
+          order_function((FuncDefAST *)unit->func_defs.items[i], func_stats);
+        }
+      }
+      ret = generate_output(mode, ast, &callgraph, output, options, func_stats);
+      if (!ret && func_stats) compile_stats_write_json(diag_err(), func_stats);
+    }
+    callgraph_free(&callgraph);
+  } else if (strcmp(mode, "-ast") == 0) {
     dump_ast(ast);
-    printf("\n");
+    fprintf(diag_out(), "\n");
+  } else if (strcmp(mode, "-ast-snapshot") == 0) {
+    ret = write_snapshot(ast, output);
+  } else {
+    fprintf(diag_out(), "Unknown command\n");
+  }
+
+  destroy_ast(ast);
+  compile_stats_free(&stats);
+  return ret;
+}
+
+// 编译一个输入，input 由本函数关闭
+static int compile(const char *mode, FILE *input, const char *output, const CompileOptions *options) {
+  bool generate = strcmp(mode, "-koopa") == 0 || strcmp(mode, "-riscv") == 0;
+  if (options->stream && generate) {
+    CompileStats stats;
+    compile_stats_init(&stats);
+    CompileStats *func_stats = options->stats ? &stats : NULL;
+    int ret = compile_streaming(mode, input, output, options, func_stats);
+    fclose(input);
+    if (!ret && func_stats) compile_stats_write_json(diag_err(), func_stats);
+    compile_stats_free(&stats);
+    return ret;
+  }
+
+  BaseAST *ast = NULL;
+  int ret = parse_input(input, &ast, NULL);
+  fclose(input);
+  if (ret) {
     destroy_ast(ast);
+    return 1;
+  }
+  return compile_ast(mode, ast, output, options);
+}
+
+static char *copy_string(const char *s) {
+  char *copy = malloc(strlen(s) + 1);
+  assert(copy);
+  return strcpy(copy, s);
+}
+
+// 读入输入流的全部内容
+static char *read_stream(FILE *input, size_t *len) {
+  char *buf = NULL;
+  FILE *out = open_memstream(&buf, len);
+  char chunk[65536];
+  size_t n;
+  while ((n = fread(chunk, 1, sizeof(chunk), input)) > 0) fwrite(chunk, 1, n, out);
+  fclose(out);
+  return buf;
+}
+
+#ifndef USE_FLEX_LEXER
+
+// 解析回放的 token，供增量编译使用
+static int parse_tokens(const char *source, const LexToken *tokens, size_t count, ASTSink *sink) {
+  BaseAST *ast = NULL;
+  pthread_mutex_lock(&parse_lock);
+  lexer_replay(source, tokens, count);
+  int ret = yyparse(&ast, sink);
+  pthread_mutex_unlock(&parse_lock);
+  destroy_ast(ast);
+  return ret;
+}
+
+/**
+ * 增量编译会话，以 mode、输出路径与其余选项区分
+ * 编辑器对同一文件的反复编译落在同一会话中，依次处理；会话过多时淘汰最久未用的空闲会话
+ */
+#define MAX_INCREMENTAL_SESSIONS 16
+
+typedef struct {
+  char *key;
+  IncrementalSession *session;
+  pthread_mutex_t lock;                           // 同一会话同一时刻只处理一个请求
+  int users;                                      // 正在使用的请求数，为 0 时才能淘汰
+  unsigned long last_used;
+} SessionEntry;
+
+static SessionEntry sessions[MAX_INCREMENTAL_SESSIONS];
+static int session_count = 0;
+static unsigned long session_clock = 0;
+static pthread_mutex_t sessions_lock = PTHREAD_MUTEX_INITIALIZER;
+
+// 会话的键：除输入路径外的全部参数
+static char *session_key(int argc, const char *const *argv) {
+  char *key = NULL;
+  size_t len = 0;
+  FILE *out = open_memstream(&key, &len);
+  for (int i = 0; i < argc; i++) {
+    if (i != 1) fprintf(out, "%s\n", argv[i]);
+  }
+  fclose(out);
+  return key;
+}
+
+// 取得键对应的会话（不存在时新建），返回 NULL 表示会话均在使用且已达上限
+static SessionEntry *acquire_session(const char *key, const IncrementalOptions *options) {
+  pthread_mutex_lock(&sessions_lock);
+  SessionEntry *entry = NULL;
+  for (int i = 0; i < session_count && !entry; i++) {
+    if (strcmp(sessions[i].key, key) == 0) entry = &sessions[i];
+  }
+  if (!entry) {
+    if (session_count < MAX_INCREMENTAL_SESSIONS) {
+      entry = &sessions[session_count++];
+      pthread_mutex_init(&entry->lock, NULL);
+    } else {
+      for (int i = 0; i < session_count; i++) {
+        if (sessions[i].users == 0 && (!entry || sessions[i].last_used < entry->last_used)) entry = &sessions[i];
+      }
+      if (entry) {
+        free(entry->key);
+        incremental_session_free(entry->session);
+      }
+    }
+    if (entry) {
+      entry->key = copy_string(key);
+      entry->session = incremental_session_create(options);
+    }
+  }
+  if (entry) {
+    entry->users++;
+    entry->last_used = ++session_clock;
+  }
+  pthread_mutex_unlock(&sessions_lock);
+  return entry;
+}
+
+static void release_session(SessionEntry *entry) {
+  pthread_mutex_lock(&sessions_lock);
+  entry->users--;
+  pthread_mutex_unlock(&sessions_lock);
+}
+
+static void free_sessions(void) {
+  for (int i = 0; i < session_count; i++) {
+    free(sessions[i].key);
+    incremental_session_free(sessions[i].session);
+    pthread_mutex_destroy(&sessions[i].lock);
+  }
+  session_count = 0;
+}
+
+// 在会话中编译 source 并写入 output
+static int compile_in_session(IncrementalSession *session, const char *source, size_t len, const char *output,
+                              const CompileOptions *options) {
+  IncrementalStats stats;
+  if (incremental_compile(session, source, len, &stats) != 0) return 1;
+  if (options->report_incremental) {
+    fprintf(diag_err(), "[incremental] tokens %zu (relexed %zu), functions %d (parsed %d, generated %d)\n",
+            stats.tokens, stats.relexed_tokens, stats.functions, stats.parsed, stats.generated);
+  }
+  FILE *output_file = fopen(output, "w");
+  if (!output_file) {
+    fprintf(diag_err(), "Failed to open output file: %s\n", output);
+    return 1;
+  }
+  incremental_write(session, output_file);
+  return fclose(output_file) != 0;
+}
+
+// 增量编译：mode 为 -koopa 或 -riscv，input 由本函数关闭
+static int compile_incremental(int argc, const char *const *argv, FILE *input, const CompileOptions *options) {
+  size_t len = 0;
+  char *source = read_stream(input, &len);
+  fclose(input);
+
+  IncrementalOptions inc_options;
+  inc_options.riscv = strcmp(argv[0], "-riscv") == 0;
+  inc_options.simplify = options->simplify;
+  inc_options.eval_order = options->eval_order;
+  inc_options.inlining = options->inlining;
+  inc_options.riscv_options = options->riscv;
+  inc_options.parse = parse_tokens;
+
+  char *key = session_key(argc, argv);
+  SessionEntry *entry = acquire_session(key, &inc_options);
+  free(key);
+  int ret;
+  if (entry) {
+    pthread_mutex_lock(&entry->lock);
+    ret = compile_in_session(entry->session, source, len, argv[3], options);
+    pthread_mutex_unlock(&entry->lock);
+    release_session(entry);
   } else {
-    printf("Unknown command\n");
+    // 会话均在使用，以临时会话完整编译一次
+    IncrementalSession *session = incremental_session_create(&inc_options);
+    ret = compile_in_session(session, source, len, argv[3], options);
+    incremental_session_free(session);
   }
-  
-  return 0;
+  free(source);
+  return ret;
+}
+
+#endif
+
+// 编译已打开的输入，按选项选择增量编译或完整编译，input 由本函数关闭
+static int compile_input(int argc, const char *const *argv, FILE *input, const CompileOptions *options) {
+  const char *mode = argv[0];
+#ifndef USE_FLEX_LEXER
+  // 增量编译只输出 IR 或汇编；需要统计或报告时每次完整编译
+  bool generate = strcmp(mode, "-koopa") == 0 || strcmp(mode, "-riscv") == 0;
+  bool report = options->stats || options->report_simplify || options->inlining.report ||
+                options->riscv.report_size || options->riscv.report_cycles;
+  if (options->incremental && generate && !report && !options->stream) {
+    return compile_incremental(argc, argv, input, options);
+  }
+#endif
+  return compile(mode, input, argv[3], options);
+}
+
+/**
+ * 按命令行参数编译一次：mode input -o output [options]
+ * @param input 已打开的输入，为 NULL 时打开 argv 中的输入路径
+ */
+static int compile_command(int argc, const char *const *argv, FILE *input) {
+  if (argc < 4) {
+    fprintf(diag_err(), "Usage: compiler <-koopa|-riscv|-ssa|-ast|-ast-snapshot> <input> -o <output> [options]\n");
+    if (input) fclose(input);
+    return 1;
+  }
+  const char *mode = argv[0];
+  const char *output = argv[3];
+
+  CompileOptions options;
+  if (parse_options(argc - 4, argv + 4, &options) != 0) {
+    if (input) fclose(input);
+    return 1;
+  }
+
+  Profile profile;
+  if (options.profile_use) {
+    if (profile_load(&profile, options.profile_use) != 0) {
+      if (input) fclose(input);
+      return 1;
+    }
+    options.inlining.profile = &profile;
+    options.riscv.profile = &profile;
+  }
+  // 剖析插桩的计数器与剖析数据都按整个程序处理，不逐个函数流式或增量编译
+  if (options.profile_use || options.riscv.profile_gen) {
+    options.stream = false;
+    options.incremental = false;
+  }
+
+  int ret;
+  if (!input && ast_snapshot_is_file(argv[1])) {
+    // 输入为 AST 快照时直接载入，跳过词法、语法分析
+    BaseAST *ast = ast_snapshot_load(argv[1]);
+    ret = ast ? compile_ast(mode, ast, output, &options) : 1;
+  } else if (!input && !(input = fopen(argv[1], "r"))) {
+    fprintf(diag_err(), "Failed to open input file: %s\n", argv[1]);
+    ret = 1;
+  } else {
+    ret = compile_input(argc, argv, input, &options);
+  }
+  if (options.profile_use) profile_free(&profile);
+  return ret;
+}
+
+// 编译服务的请求处理，由各工作线程并发调用；本线程的输出改写到该请求的 out / err
+static int serve_request(const CompileRequest *request, FILE *out, FILE *err) {
+  FILE *input = NULL;
+  if (request->source) {
+    input = fmemopen(request->source, request->source_len, "r");
+    if (!input) return 1;
+  }
+  diag_redirect(out, err);
+  int ret = compile_command(request->argc, (const char *const *)request->argv, input);
+  diag_redirect(NULL, NULL);
+  return ret;
+}
+
+// 相对路径按客户端的工作目录转为绝对路径，调用者释放
+static char *absolute_path(const char *path) {
+  char cwd[4096];
+  if (path[0] == '/' || !getcwd(cwd, sizeof(cwd))) return copy_string(path);
+  char *result = malloc(strlen(cwd) + strlen(path) + 2);
+  sprintf(result, "%s/%s", cwd, path);
+  return result;
+}
+
+/**
+ * 客户端：把与直接编译相同的参数发给编译服务，退出状态与直接编译一致
+ * 输入为 - 时从标准输入读取源码随请求发送；服务端编译时的输出与诊断信息原样写到客户端的 stdout / stderr
+ */
+static int run_client(const char *socket_path, int argc, const char *const *argv) {
+  int fd = client_connect(socket_path);
+  if (fd < 0) {
+    fprintf(stderr, "Cannot connect to compile server at %s\n", socket_path);
+    return 1;
+  }
+  if (argc == 1 && strcmp(argv[0], "--shutdown") == 0) {
+    int ret = client_shutdown(fd) != 0;
+    close(fd);
+    return ret;
+  }
+
+  CompileRequest request;
+  request.argc = argc;
+  request.argv = malloc((argc ? argc : 1) * sizeof(char *));
+  for (int i = 0; i < argc; i++) {
+    // 剖析数据文件由服务端读取；-profile-gen 的路径写入生成的程序，在其运行时的工作目录下解析
+    bool is_path = (i == 1 && strcmp(argv[i], "-") != 0) || i == 3 || (i > 4 && strcmp(argv[i - 1], "-profile-use") == 0);
+    request.argv[i] = is_path ? absolute_path(argv[i]) : copy_string(argv[i]);
+  }
+  request.source = NULL;
+  request.source_len = 0;
+  if (argc >= 2 && strcmp(argv[1], "-") == 0) request.source = read_stream(stdin, &request.source_len);
+
+  int status = 1;
+  if (client_compile(fd, &request, &status, stdout, stderr) != 0) {
+    fprintf(stderr, "Lost connection to compile server\n");
+    status = 1;
+  }
+  close(fd);
+  for (int i = 0; i < argc; i++) free(request.argv[i]);
+  free(request.argv);
+  free(request.source);
+  return status;
+}
+
+int main(int argc, const char *argv[]) {
+  // 代数化简规则的随机化自检：compiler -simplify-check [iterations] [seed]
+  if (argc >= 2 && strcmp(argv[1], "-simplify-check") == 0) {
+    int iterations = argc >= 3 ? atoi(argv[2]) : 10000;
+    unsigned seed = argc >= 4 ? (unsigned)strtoul(argv[3], NULL, 10) : 1;
+    return simplify_self_check(iterations, seed, stdout) == 0 ? 0 : 1;
+  }
+
+#ifndef USE_FLEX_LEXER
+  // 手写词法分析器与 Flex 规则的一致性自检：compiler -lexer-check [iterations] [seed]
+  if (argc >= 2 && strcmp(argv[1], "-lexer-check") == 0) {
+    int iterations = argc >= 3 ? atoi(argv[2]) : 100000;
+    unsigned seed = argc >= 4 ? (unsigned)strtoul(argv[3], NULL, 10) : 1;
+    return lexer_self_check(iterations, seed, stdout) == 0 ? 0 : 1;
+  }
+#endif
+
+  // AST 快照载入校验的自检：compiler -snapshot-check
+  if (argc >= 2 && strcmp(argv[1], "-snapshot-check") == 0) {
+    return ast_snapshot_self_check(stdout) == 0 ? 0 : 1;
+  }
+
+  // SSA 编辑接口与死代码删除的自检：compiler -ssa-check
+  if (argc >= 2 && strcmp(argv[1], "-ssa-check") == 0) {
+    return ssa_self_check(stdout) == 0 ? 0 : 1;
+  }
+
+  // 列出优化遍及其在给定选项下是否启用：compiler -list-passes [options]
+  if (argc >= 2 && strcmp(argv[1], "-list-passes") == 0) {
+    CompileOptions options;
+    if (parse_options(argc - 2, argv + 2, &options) != 0) return 1;
+    pass_pipeline_list(stdout, &options.passes);
+    return 0;
+  }
+
+  // 以文本输出剖析数据：compiler -profile-show <file>
+  if (argc >= 3 && strcmp(argv[1], "-profile-show") == 0) {
+    Profile profile;
+    if (profile_load(&profile, argv[2]) != 0) return 1;
+    profile_dump(stdout, &profile);
+    profile_free(&profile);
+    return 0;
+  }
+
+  // 编译服务：compiler --server <socket> [-j workers]
+  if (argc >= 3 && strcmp(argv[1], "--server") == 0) {
+    int workers = SERVER_DEFAULT_WORKERS;
+    if (argc >= 5 && strcmp(argv[3], "-j") == 0) workers = atoi(argv[4]);
+    int ret = server_run(argv[2], workers, serve_request);
+#ifndef USE_FLEX_LEXER
+    free_sessions();
+#endif
+    return ret;
+  }
+
+  // 客户端：compiler --client <socket> <与直接编译相同的参数> 或 --shutdown
+  if (argc >= 4 && strcmp(argv[1], "--client") == 0) {
+    return run_client(argv[2], argc - 3, argv + 3);
+  }
+
+  int ret = compile_command(argc - 1, argv + 1, NULL);
+#ifndef USE_FLEX_LEXER
+  free_sessions();
+#endif
+  return ret;
 }
@@ -0,0 +1,359 @@
+#include "callgraph.h"
+#include <assert.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "diag.h"
+
+// 一次调用在调用点的固定开销（call、返回值传送以及调用者保存 ra 的分摊），每个实参另加一条传送
+#define CALL_SITE_COST 4
+// 保留一份函数体的固定开销（ret 之外的序言、尾声等）
+#define FUNC_BODY_COST 2
+// 内联后函数体超过此大小的函数不再内联，避免单调用点的长调用链全部展开成一个巨大的函数
+#define INLINE_MAX_SIZE 256
+
+void inline_options_default(InlineOptions *options) {
+    options->enabled = true;
+    options->limit = 16;
+    options->report = false;
+    options->profile = NULL;
+    options->hot_limit = 128;
+}
+
+void callgraph_init(CallGraph *cg) {
+    cg->funcs = NULL;
+    cg->count = 0;
+}
+
+int callgraph_find(const CallGraph *cg, const char *name) {
+    for (int i = 0; i < cg->count; i++) {
+        if (strcmp(cg->funcs[i].name, name) == 0) return i;
+    }
+    return -1;
+}
+
+static int param_index(const FuncDefAST *func, const char *name) {
+    for (int i = 0; i < func->params.count; i++) {
+        if (strcmp(((const FuncParamAST *)func->params.items[i])->ident, name) == 0) return i;
+    }
+    return -1;
+}
+
+static void add_callee(CallGraphFunc *func, int callee) {
+    func->callees = realloc(func->callees, (func->callee_count + 1) * sizeof(int));
+    assert(func->callees);
+    func->callees[func->callee_count++] = callee;
+}
+
+// 按检查顺序收集表达式中的调用点与未声明的标识符（调用的实参先于调用本身）
+static void collect_refs(CallGraphRefs *refs, const FuncDefAST *func, const BaseAST *expr) {
+    const char *name = NULL;
+    int arg_count = -1;
+    switch (expr->type) {
+        case AST_NUMBER:
+            return;
+        case AST_UNARY:
+            collect_refs(refs, func, ((const UnaryAST *)expr)->operand);
+            return;
+        case AST_BINARY: {
+            const BinaryAST *b = (const BinaryAST *)expr;
+            collect_refs(refs, func, b->left);
+            collect_refs(refs, func, b->right);
+            return;
+        }
+        case AST_LVAL: {
+            const LValAST *lval = (const LValAST *)expr;
+            if (param_index(func, lval->ident) >= 0) return;
+            name = lval->ident;
+            break;
+        }
+        case AST_CALL: {
+            const CallAST *call = (const CallAST *)expr;
+            for (int i = 0; i < call->args.count; i++) collect_refs(refs, func, call->args.items[i]);
+            name = call->ident;
+            arg_count = call->args.count;
+            break;
+        }
+        default:
+            assert(0 && "Unknown expression type");
+            return;
+    }
+    refs->refs = realloc(refs->refs, (refs->ref_count + 1) * sizeof(CallGraphRef));
+    assert(refs->refs);
+    CallGraphRef *ref = &refs->refs[refs->ref_count++];
+    ref->name = malloc(strlen(name) + 1);
+    assert(ref->name);
+    strcpy(ref->name, name);
+    ref->arg_count = arg_count;
+}
+
+void callgraph_collect_refs(CallGraphRefs *refs, const FuncDefAST *def) {
+    refs->refs = NULL;
+    refs->ref_count = 0;
+    const BlockAST *block = (const BlockAST *)def->block;
+    collect_refs(refs, def, ((const StmtAST *)block->stmt)->expr);
+}
+
+void callgraph_refs_free(CallGraphRefs *refs) {
+    for (int i = 0; i < refs->ref_count; i++) free(refs->refs[i].name);
+    free(refs->refs);
+    refs->refs = NULL;
+    refs->ref_count = 0;
+}
+
+/**
+ * 检查函数体中的引用并记录其中的调用
+ * 只能调用已定义的函数或自身（SysY 没有函数声明）
+ */
+static int check_refs(CallGraph *cg, int caller, const CallGraphRefs *refs) {
+    const FuncDefAST *func = cg->funcs[caller].def;
+    int errors = 0;
+    for (int i = 0; i < refs->ref_count; i++) {
+        const CallGraphRef *ref = &refs->refs[i];
+        if (ref->arg_count < 0) {
+            fprintf(diag_err(), "error: '%s' undeclared in function '%s'\n", ref->name, func->ident);
+            errors++;
+            continue;
+        }
+        int callee = callgraph_find(cg, ref->name);
+        if (callee < 0) {
+            fprintf(diag_err(), "error: call to undefined function '%s' in '%s'\n", ref->name, func->ident);
+            errors++;
+            continue;
+        }
+        int expected = cg->funcs[callee].param_count;
+        if (ref->arg_count != expected) {
+            fprintf(diag_err(), "error: '%s' expects %d argument(s), %d given\n", ref->name, expected, ref->arg_count);
+            errors++;
+            continue;
+        }
+        add_callee(&cg->funcs[caller], callee);
+        cg->funcs[callee].call_sites++;
+    }
+    return errors;
+}
+
+// 加入一个函数并检查其函数体
+static int add_function(CallGraph *cg, const FuncDefAST *def, const CallGraphRefs *refs, int base_size) {
+    int errors = 0;
+    if (callgraph_find(cg, def->ident) >= 0) {
+        fprintf(diag_err(), "error: redefinition of function '%s'\n", def->ident);
+        errors++;
+    }
+    for (int p = 0; p < def->params.count; p++) {
+        const char *name = ((const FuncParamAST *)def->params.items[p])->ident;
+        if (param_index(def, name) != p) {
+            fprintf(diag_err(), "error: duplicate parameter '%s' in function '%s'\n", name, def->ident);
+            errors++;
+        }
+    }
+
+    cg->funcs = realloc(cg->funcs, (cg->count + 1) * sizeof(CallGraphFunc));
+    assert(cg->funcs);
+    CallGraphFunc *func = &cg->funcs[cg->count++];
+    memset(func, 0, sizeof(*func));
+    func->def = def;
+    func->name = malloc(strlen(def->ident) + 1);
+    assert(func->name);
+    strcpy(func->name, def->ident);
+    func->param_count = def->params.count;
+    func->base_size = base_size;
+
+    if (refs) return errors + check_refs(cg, cg->count - 1, refs);
+    CallGraphRefs collected;
+    callgraph_collect_refs(&collected, def);
+    errors += check_refs(cg, cg->count - 1, &collected);
+    callgraph_refs_free(&collected);
+    return errors;
+}
+
+int callgraph_add_collected(CallGraph *cg, const FuncDefAST *def, const CallGraphRefs *refs, int base_size) {
+    return add_function(cg, def, refs, base_size);
+}
+
+int callgraph_check_main(const CallGraph *cg) {
+    if (callgraph_find(cg, "main") >= 0) return 0;
+    fprintf(diag_err(), "error: no 'main' function\n");
+    return 1;
+}
+
+int callgraph_build(CallGraph *cg, const CompUnitAST *unit) {
+    int errors = 0;
+    callgraph_init(cg);
+    for (int i = 0; i < unit->func_defs.count; i++) {
+        errors += add_function(cg, (const FuncDefAST *)unit->func_defs.items[i], NULL, -1);
+    }
+    return errors + callgraph_check_main(cg);
+}
+
+// 估计表达式生成的指令条数，已决定内联的被调用者按其（内联后）函数体计；cg 为 NULL 时不计调用本身
+static int expr_size(const CallGraph *cg, const BaseAST *expr) {
+    switch (expr->type) {
+        case AST_UNARY: {
+            const UnaryAST *u = (const UnaryAST *)expr;
+            return (u->op == '+' ? 0 : 1) + expr_size(cg, u->operand);
+        }
+        case AST_BINARY: {
+            const BinaryAST *b = (const BinaryAST *)expr;
+            return 1 + expr_size(cg, b->left) + expr_size(cg, b->right);
+        }
+        case AST_CALL: {
+            const CallAST *call = (const CallAST *)expr;
+            int size = 0;
+            for (int i = 0; i < call->args.count; i++) size += expr_size(cg, call->args.items[i]);
+            if (!cg) return size;
+            const CallGraphFunc *callee = &cg->funcs[callgraph_find(cg, call->ident)];
+            if (callee->inlined) return size + callee->size - 1;
+            return size + CALL_SITE_COST + call->args.count;
+        }
+        default:
+            return 0;
+    }
+}
+
+int callgraph_base_size(const FuncDefAST *def) {
+    const BlockAST *block = (const BlockAST *)def->block;
+    return 1 + expr_size(NULL, ((const StmtAST *)block->stmt)->expr);
+}
+
+// 函数体大小（含 ret）；已知 base_size 时只需加上各调用点，不必遍历 AST
+static int function_size(const CallGraph *cg, const CallGraphFunc *func) {
+    if (func->base_size < 0) {
+        const BlockAST *block = (const BlockAST *)func->def->block;
+        return 1 + expr_size(cg, ((const StmtAST *)block->stmt)->expr);
+    }
+    int size = func->base_size;
+    for (int i = 0; i < func->callee_count; i++) {
+        const CallGraphFunc *callee = &cg->funcs[func->callees[i]];
+        size += callee->inlined ? callee->size - 1 : CALL_SITE_COST + callee->param_count;
+    }
+    return size;
+}
+
+static void report_decision(const CallGraphFunc *func, int growth) {
+    const char *decision = func->recursive ? "recursive" : func->inlined ? "inlined" : "kept";
+    fprintf(diag_err(), "[inline] %s: size %d, %d call site(s), growth %d -> %s\n",
+            func->name, func->size, func->call_sites, growth, decision);
+}
+
+// 表达式中读取形参的次数（含调用的实参，不计被调用者的函数体）
+static int param_reads(const FuncDefAST *def, const BaseAST *expr) {
+    switch (expr->type) {
+        case AST_UNARY:
+            return param_reads(def, ((const UnaryAST *)expr)->operand);
+        case AST_BINARY: {
+            const BinaryAST *b = (const BinaryAST *)expr;
+            return param_reads(def, b->left) + param_reads(def, b->right);
+        }
+        case AST_LVAL:
+            return param_index(def, ((const LValAST *)expr)->ident) >= 0;
+        case AST_CALL: {
+            const CallAST *call = (const CallAST *)expr;
+            int reads = 0;
+            for (int i = 0; i < call->args.count; i++) reads += param_reads(def, call->args.items[i]);
+            return reads;
+        }
+        default:
+            return 0;
+    }
+}
+
+/**
+ * 函数允许的增长上限：有剖析数据时热函数放宽，剖析运行中从未进入的函数不允许增长
+ * 实参为常量时，内联后每次读取形参都要先以 li 装入寄存器，而调用时形参已在寄存器中；
+ * 形参读取次数超过调用开销的两倍时，放宽只会增加动态指令数，仍用 limit
+ */
+static int growth_limit(const CallGraphFunc *func, const InlineOptions *options) {
+    const ProfileFunction *profiled = options->profile ? profile_find_function(options->profile, func->name) : NULL;
+    if (!profiled) return options->limit;
+    if (profiled->entries == 0) return 0;
+    if (!profile_is_hot(options->profile, profiled->entries)) return options->limit;
+    const BlockAST *block = (const BlockAST *)func->def->block;
+    int reads = param_reads(func->def, ((const StmtAST *)block->stmt)->expr);
+    return reads <= 2 * (CALL_SITE_COST + func->param_count) ? options->hot_limit : options->limit;
+}
+
+typedef enum { UNVISITED, ON_STACK, DONE } VisitState;
+
+// 后序遍历：所有被调用者决策完成后再决定 f；回到栈上的函数说明存在环
+static void plan_function(CallGraph *cg, int f, VisitState *state, const InlineOptions *options) {
+    CallGraphFunc *func = &cg->funcs[f];
+    state[f] = ON_STACK;
+    for (int i = 0; i < func->callee_count; i++) {
+        int callee = func->callees[i];
+        if (state[callee] == UNVISITED) plan_function(cg, callee, state, options);
+        else if (state[callee] == ON_STACK) cg->funcs[callee].recursive = true;
+    }
+    state[f] = DONE;
+
+    func->size = function_size(cg, func);
+
+    // 全部调用点展开后代码的增长：每个调用点以函数体（不含 ret）替换调用开销，同时省去单独的一份函数体
+    int body = func->size - 1;
+    int site_cost = CALL_SITE_COST + func->param_count;
+    int growth = func->call_sites * (body - site_cost) - (func->size + FUNC_BODY_COST);
+    bool is_main = strcmp(func->name, "main") == 0;
+    func->inlined = options->enabled && !is_main && !func->recursive && func->call_sites > 0 &&
+                    func->size <= INLINE_MAX_SIZE && growth <= growth_limit(func, options);
+
+    if (options->report && !is_main) report_decision(func, growth);
+}
+
+// 标记经未内联的调用可达的函数；内联的被调用者中的调用同样计入
+static void mark_emitted(CallGraph *cg, int f) {
+    const CallGraphFunc *func = &cg->funcs[f];
+    for (int i = 0; i < func->callee_count; i++) {
+        CallGraphFunc *callee = &cg->funcs[func->callees[i]];
+        if (callee->inlined) {
+            mark_emitted(cg, func->callees[i]);
+        } else if (!callee->emitted) {
+            callee->emitted = true;
+            mark_emitted(cg, func->callees[i]);
+        }
+    }
+}
+
+void callgraph_plan_inlining(CallGraph *cg, const InlineOptions *options) {
+    VisitState *state = calloc(cg->count ? cg->count : 1, sizeof(VisitState));
+    assert(state);
+    for (int f = 0; f < cg->count; f++) {
+        if (state[f] == UNVISITED) plan_function(cg, f, state, options);
+    }
+    free(state);
+
+    int main_index = callgraph_find(cg, "main");
+    assert(main_index >= 0);
+    cg->funcs[main_index].emitted = true;
+    mark_emitted(cg, main_index);
+}
+
+int callgraph_add_function(CallGraph *cg, const FuncDefAST *def) {
+    int errors = add_function(cg, def, NULL, -1);
+    CallGraphFunc *func = &cg->funcs[cg->count - 1];
+    // 只能调用之前的函数或自身，调用自身即为递归
+    for (int i = 0; i < func->callee_count; i++) {
+        if (func->callees[i] == cg->count - 1) func->recursive = true;
+    }
+    func->emitted = true;
+    return errors;
+}
+
+void callgraph_plan_added(CallGraph *cg, const InlineOptions *options) {
+    CallGraphFunc *func = &cg->funcs[cg->count - 1];
+    func->size = function_size(cg, func);
+
+    int growth = func->size - 1 - (CALL_SITE_COST + func->param_count);
+    bool is_main = strcmp(func->name, "main") == 0;
+    func->inlined = options->enabled && !is_main && !func->recursive && growth <= 0;
+    if (options->report && !is_main) report_decision(func, growth);
+}
+
+void callgraph_free(CallGraph *cg) {
+    for (int i = 0; i < cg->count; i++) {
+        free(cg->funcs[i].callees);
+        free(cg->funcs[i].name);
+    }
+    free(cg->funcs);
+    cg->funcs = NULL;
+    cg->count = 0;
+}
@@ -0,0 +1,121 @@
+#pragma once
+
+#include <stdbool.h>
+#include "ast.h"
+#include "profile.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// 内联选项
+typedef struct {
+    bool enabled;       // 是否内联
+    int limit;          // 允许单个被调用者内联带来的代码增长（估计的指令条数）
+    bool report;        // 是否向 stderr 报告每个函数的内联决策
+    const Profile *profile; // 不为 NULL 时按被调用者的进入次数调整增长上限
+    int hot_limit;      // 剖析中的热函数允许的代码增长
+} InlineOptions;
+
+/**
+ * 调用图中的一个函数
+ * size 为函数体在其被调用者按决策内联之后估计生成的 Koopa 指令条数（含 ret）
+ * 流式编译时函数生成后即释放其 AST，只有内联的函数保留 def，其余为 NULL
+ */
+typedef struct {
+    const FuncDefAST *def;
+    char *name;
+    int param_count;
+    int *callees;       // 每个调用点一项，可重复
+    int callee_count;
+    int call_sites;     // 全程序中调用该函数的调用点数
+    int size;
+    int base_size;      // 函数体中调用以外部分的大小（callgraph_base_size），为 -1 时由 AST 计算
+    bool recursive;     // 在调用图的环上，不内联
+    bool inlined;       // 所有调用点均内联展开
+    bool emitted;       // 需要生成函数体（自 main 经未内联的调用可达）
+} CallGraphFunc;
+
+typedef struct {
+    CallGraphFunc *funcs;   // 按源码顺序
+    int count;
+} CallGraph;
+
+/**
+ * 函数体中需要对照整个程序检查的引用：调用点（被调用者与实参个数）或未声明的标识符
+ * 按检查顺序排列，只取决于函数自身的 AST；增量编译时未变的函数据此重建调用图，不必再遍历 AST
+ */
+typedef struct {
+    char *name;
+    int arg_count;      // 未声明的标识符为 -1
+} CallGraphRef;
+
+typedef struct {
+    CallGraphRef *refs;
+    int ref_count;
+} CallGraphRefs;
+
+// 默认选项：开启内联，增长上限 16 条指令，热函数 128 条，没有剖析数据
+void inline_options_default(InlineOptions *options);
+
+// 初始化空调用图
+void callgraph_init(CallGraph *cg);
+
+/**
+ * 建立调用图并做语义检查
+ * 检查函数重名、形参重名、未定义的函数或标识符、实参个数不符以及缺少 main，错误输出到 stderr
+ * @return 错误个数，非零时调用图不可用于代码生成
+ */
+int callgraph_build(CallGraph *cg, const CompUnitAST *unit);
+
+// 收集函数体中的引用，须在化简之前进行（化简可能消去对未声明标识符的引用）
+void callgraph_collect_refs(CallGraphRefs *refs, const FuncDefAST *def);
+
+void callgraph_refs_free(CallGraphRefs *refs);
+
+/**
+ * 以预先收集的引用加入一个函数并做语义检查，结果与 callgraph_build 中逐个加入相同
+ * 全部加入后还需 callgraph_check_main
+ * @param base_size 函数体中调用以外部分的大小，未知时为 -1
+ * @return 错误个数
+ */
+int callgraph_add_collected(CallGraph *cg, const FuncDefAST *def, const CallGraphRefs *refs, int base_size);
+
+// 函数体大小中与被调用者无关的部分：ret、运算与实参，不含调用本身
+int callgraph_base_size(const FuncDefAST *def);
+
+/**
+ * 流式编译：加入一个刚解析完的函数并做语义检查
+ * @return 错误个数
+ */
+int callgraph_add_function(CallGraph *cg, const FuncDefAST *def);
+
+/**
+ * 流式编译：为最后加入的（且检查通过的）函数估计大小并决定是否内联
+ * 之后的调用点尚未可知，且函数体总要单独生成，因此只内联展开后不比调用序列更长的函数，
+ * 这样无论将来有多少调用点代码都不会增长
+ */
+void callgraph_plan_added(CallGraph *cg, const InlineOptions *options);
+
+// 检查是否定义了 main，缺少时报错并返回 1
+int callgraph_check_main(const CallGraph *cg);
+
+/**
+ * 内联决策
+ * 沿调用图自底向上（被调用者先于调用者）估计每个函数内联其被调用者之后的大小，
+ * 非递归且非 main 的函数在全部调用点展开带来的增长不超过上限时内联；
+ * 有剖析数据时，热函数的上限放宽为 hot_limit（形参读取远多于调用开销的除外），
+ * 剖析运行中从未进入的函数只在代码不增长时内联，
+ * 不在剖析数据中的函数仍用 limit；
+ * 之后自 main 出发标记仍需生成函数体的函数
+ */
+void callgraph_plan_inlining(CallGraph *cg, const InlineOptions *options);
+
+// 按名字查找函数下标，不存在返回 -1
+int callgraph_find(const CallGraph *cg, const char *name);
+
+void callgraph_free(CallGraph *cg);
+
+#ifdef __cplusplus
+}
+#endif
@@ -1,28 +1,99 @@
 #include "codegen.h"
 #include <assert.h>
+#include <stdbool.h>
+#include <stdlib.h>
 #include <string.h>
 
-void codegen_program(CodeGenerator *gen, FILE *output, const BaseAST *ast) {
+static void emit_indent(CodeGenerator *gen) {
+    for (int i = 0; i < gen->indent_level; i++) {
+        fprintf(gen->output, "  ");
+    }
+}
+
+void codegen_program(CodeGenerator *gen, FILE *output, const BaseAST *ast, const CallGraph *callgraph) {
     assert(gen);
     assert(output);
     assert(ast);
     assert(ast->type == AST_COMP_UNIT);
     
-    // 初始化代码生成器
+    codegen_init(gen, output, callgraph);
+    codegen_comp_unit(gen, (const CompUnitAST *)ast);
+}
+
+void codegen_init(CodeGenerator *gen, FILE *output, const CallGraph *callgraph) {
+    assert(gen);
+    assert(output);
+    assert(callgraph);
     gen->output = output;
     gen->indent_level = 0;
     gen->temp_counter = 0;
-    
-    codegen_comp_unit(gen, (const CompUnitAST *)ast);
+    gen->callgraph = callgraph;
+    gen->func = NULL;
+    gen->env = NULL;
+}
+
+// 收集 func 经调用（穿过内联的被调用者）直接到达的、需声明的函数
+static void collect_callees(const CallGraph *cg, int func, int self, bool *declared) {
+    const CallGraphFunc *f = &cg->funcs[func];
+    for (int i = 0; i < f->callee_count; i++) {
+        int callee = f->callees[i];
+        if (cg->funcs[callee].inlined) collect_callees(cg, callee, self, declared);
+        else if (callee != self) declared[callee] = true;
+    }
+}
+
+void codegen_callee_decls(CodeGenerator *gen, int func) {
+    const CallGraph *cg = gen->callgraph;
+    bool *declared = calloc(cg->count, sizeof(bool));
+    assert(declared);
+    collect_callees(cg, func, func, declared);
+    for (int i = 0; i < cg->count; i++) {
+        if (!declared[i]) continue;
+        fprintf(gen->output, "decl @%s(", cg->funcs[i].name);
+        for (int p = 0; p < cg->funcs[i].param_count; p++) {
+            fprintf(gen->output, "%si32", p > 0 ? ", " : "");
+        }
+        fprintf(gen->output, "): i32\n");
+    }
+    free(declared);
 }
 
 void codegen_comp_unit(CodeGenerator *gen, const CompUnitAST *ast) {
     assert(gen);
     assert(ast);
-    assert(ast->func_def);
-    assert(ast->func_def->type == AST_FUNC_DEF);
+    assert(ast->func_defs.count == gen->callgraph->count);
+
+    // 按源码顺序生成；所有调用点均已内联、或不可达的函数不再单独生成
+    for (int i = 0; i < ast->func_defs.count; i++) {
+        if (!gen->callgraph->funcs[i].emitted) continue;
+        assert(ast->func_defs.items[i]->type == AST_FUNC_DEF);
+        codegen_func_def(gen, (const FuncDefAST *)ast->func_defs.items[i]);
+    }
+}
 
-    codegen_func_def(gen, (const FuncDefAST *)ast->func_def);
+void codegen_emit_operand(FILE *output, Operand operand) {
+    switch (operand.kind) {
+        case OPERAND_IMM:
+            fprintf(output, "%d", operand.value);
+            break;
+        case OPERAND_TEMP:
+            fprintf(output, "%%%d", operand.value);
+            break;
+        case OPERAND_PARAM:
+            fprintf(output, "@%s", operand.name);
+            break;
+    }
+}
+
+static Operand imm_operand(int value) {
+    Operand operand = {OPERAND_IMM, value, NULL};
+    return operand;
+}
+
+// 分配一个新的临时变量
+static Operand new_temp(CodeGenerator *gen) {
+    Operand operand = {OPERAND_TEMP, gen->temp_counter++, NULL};
+    return operand;
 }
 
 void codegen_func_def(CodeGenerator *gen, const FuncDefAST *ast) {
@@ -32,14 +103,26 @@ void codegen_func_def(CodeGenerator *gen, const FuncDefAST *ast) {
     assert(ast->block);
     assert(ast->block->type == AST_BLOCK);
     
-    // 输出函数签名：fun @main(): i32 {
-    fprintf(gen->output, "fun @%s(): i32 {\n", ast->ident);
+    // 输出函数签名：fun @f(@x: i32, @y: i32): i32 {
+    // 形参在函数体中直接以 @名字 引用
+    Operand *env = malloc((ast->params.count ? ast->params.count : 1) * sizeof(Operand));
+    assert(env);
+    fprintf(gen->output, "fun @%s(", ast->ident);
+    for (int i = 0; i < ast->params.count; i++) {
+        env[i].kind = OPERAND_PARAM;
+        env[i].value = 0;
+        env[i].name = ((const FuncParamAST *)ast->params.items[i])->ident;
+        fprintf(gen->output, "%s@%s: i32", i > 0 ? ", " : "", env[i].name);
+    }
+    fprintf(gen->output, "): i32 {\n");
     
     // 输出入口基本块标签
     fprintf(gen->output, "%%entry:\n");
     
     // 重置临时变量计数器
     gen->temp_counter = 0;
+    gen->func = ast;
+    gen->env = env;
     
     // 生成函数体
     gen->indent_level++;
@@ -47,6 +130,10 @@ void codegen_func_def(CodeGenerator *gen, const FuncDefAST *ast) {
     gen->indent_level--;
 
     fprintf(gen->output, "}\n");
+
+    gen->func = NULL;
+    gen->env = NULL;
+    free(env);
 }
 
 void codegen_func_type(CodeGenerator *gen, const FuncTypeAST *ast) {
@@ -68,162 +155,289 @@ void codegen_stmt(CodeGenerator *gen, const StmtAST *ast) {
     assert(ast->expr);
 
     // 生成表达式的IR代码
-    char *result = codegen_expr(gen, ast->expr);
+    Operand result = codegen_expr(gen, ast->expr);
     
     // 生成return语句
-    for (int i = 0; i < gen->indent_level; i++) {
-        fprintf(gen->output, "  ");
+    emit_indent(gen);
+    fprintf(gen->output, "ret ");
+    codegen_emit_operand(gen->output, result);
+    fprintf(gen->output, "\n");
+}
+
+// 输出一条二元运算指令，返回存放结果的新临时变量
+static Operand emit_binary(CodeGenerator *gen, const char *op, Operand lhs, Operand rhs) {
+    Operand result = new_temp(gen);
+    emit_indent(gen);
+    fprintf(gen->output, "%%%d = %s ", result.value, op);
+    codegen_emit_operand(gen->output, lhs);
+    fprintf(gen->output, ", ");
+    codegen_emit_operand(gen->output, rhs);
+    fprintf(gen->output, "\n");
+    return result;
+}
+
+// 将值规范化为 0/1；已知为布尔值时不生成指令
+static Operand to_bool(CodeGenerator *gen, Operand value, bool is_bool) {
+    if (is_bool) return value;
+    return emit_binary(gen, "ne", value, imm_operand(0));
+}
+
+static bool is_zero_literal(const BaseAST *expr) {
+    return expr->type == AST_NUMBER && ((const NumberAST *)expr)->value == 0;
+}
+
+// 关系运算符对应的 Koopa 指令，negate 为 true 时返回其取反的指令
+static const char *relational_op(char op, bool negate) {
+    switch (op) {
+        case '<': return negate ? "ge" : "lt";
+        case '>': return negate ? "le" : "gt";
+        case 'l': return negate ? "gt" : "le";
+        case 'g': return negate ? "lt" : "ge";
+        case 'e': return negate ? "ne" : "eq";
+        case 'n': return negate ? "eq" : "ne";
+        default: return NULL;
     }
-    fprintf(gen->output, "ret %s\n", result);
-    
-    free(result);
 }
 
-char* codegen_expr(CodeGenerator *gen, const BaseAST *expr) {
-    assert(gen);
-    assert(expr);
-    
-    char *result = malloc(16);
-    
+static Operand codegen_expr_in(CodeGenerator *gen, const BaseAST *expr, ExprContext ctx, bool *is_bool);
+
+// 按求值顺序遍设置的先后生成二元运算的两个操作数
+static void codegen_operands(CodeGenerator *gen, const BinaryAST *b, ExprContext ctx, Operand *left, bool *left_bool,
+                             Operand *right, bool *right_bool) {
+    if (b->right_first) *right = codegen_expr_in(gen, b->right, ctx, right_bool);
+    *left = codegen_expr_in(gen, b->left, ctx, left_bool);
+    if (!b->right_first) *right = codegen_expr_in(gen, b->right, ctx, right_bool);
+}
+
+// 生成逻辑运算的操作数并规范化为 0/1
+static Operand codegen_bool_operand(CodeGenerator *gen, const BaseAST *expr) {
+    bool is_bool;
+    Operand value = codegen_expr_in(gen, expr, EXPR_COND, &is_bool);
+    return to_bool(gen, value, is_bool);
+}
+
+// 形参在当前环境中对应的操作数
+static Operand codegen_lval(CodeGenerator *gen, const LValAST *lval) {
+    for (int i = 0; i < gen->func->params.count; i++) {
+        if (strcmp(((const FuncParamAST *)gen->func->params.items[i])->ident, lval->ident) == 0) {
+            return gen->env[i];
+        }
+    }
+    assert(0 && "Undeclared identifier");
+    return imm_operand(0);
+}
+
+// 实参不多于此数时放在栈上，不分配内存
+#define INLINE_ARG_COUNT 8
+
+/**
+ * 生成函数调用
+ * 实参在调用者中按顺序求值；被调用者已决定内联时，以实参替换形参，在调用点就地生成其返回表达式，
+ * 此时调用点的使用方式（ctx）也传入被调用者的函数体
+ */
+static Operand codegen_call(CodeGenerator *gen, const CallAST *call, ExprContext ctx, bool *is_bool) {
+    Operand local_args[INLINE_ARG_COUNT];
+    Operand *args = local_args;
+    if (call->args.count > INLINE_ARG_COUNT) {
+        args = malloc(call->args.count * sizeof(Operand));
+        assert(args);
+    }
+    for (int i = 0; i < call->args.count; i++) {
+        bool unused;
+        args[i] = codegen_expr_in(gen, call->args.items[i], EXPR_VALUE, &unused);
+    }
+
+    int index = callgraph_find(gen->callgraph, call->ident);
+    assert(index >= 0);
+    const CallGraphFunc *callee = &gen->callgraph->funcs[index];
+    Operand result;
+    if (callee->inlined) {
+        const FuncDefAST *saved_func = gen->func;
+        const Operand *saved_env = gen->env;
+        gen->func = callee->def;
+        gen->env = args;
+        const BlockAST *block = (const BlockAST *)callee->def->block;
+        result = codegen_expr_in(gen, ((const StmtAST *)block->stmt)->expr, ctx, is_bool);
+        gen->func = saved_func;
+        gen->env = saved_env;
+    } else {
+        result = new_temp(gen);
+        emit_indent(gen);
+        fprintf(gen->output, "%%%d = call @%s(", result.value, call->ident);
+        for (int i = 0; i < call->args.count; i++) {
+            if (i > 0) fprintf(gen->output, ", ");
+            codegen_emit_operand(gen->output, args[i]);
+        }
+        fprintf(gen->output, ")\n");
+        *is_bool = false;
+    }
+
+    if (args != local_args) free(args);
+    return result;
+}
+
+/**
+ * 生成 !operand
+ * 关系运算直接取反比较方向，双重否定在只关心真假时直接消去，其余情况生成 eq x, 0
+ */
+static Operand codegen_not(CodeGenerator *gen, const BaseAST *operand, ExprContext ctx, bool *is_bool) {
+    if (operand->type == AST_BINARY) {
+        const BinaryAST *b = (const BinaryAST *)operand;
+        const char *inverted = relational_op(b->op, true);
+        if (inverted) {
+            bool unused;
+            Operand left, right;
+            codegen_operands(gen, b, EXPR_VALUE, &left, &unused, &right, &unused);
+            *is_bool = true;
+            return emit_binary(gen, inverted, left, right);
+        }
+    }
+    if (operand->type == AST_UNARY && ((const UnaryAST *)operand)->op == '!') {
+        // !!x：只关心真假时即为 x，否则规范化为 0/1
+        bool inner_bool;
+        Operand inner = codegen_expr_in(gen, ((const UnaryAST *)operand)->operand, EXPR_COND, &inner_bool);
+        if (ctx == EXPR_COND) {
+            *is_bool = inner_bool;
+            return inner;
+        }
+        *is_bool = true;
+        return to_bool(gen, inner, inner_bool);
+    }
+
+    bool unused;
+    Operand value = codegen_expr_in(gen, operand, EXPR_COND, &unused);
+    *is_bool = true;
+    return emit_binary(gen, "eq", value, imm_operand(0));
+}
+
+/**
+ * 生成表达式 IR
+ * @param ctx 结果的使用方式，EXPR_COND 时结果只需与原值同真假
+ * @param is_bool 输出：结果是否已知为 0/1
+ */
+static Operand codegen_expr_in(CodeGenerator *gen, const BaseAST *expr, ExprContext ctx, bool *is_bool) {
     switch (expr->type) {
         case AST_NUMBER: {
             const NumberAST *n = (const NumberAST *)expr;
-            snprintf(result, 16, "%d", n->value);
-            return result;
+            // 只关心真假时，非零常量一律视为 1
+            int value = (ctx == EXPR_COND && n->value != 0) ? 1 : n->value;
+            *is_bool = value == 0 || value == 1;
+            return imm_operand(value);
         }
         
         case AST_UNARY: {
             const UnaryAST *u = (const UnaryAST *)expr;
-            char *operand = codegen_expr(gen, u->operand);
-            
             switch (u->op) {
-                case '+': 
+                case '+':
                     // 一元加号不生成任何代码，直接返回操作数
-                    free(result);
-                    return operand;
+                    return codegen_expr_in(gen, u->operand, ctx, is_bool);
                     
                 case '-': {
-                    for (int i = 0; i < gen->indent_level; i++) {
-                        fprintf(gen->output, "  ");
-                    }
-                    snprintf(result, 16, "%%%d", gen->temp_counter);
-                    fprintf(gen->output, "%s = sub 0, %s\n", result, operand);
-                    gen->temp_counter++;
-                    break;
+                    // 取负不改变真假
+                    if (ctx == EXPR_COND) return codegen_expr_in(gen, u->operand, ctx, is_bool);
+                    Operand operand = codegen_expr_in(gen, u->operand, EXPR_VALUE, is_bool);
+                    *is_bool = false;
+                    return emit_binary(gen, "sub", imm_operand(0), operand);
                 }
                 
-                case '!': {
-                    for (int i = 0; i < gen->indent_level; i++) {
-                        fprintf(gen->output, "  ");
-                    }
-                    snprintf(result, 16, "%%%d", gen->temp_counter);
-                    fprintf(gen->output, "%s = eq %s, 0\n", result, operand);
-                    gen->temp_counter++;
-                    break;
-                }
+                case '!':
+                    return codegen_not(gen, u->operand, ctx, is_bool);
                 
                 default:
                     assert(0 && "Unknown unary operator");
+                    return imm_operand(0);
             }
-            
-            free(operand);
-            return result;
         }
         
         case AST_BINARY: {
             const BinaryAST *b = (const BinaryAST *)expr;
             
-            if (b->op == '&' || b->op == '|') {
-                
-                char *left = codegen_expr(gen, b->left);
-                
-                // 创建临时变量存储结果
-                snprintf(result, 16, "%%%d", gen->temp_counter);
-                int result_var = gen->temp_counter++;
-                
-                // 检查左操作数是否为0
-                for (int i = 0; i < gen->indent_level; i++) {
-                    fprintf(gen->output, "  ");
-                }
-                int left_bool = gen->temp_counter++;
-                fprintf(gen->output, "%%%d = ne %s, 0\n", left_bool, left);
-                
-                if (b->op == '&') {
-                    // 逻辑与
-                    char *right = codegen_expr(gen, b->right);
-                    for (int i = 0; i < gen->indent_level; i++) {
-                        fprintf(gen->output, "  ");
-                    }
-                    int right_bool = gen->temp_counter++;
-                    fprintf(gen->output, "%%%d = ne %s, 0\n", right_bool, right);
-                    
-                    for (int i = 0; i < gen->indent_level; i++) {
-                        fprintf(gen->output, "  ");
-                    }
-                    fprintf(gen->output, "%%%d = and %%%d, %%%d\n", result_var, left_bool, right_bool);
-                    free(right);
-                } else {
-                    // 逻辑或
-                    char *right = codegen_expr(gen, b->right);
-                    for (int i = 0; i < gen->indent_level; i++) {
-                        fprintf(gen->output, "  ");
-                    }
-                    int right_bool = gen->temp_counter++;
-                    fprintf(gen->output, "%%%d = ne %s, 0\n", right_bool, right);
-                    
-                    for (int i = 0; i < gen->indent_level; i++) {
-                        fprintf(gen->output, "  ");
-                    }
-                    fprintf(gen->output, "%%%d = or %%%d, %%%d\n", result_var, left_bool, right_bool);
-                    free(right);
+            if (b->op == '&') {
+                // 逻辑与：两侧均须为 0/1 后按位与
+                Operand left, right;
+                if (b->right_first) right = codegen_bool_operand(gen, b->right);
+                left = codegen_bool_operand(gen, b->left);
+                if (!b->right_first) right = codegen_bool_operand(gen, b->right);
+                *is_bool = true;
+                return emit_binary(gen, "and", left, right);
+            }
+            
+            if (b->op == '|') {
+                // 逻辑或：按位或与原值同真假，需要精确值且两侧不都是 0/1 时再规范化一次
+                bool left_bool, right_bool;
+                Operand left, right;
+                codegen_operands(gen, b, EXPR_COND, &left, &left_bool, &right, &right_bool);
+                Operand result = emit_binary(gen, "or", left, right);
+                *is_bool = left_bool && right_bool;
+                if (ctx == EXPR_VALUE) {
+                    result = to_bool(gen, result, *is_bool);
+                    *is_bool = true;
                 }
-                
-                free(left);
                 return result;
             }
             
+            // 与 0 比较：x != 0 与 x 同真假，x == 0 即 !x
+            if ((b->op == 'e' || b->op == 'n') && (is_zero_literal(b->left) || is_zero_literal(b->right))) {
+                const BaseAST *other = is_zero_literal(b->right) ? b->left : b->right;
+                if (b->op == 'e') return codegen_not(gen, other, ctx, is_bool);
+                Operand value = codegen_expr_in(gen, other, EXPR_COND, is_bool);
+                if (ctx == EXPR_COND) return value;
+                value = to_bool(gen, value, *is_bool);
+                *is_bool = true;
+                return value;
+            }
+            
             // 二元运算
-            char *left = codegen_expr(gen, b->left);
-            char *right = codegen_expr(gen, b->right);
+            bool unused;
+            Operand left, right;
+            codegen_operands(gen, b, EXPR_VALUE, &left, &unused, &right, &unused);
             
-            const char *koopa_op = NULL;
+            const char *koopa_op = relational_op(b->op, false);
+            *is_bool = koopa_op != NULL;
             switch (b->op) {
                 case '+': koopa_op = "add"; break;
                 case '-': koopa_op = "sub"; break;
                 case '*': koopa_op = "mul"; break;
                 case '/': koopa_op = "div"; break;
                 case '%': koopa_op = "mod"; break;
-                case '<': koopa_op = "lt"; break;
-                case '>': koopa_op = "gt"; break;
-                case 'l': koopa_op = "le"; break;
-                case 'g': koopa_op = "ge"; break;
-                case 'e': koopa_op = "eq"; break;
-                case 'n': koopa_op = "ne"; break;
-                default: assert(0 && "Unknown binary operator");
-            }
-            
-            for (int i = 0; i < gen->indent_level; i++) {
-                fprintf(gen->output, "  ");
+                default:
+                    assert(koopa_op && "Unknown binary operator");
             }
-            snprintf(result, 16, "%%%d", gen->temp_counter);
-            fprintf(gen->output, "%s = %s %s, %s\n", result, koopa_op, left, right);
-            gen->temp_counter++;
             
-            free(left);
-            free(right);
-            return result;
+            return emit_binary(gen, koopa_op, left, right);
         }
         
+        case AST_LVAL:
+            *is_bool = false;
+            return codegen_lval(gen, (const LValAST *)expr);
+
+        case AST_CALL:
+            return codegen_call(gen, (const CallAST *)expr, ctx, is_bool);
+        
         default:
             assert(0 && "Unknown expression type");
-            free(result);
-            return NULL;
+            return imm_operand(0);
     }
 }
 
+Operand codegen_expr(CodeGenerator *gen, const BaseAST *expr) {
+    assert(gen);
+    assert(expr);
+    bool is_bool;
+    return codegen_expr_in(gen, expr, EXPR_VALUE, &is_bool);
+}
+
 void generate_koopa_ir(const BaseAST *ast) {
-    CodeGenerator gen;
-    codegen_program(&gen, stdout, ast);
+    assert(ast && ast->type == AST_COMP_UNIT);
+    CallGraph callgraph;
+    InlineOptions options;
+    inline_options_default(&options);
+    if (callgraph_build(&callgraph, (const CompUnitAST *)ast) == 0) {
+        callgraph_plan_inlining(&callgraph, &options);
+        CodeGenerator gen;
+        codegen_program(&gen, stdout, ast, &callgraph);
+    }
+    callgraph_free(&callgraph);
 }
 
 int eval_const_expr(const BaseAST *expr, int *out) {
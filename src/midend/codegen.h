@@ -1,12 +1,38 @@
 #pragma once
 
 #include "ast.h"
+#include "callgraph.h"
 #include <stdio.h>
 
+// 表达式结果的使用方式
+typedef enum {
+    EXPR_VALUE,     // 需要精确的整数值
+    EXPR_COND,      // 只关心是否为零（条件、逻辑运算的操作数）
+} ExprContext;
+
+/**
+ * 表达式结果的操作数，按值传递
+ * 生成表达式时不分配内存，只在输出指令时格式化为文本
+ */
+typedef enum {
+    OPERAND_IMM,        // 整数立即数
+    OPERAND_TEMP,       // 临时变量 %id
+    OPERAND_PARAM,      // 形参 @name
+} OperandKind;
+
+typedef struct {
+    OperandKind kind;
+    int value;          // 立即数的值或临时变量编号
+    const char *name;   // 形参名，指向 AST 中的标识符
+} Operand;
+
 typedef struct {
     FILE *output;           // 输出流
     int indent_level;       // 当前缩进
     int temp_counter;       // 临时变量计数器
+    const CallGraph *callgraph;     // 调用图与内联决策
+    const FuncDefAST *func;         // 正在生成（或内联展开）的函数
+    const Operand *env;             // 该函数各形参对应的操作数
 } CodeGenerator;
 
 /**
@@ -14,8 +40,19 @@ typedef struct {
  * @param gen 代码生成器实例
  * @param output 输出流
  * @param ast 程序的根AST节点
+ * @param callgraph 由 callgraph_build 建立并已做内联决策的调用图
  */
-void codegen_program(CodeGenerator *gen, FILE *output, const BaseAST *ast);
+void codegen_program(CodeGenerator *gen, FILE *output, const BaseAST *ast, const CallGraph *callgraph);
+
+// 初始化代码生成器，供逐个生成函数的流式编译使用
+void codegen_init(CodeGenerator *gen, FILE *output, const CallGraph *callgraph);
+
+/**
+ * 为函数（含其中内联展开的函数体）调用到的其他函数输出 decl 声明，
+ * 使单个函数的 IR 可以脱离之前的函数单独解析
+ * @param func 函数在调用图中的下标
+ */
+void codegen_callee_decls(CodeGenerator *gen, int func);
 
 // ========================================
 // 各AST节点类型的代码生成函数
@@ -57,18 +94,21 @@ void codegen_block(CodeGenerator *gen, const BlockAST *ast);
 void codegen_stmt(CodeGenerator *gen, const StmtAST *ast);
 
 /**
- * 生成表达式IR并返回结果的临时变量名
+ * 生成表达式IR并返回结果的操作数
  * @param gen 代码生成器实例
  * @param expr 表达式AST节点
- * @return 存储计算结果的临时变量名
+ * @return 计算结果所在的操作数（立即数、临时变量或形参）
  */
-char* codegen_expr(CodeGenerator *gen, const BaseAST *expr);
+Operand codegen_expr(CodeGenerator *gen, const BaseAST *expr);
+
+// 以 Koopa IR 文本输出操作数
+void codegen_emit_operand(FILE *output, Operand operand);
 
 // 计算表达式常量值
 int eval_const_expr(const BaseAST *expr, int *out);
 
 /**
- * 简化的代码生成接口，直接输出到stdout
+ * 简化的代码生成接口，直接输出到stdout，使用默认内联选项
  * @param ast 要生成IR的AST根节点
  */
 void generate_koopa_ir(const BaseAST *ast);
\ No newline at end of file
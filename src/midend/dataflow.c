@@ -0,0 +1,466 @@
+#include "dataflow.h"
+#include <assert.h>
+#include <stdlib.h>
+#include <string.h>
+
+// ========================================
+// 位向量集合
+// ========================================
+
+#define BITSET_WORDS(nbits) (((nbits) + 63) / 64)
+
+void bitset_init(BitSet *set, int nbits) {
+    set->nbits = nbits;
+    set->words = calloc(BITSET_WORDS(nbits) ? BITSET_WORDS(nbits) : 1, sizeof(uint64_t));
+    assert(set->words);
+}
+
+void bitset_free(BitSet *set) {
+    free(set->words);
+    set->words = NULL;
+    set->nbits = 0;
+}
+
+void bitset_clear_all(BitSet *set) {
+    memset(set->words, 0, BITSET_WORDS(set->nbits) * sizeof(uint64_t));
+}
+
+void bitset_set_all(BitSet *set) {
+    int nwords = BITSET_WORDS(set->nbits);
+    memset(set->words, 0xff, nwords * sizeof(uint64_t));
+    // 清除最后一个字中超出 nbits 的位
+    if (set->nbits % 64) set->words[nwords - 1] = ((uint64_t)1 << (set->nbits % 64)) - 1;
+}
+
+void bitset_set(BitSet *set, int bit) {
+    assert(bit >= 0 && bit < set->nbits);
+    set->words[bit / 64] |= (uint64_t)1 << (bit % 64);
+}
+
+void bitset_reset(BitSet *set, int bit) {
+    assert(bit >= 0 && bit < set->nbits);
+    set->words[bit / 64] &= ~((uint64_t)1 << (bit % 64));
+}
+
+bool bitset_test(const BitSet *set, int bit) {
+    assert(bit >= 0 && bit < set->nbits);
+    return (set->words[bit / 64] >> (bit % 64)) & 1;
+}
+
+void bitset_copy(BitSet *dst, const BitSet *src) {
+    assert(dst->nbits == src->nbits);
+    memcpy(dst->words, src->words, BITSET_WORDS(src->nbits) * sizeof(uint64_t));
+}
+
+bool bitset_equal(const BitSet *a, const BitSet *b) {
+    assert(a->nbits == b->nbits);
+    return memcmp(a->words, b->words, BITSET_WORDS(a->nbits) * sizeof(uint64_t)) == 0;
+}
+
+bool bitset_union(BitSet *dst, const BitSet *src) {
+    assert(dst->nbits == src->nbits);
+    uint64_t changed = 0;
+    for (int i = 0; i < BITSET_WORDS(dst->nbits); i++) {
+        uint64_t merged = dst->words[i] | src->words[i];
+        changed |= merged ^ dst->words[i];
+        dst->words[i] = merged;
+    }
+    return changed != 0;
+}
+
+bool bitset_intersect(BitSet *dst, const BitSet *src) {
+    assert(dst->nbits == src->nbits);
+    uint64_t changed = 0;
+    for (int i = 0; i < BITSET_WORDS(dst->nbits); i++) {
+        uint64_t merged = dst->words[i] & src->words[i];
+        changed |= merged ^ dst->words[i];
+        dst->words[i] = merged;
+    }
+    return changed != 0;
+}
+
+void bitset_subtract(BitSet *dst, const BitSet *src) {
+    assert(dst->nbits == src->nbits);
+    for (int i = 0; i < BITSET_WORDS(dst->nbits); i++) {
+        dst->words[i] &= ~src->words[i];
+    }
+}
+
+int bitset_count(const BitSet *set) {
+    int count = 0;
+    for (int i = 0; i < BITSET_WORDS(set->nbits); i++) {
+        count += __builtin_popcountll(set->words[i]);
+    }
+    return count;
+}
+
+// ========================================
+// 指令的副作用
+// ========================================
+
+bool dataflow_has_side_effect(const SsaFunction *func, SsaValueId inst) {
+    switch (func->values[inst].op) {
+        case SSA_BR:
+        case SSA_JUMP:
+        case SSA_CALL:
+        case SSA_RET:
+            return true;
+        default:
+            return false;
+    }
+}
+
+// 结果无人使用时可删除的纯指令
+static bool is_removable(const SsaFunction *func, SsaValueId value) {
+    return ssa_is_binary(&func->values[value]);
+}
+
+// ========================================
+// 死代码删除
+// ========================================
+
+// 值的使用者是否都已删除
+static bool all_users_removed(const SsaFunction *func, SsaValueId value) {
+    for (uint32_t u = func->user_start[value]; u < func->user_start[value + 1]; u++) {
+        if (func->values[func->users[u]].op != SSA_NOP) return false;
+    }
+    return true;
+}
+
+int dataflow_eliminate_dead(SsaFunction *func) {
+    ssa_build_users(func);
+    SsaValueId *worklist = malloc((func->inst_count ? func->inst_count : 1) * sizeof(SsaValueId));
+    assert(worklist);
+    int len = 0, removed = 0;
+    for (uint32_t i = 0; i < func->inst_count; i++) {
+        SsaValueId inst = func->insts[i];
+        if (is_removable(func, inst) && all_users_removed(func, inst)) worklist[len++] = inst;
+    }
+
+    // 删除一条指令后，其操作数中不再有使用者的纯运算随之删除；每条指令至多入表一次
+    while (len > 0) {
+        SsaValueId inst = worklist[--len];
+        SsaValueId ops[2];
+        uint32_t count = func->values[inst].operand_count;
+        assert(count <= 2);
+        memcpy(ops, ssa_operands(func, inst), count * sizeof(SsaValueId));
+        ssa_remove(func, inst);
+        removed++;
+        for (uint32_t k = 0; k < count; k++) {
+            if (is_removable(func, ops[k]) && all_users_removed(func, ops[k]) &&
+                (k == 0 || ops[1] != ops[0])) {
+                worklist[len++] = ops[k];
+            }
+        }
+    }
+    free(worklist);
+    if (removed) ssa_compact(func);
+    return removed;
+}
+
+// ========================================
+// 分析
+// ========================================
+
+// 被跟踪的值：有结果且不是常量
+static bool is_tracked(const SsaFunction *func, SsaValueId value) {
+    const SsaValue *v = &func->values[value];
+    return v->has_result && v->op != SSA_CONST;
+}
+
+static void add_edge(int **list, int *count, int block) {
+    *list = realloc(*list, (*count + 1) * sizeof(int));
+    assert(*list);
+    (*list)[(*count)++] = block;
+}
+
+// 根据每个块的终结指令建立控制流边
+static void build_cfg(DataflowInfo *info) {
+    int n = info->block_count;
+    info->succs = calloc(n ? n : 1, sizeof(int *));
+    info->succ_count = calloc(n ? n : 1, sizeof(int));
+    info->preds = calloc(n ? n : 1, sizeof(int *));
+    info->pred_count = calloc(n ? n : 1, sizeof(int));
+    assert(info->succs && info->succ_count && info->preds && info->pred_count);
+
+    const SsaFunction *func = info->func;
+    for (int b = 0; b < n; b++) {
+        uint32_t count = func->blocks[b].inst_count;
+        if (count == 0) continue;
+        uint32_t succs[2];
+        int nsuccs = ssa_successors(func, ssa_block_inst(func, b, count - 1), succs);
+        for (int i = 0; i < nsuccs; i++) {
+            add_edge(&info->succs[b], &info->succ_count[b], (int)succs[i]);
+            add_edge(&info->preds[succs[i]], &info->pred_count[succs[i]], b);
+        }
+    }
+}
+
+// 使用计数
+static void count_uses(DataflowInfo *info) {
+    const SsaFunction *func = info->func;
+    for (uint32_t i = 0; i < func->inst_count; i++) {
+        SsaValueId inst = func->insts[i];
+        const SsaValueId *ops = ssa_operands(func, inst);
+        for (uint32_t k = 0; k < func->values[inst].operand_count; k++) info->use_count[ops[k]]++;
+    }
+}
+
+// 块级 use / def 集合；块参数视为在块入口定义
+static void compute_use_def(DataflowInfo *info) {
+    const SsaFunction *func = info->func;
+    int n = info->block_count;
+    info->use = malloc((n ? n : 1) * sizeof(BitSet));
+    info->def = malloc((n ? n : 1) * sizeof(BitSet));
+    assert(info->use && info->def);
+    for (int b = 0; b < n; b++) {
+        BitSet *use = &info->use[b], *def = &info->def[b];
+        bitset_init(use, info->value_count);
+        bitset_init(def, info->value_count);
+        const SsaBlock *block = &func->blocks[b];
+        for (uint32_t i = 0; i < block->param_count; i++) bitset_set(def, (int)(block->param_start + i));
+        for (uint32_t i = 0; i < block->inst_count; i++) {
+            SsaValueId inst = ssa_block_inst(func, b, i);
+            const SsaValueId *ops = ssa_operands(func, inst);
+            for (uint32_t k = 0; k < func->values[inst].operand_count; k++) {
+                if (is_tracked(func, ops[k]) && !bitset_test(def, (int)ops[k])) bitset_set(use, (int)ops[k]);
+            }
+            if (is_tracked(func, inst)) bitset_set(def, (int)inst);
+        }
+    }
+}
+
+/**
+ * 指令级活跃性：自块尾 live_out 反向遍历，记录每条指令处死亡的操作数
+ * 反向遍历时按逆序得到各指令的区间，最后翻转为正序的 kill_start
+ */
+static void compute_kills(DataflowInfo *info) {
+    const SsaFunction *func = info->func;
+    int n = info->block_count;
+    info->kill_start = calloc(n ? n : 1, sizeof(int *));
+    info->kills = calloc(n ? n : 1, sizeof(int *));
+    assert(info->kill_start && info->kills);
+
+    BitSet live;
+    bitset_init(&live, info->value_count);
+    int *rev = NULL;
+    int cap = 0;
+    for (int b = 0; b < n; b++) {
+        int ninsts = (int)func->blocks[b].inst_count;
+        int *ends = malloc((ninsts + 1) * sizeof(int));
+        assert(ends);
+        int len = 0;
+
+        bitset_copy(&live, &info->live_out[b]);
+        for (int k = ninsts - 1; k >= 0; k--) {
+            SsaValueId inst = ssa_block_inst(func, b, k);
+            ends[k + 1] = len;
+            if (is_tracked(func, inst)) bitset_reset(&live, (int)inst);
+            const SsaValueId *ops = ssa_operands(func, inst);
+            for (uint32_t j = 0; j < func->values[inst].operand_count; j++) {
+                int id = (int)ops[j];
+                // 之后不再活跃：此处为最后一次使用；同一指令内重复使用只记录一次
+                if (!is_tracked(func, ops[j]) || bitset_test(&live, id)) continue;
+                bitset_set(&live, id);
+                if (len == cap) {
+                    cap = cap ? cap * 2 : 16;
+                    rev = realloc(rev, cap * sizeof(int));
+                    assert(rev);
+                }
+                rev[len++] = id;
+            }
+        }
+        ends[0] = len;
+
+        // 反向遍历时第 k 条指令的死亡操作数位于 [ends[k + 1], ends[k])，翻转为正序
+        int *kills = malloc((len ? len : 1) * sizeof(int));
+        int *start = malloc((ninsts + 1) * sizeof(int));
+        assert(kills && start);
+        int pos = 0;
+        for (int k = 0; k < ninsts; k++) {
+            start[k] = pos;
+            for (int j = ends[k + 1]; j < ends[k]; j++) kills[pos++] = rev[j];
+        }
+        start[ninsts] = pos;
+        info->kill_start[b] = start;
+        info->kills[b] = kills;
+        free(ends);
+    }
+    free(rev);
+    bitset_free(&live);
+}
+
+bool dataflow_live_across_calls(const DataflowInfo *info, bool *across) {
+    const SsaFunction *func = info->func;
+    bool has_call = false;
+    memset(across, 0, info->value_count * sizeof(bool));
+    BitSet live;
+    bitset_init(&live, info->value_count);
+    for (int b = 0; b < info->block_count; b++) {
+        bitset_copy(&live, &info->live_out[b]);
+        for (int k = (int)func->blocks[b].inst_count - 1; k >= 0; k--) {
+            SsaValueId inst = ssa_block_inst(func, b, k);
+            if (is_tracked(func, inst)) bitset_reset(&live, (int)inst);
+            // 此时 live 为调用之后仍活跃的值，不含调用结果本身
+            if (func->values[inst].op == SSA_CALL) {
+                has_call = true;
+                for (int v = 0; v < info->value_count; v++) {
+                    if (bitset_test(&live, v)) across[v] = true;
+                }
+            }
+            const SsaValueId *ops = ssa_operands(func, inst);
+            for (uint32_t j = 0; j < func->values[inst].operand_count; j++) {
+                if (is_tracked(func, ops[j])) bitset_set(&live, (int)ops[j]);
+            }
+        }
+    }
+    bitset_free(&live);
+    return has_call;
+}
+
+void dataflow_analyze(DataflowInfo *info, const SsaFunction *func) {
+    memset(info, 0, sizeof(*info));
+    info->func = func;
+    info->value_count = (int)func->value_count;
+    info->block_count = (int)func->block_count;
+    info->use_count = calloc(info->value_count ? info->value_count : 1, sizeof(int));
+    assert(info->use_count);
+
+    build_cfg(info);
+    count_uses(info);
+    compute_use_def(info);
+
+    // 活跃变量：后向、并集，gen = use，kill = def
+    BitVectorProblem liveness = {false, true, info->value_count, info->use, info->def, NULL, NULL};
+    dataflow_solve(info, &liveness);
+    info->live_in = liveness.in;
+    info->live_out = liveness.out;
+
+    compute_kills(info);
+}
+
+static void free_sets(BitSet *sets, int n) {
+    if (!sets) return;
+    for (int i = 0; i < n; i++) bitset_free(&sets[i]);
+    free(sets);
+}
+
+void dataflow_free(DataflowInfo *info) {
+    int n = info->block_count;
+    for (int b = 0; b < n; b++) {
+        if (info->succs) free(info->succs[b]);
+        if (info->preds) free(info->preds[b]);
+        if (info->kill_start) free(info->kill_start[b]);
+        if (info->kills) free(info->kills[b]);
+    }
+    free(info->succs);
+    free(info->succ_count);
+    free(info->preds);
+    free(info->pred_count);
+    free(info->kill_start);
+    free(info->kills);
+    free_sets(info->use, n);
+    free_sets(info->def, n);
+    free_sets(info->live_in, n);
+    free_sets(info->live_out, n);
+    free(info->use_count);
+    memset(info, 0, sizeof(*info));
+}
+
+int dataflow_value_id(const DataflowInfo *info, SsaValueId value) {
+    return is_tracked(info->func, value) ? (int)value : -1;
+}
+
+bool dataflow_dies_at(const DataflowInfo *info, int block, int inst_index, SsaValueId value) {
+    int id = dataflow_value_id(info, value);
+    if (id < 0) return false;
+    const int *start = info->kill_start[block];
+    for (int j = start[inst_index]; j < start[inst_index + 1]; j++) {
+        if (info->kills[block][j] == id) return true;
+    }
+    return false;
+}
+
+// ========================================
+// 工作表求解器
+// ========================================
+
+void dataflow_solve(const DataflowInfo *info, BitVectorProblem *problem) {
+    int n = info->block_count;
+    problem->in = malloc((n ? n : 1) * sizeof(BitSet));
+    problem->out = malloc((n ? n : 1) * sizeof(BitSet));
+    assert(problem->in && problem->out);
+
+    // 交集问题的初值为全集（边界块除外），并集问题为空集
+    for (int b = 0; b < n; b++) {
+        bitset_init(&problem->in[b], problem->nbits);
+        bitset_init(&problem->out[b], problem->nbits);
+        if (!problem->meet_union) {
+            bitset_set_all(problem->forward ? &problem->out[b] : &problem->in[b]);
+        }
+    }
+
+    // 工作表为栈：后向问题先处理末尾的块，前向问题先处理入口块，通常可减少迭代次数
+    // 每个块至多在表中出现一次，容量 n 足够
+    int *worklist = malloc((n ? n : 1) * sizeof(int));
+    bool *queued = malloc((n ? n : 1) * sizeof(bool));
+    assert(worklist && queued);
+    int len = 0;
+    for (int i = 0; i < n; i++) {
+        worklist[len++] = problem->forward ? n - 1 - i : i;
+        queued[i] = true;
+    }
+
+    BitSet meet, result;
+    bitset_init(&meet, problem->nbits);
+    bitset_init(&result, problem->nbits);
+    while (len > 0) {
+        int b = worklist[--len];
+        queued[b] = false;
+
+        int *edges = problem->forward ? info->preds[b] : info->succs[b];
+        int edge_count = problem->forward ? info->pred_count[b] : info->succ_count[b];
+        BitSet *meet_into = problem->forward ? &problem->in[b] : &problem->out[b];
+        BitSet *computed = problem->forward ? &problem->out[b] : &problem->in[b];
+
+        if (edge_count > 0) {
+            BitSet *first = problem->forward ? &problem->out[edges[0]] : &problem->in[edges[0]];
+            bitset_copy(&meet, first);
+            for (int e = 1; e < edge_count; e++) {
+                BitSet *other = problem->forward ? &problem->out[edges[e]] : &problem->in[edges[e]];
+                if (problem->meet_union) bitset_union(&meet, other);
+                else bitset_intersect(&meet, other);
+            }
+        } else {
+            bitset_clear_all(&meet);
+        }
+        bitset_copy(meet_into, &meet);
+
+        bitset_copy(&result, &meet);
+        bitset_subtract(&result, &problem->kill[b]);
+        bitset_union(&result, &problem->gen[b]);
+        if (bitset_equal(&result, computed)) continue;
+        bitset_copy(computed, &result);
+
+        // 结果改变，依赖它的块重新入队
+        int *deps = problem->forward ? info->succs[b] : info->preds[b];
+        int dep_count = problem->forward ? info->succ_count[b] : info->pred_count[b];
+        for (int e = 0; e < dep_count; e++) {
+            int d = deps[e];
+            if (queued[d]) continue;
+            queued[d] = true;
+            worklist[len++] = d;
+        }
+    }
+    bitset_free(&meet);
+    bitset_free(&result);
+    free(worklist);
+    free(queued);
+}
+
+void dataflow_problem_free(const DataflowInfo *info, BitVectorProblem *problem) {
+    free_sets(problem->in, info->block_count);
+    free_sets(problem->out, info->block_count);
+    problem->in = NULL;
+    problem->out = NULL;
+}
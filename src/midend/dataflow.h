@@ -0,0 +1,122 @@
+#pragma once
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include "ssa.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// ========================================
+// 位向量集合
+// ========================================
+
+typedef struct {
+    uint64_t *words;
+    int nbits;
+} BitSet;
+
+void bitset_init(BitSet *set, int nbits);
+void bitset_free(BitSet *set);
+void bitset_clear_all(BitSet *set);
+void bitset_set_all(BitSet *set);
+void bitset_set(BitSet *set, int bit);
+void bitset_reset(BitSet *set, int bit);
+bool bitset_test(const BitSet *set, int bit);
+void bitset_copy(BitSet *dst, const BitSet *src);
+bool bitset_equal(const BitSet *a, const BitSet *b);
+// dst |= src，返回 dst 是否改变
+bool bitset_union(BitSet *dst, const BitSet *src);
+// dst &= src，返回 dst 是否改变
+bool bitset_intersect(BitSet *dst, const BitSet *src);
+// dst &= ~src
+void bitset_subtract(BitSet *dst, const BitSet *src);
+int bitset_count(const BitSet *set);
+
+// ========================================
+// 函数级分析结果
+// ========================================
+
+/**
+ * 一个函数的控制流图与数据流信息
+ * 被跟踪的值（指令结果、函数参数、基本块参数）直接以 SSA 编号为下标，
+ * 位向量与各数组的长度为函数的值数；整数常量不参与分析
+ */
+typedef struct {
+    const SsaFunction *func;
+
+    int value_count;
+    int *use_count;                 // 编号 → 被指令使用的次数
+
+    // 基本块与控制流，块下标与 SsaFunction.blocks 相同
+    int block_count;
+    int **succs;                    // 后继块下标
+    int *succ_count;
+    int **preds;                    // 前驱块下标
+    int *pred_count;
+
+    // 块级集合
+    BitSet *use;                    // 块内先使用后定义的值
+    BitSet *def;                    // 块内定义的值
+    BitSet *live_in;
+    BitSet *live_out;
+
+    // 指令级活跃性：块 b 的第 k 条指令之后不再活跃的操作数编号
+    // 为 kills[b][kill_start[b][k] .. kill_start[b][k + 1])
+    int **kill_start;
+    int **kills;
+} DataflowInfo;
+
+/**
+ * 通用位向量数据流问题，由 dataflow_solve 用工作表算法求解到不动点
+ * 前向问题：out = gen ∪ (in − kill)，in 为前驱 out 的交汇
+ * 后向问题：in = gen ∪ (out − kill)，out 为后继 in 的交汇
+ */
+typedef struct {
+    bool forward;       // 前向 / 后向
+    bool meet_union;    // 交汇为并集 / 交集
+    int nbits;
+    BitSet *gen;        // 每块一个
+    BitSet *kill;
+    BitSet *in;         // 结果，由 dataflow_solve 分配
+    BitSet *out;
+} BitVectorProblem;
+
+// 分析函数：使用计数、use/def、块级与指令级活跃性
+void dataflow_analyze(DataflowInfo *info, const SsaFunction *func);
+
+void dataflow_free(DataflowInfo *info);
+
+// 值在分析中的编号（即其 SSA 编号），未被跟踪的值返回 -1
+int dataflow_value_id(const DataflowInfo *info, SsaValueId value);
+
+// 值在块 block 的第 inst_index 条指令之后是否不再活跃（即该指令为其最后一次使用）
+bool dataflow_dies_at(const DataflowInfo *info, int block, int inst_index, SsaValueId value);
+
+/**
+ * 标记跨越调用仍活跃的值（调用之后还会被使用，调用的实参与结果本身不算）
+ * @param across 长度为 value_count 的输出数组
+ * @return 函数中是否有调用
+ */
+bool dataflow_live_across_calls(const DataflowInfo *info, bool *across);
+
+// 求解位向量数据流问题
+void dataflow_solve(const DataflowInfo *info, BitVectorProblem *problem);
+
+void dataflow_problem_free(const DataflowInfo *info, BitVectorProblem *problem);
+
+// 指令是否有副作用（调用、控制流）
+bool dataflow_has_side_effect(const SsaFunction *func, SsaValueId inst);
+
+/**
+ * 死代码删除：就地删除结果无人使用的纯运算（连同因此不再被使用的操作数），再压缩指令序列
+ * 会重新建立使用者列表，删除后列表中被删除的使用者为 SSA_NOP
+ * @return 删除的指令数
+ */
+int dataflow_eliminate_dead(SsaFunction *func);
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,52 @@
+#include "evalorder.h"
+#include <assert.h>
+
+/**
+ * 计算标号并设置 right_first
+ * @param has_call 输出：子表达式中是否含调用
+ */
+static int label(BaseAST *expr, bool *has_call, int *reordered) {
+    switch (expr->type) {
+        case AST_UNARY: {
+            UnaryAST *u = (UnaryAST *)expr;
+            int need = label(u->operand, has_call, reordered);
+            // 一元加号不生成指令，取负与逻辑非的结果占一个临时变量
+            return u->op == '+' || need > 0 ? need : 1;
+        }
+        case AST_BINARY: {
+            BinaryAST *b = (BinaryAST *)expr;
+            bool left_call = false, right_call = false;
+            int left = label(b->left, &left_call, reordered);
+            int right = label(b->right, &right_call, reordered);
+            b->right_first = right > left && !(left_call && right_call);
+            if (b->right_first && reordered) (*reordered)++;
+            *has_call = *has_call || left_call || right_call;
+            return left == right ? left + 1 : (left > right ? left : right);
+        }
+        case AST_CALL: {
+            CallAST *call = (CallAST *)expr;
+            *has_call = true;
+            int need = 1;
+            for (int i = 0; i < call->args.count; i++) {
+                int arg = label(call->args.items[i], has_call, reordered) + i;
+                if (arg > need) need = arg;
+            }
+            return need;
+        }
+        default:
+            return 0;
+    }
+}
+
+int eval_order_label_expr(BaseAST *expr, int *reordered) {
+    bool has_call = false;
+    return label(expr, &has_call, reordered);
+}
+
+int eval_order_label_func_def(FuncDefAST *def) {
+    assert(def && def->block && def->block->type == AST_BLOCK);
+    StmtAST *stmt = (StmtAST *)((BlockAST *)def->block)->stmt;
+    int reordered = 0;
+    eval_order_label_expr(stmt->expr, &reordered);
+    return reordered;
+}
@@ -0,0 +1,31 @@
+#pragma once
+
+#include "ast.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * 求值顺序（Sethi–Ullman 标号）
+ * 自底向上计算每棵子表达式求值时最多同时存活的临时变量数（标号）：
+ *   常量与形参不占临时变量，标号为 0
+ *   二元运算两侧标号相同为 l 时需要 l + 1（先算出的一侧要在另一侧求值期间保留），否则取较大者
+ *   调用的第 i 个实参求值时前 i 个实参的结果仍存活
+ * 右侧标号大于左侧时先求值右侧，峰值存活数由 l + 1 降为两者较大者；
+ * 指令中两侧的位置不变，只改变生成的先后，因此对所有运算符都成立
+ * 两侧都含调用时保持从左到右，调用的先后顺序与源程序一致
+ */
+
+/**
+ * 为函数体的返回表达式标号，并设置各 BinaryAST 的 right_first
+ * @return 改为先求值右侧的二元运算个数
+ */
+int eval_order_label_func_def(FuncDefAST *def);
+
+// 为表达式标号，返回其标号；reordered 不为 NULL 时累加改为先求值右侧的二元运算个数
+int eval_order_label_expr(BaseAST *expr, int *reordered);
+
+#ifdef __cplusplus
+}
+#endif
@@ -38,3 +38,20 @@ void dump_functions_to_stderr(koopa_raw_program_t raw) {
     fprintf(stderr, "[koopa] func: %s\n", f->name);                   // 输出函数名到标准错误流
   }
 }
+
+// 统计每个函数的基本块与指令条数
+void koopa_ir_record_stats(koopa_raw_program_t raw, CompileStats *stats) {
+  for (size_t i = 0; i < raw.funcs.len; ++i) {
+    const koopa_raw_function_t f = (const koopa_raw_function_t)raw.funcs.buffer[i];
+    if (f->bbs.len == 0) continue;                                    // 函数声明没有函数体
+
+    size_t insts = 0;
+    for (size_t j = 0; j < f->bbs.len; ++j) {
+      insts += ((const koopa_raw_basic_block_t)f->bbs.buffer[j])->insts.len;
+    }
+    FuncStats *func = compile_stats_function(stats, f->name + 1);    // 函数名去掉 @ 前缀
+    func->generated = true;
+    func_stats_set(func, "koopa_insts", (long)insts);
+    func_stats_set(func, "basic_blocks", (long)f->bbs.len);
+  }
+}
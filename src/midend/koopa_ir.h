@@ -2,6 +2,7 @@
 
 #include <stdio.h>
 #include "koopa.h"
+#include "stats.h"
 
 #ifdef __cplusplus
 extern "C" {
@@ -13,6 +14,9 @@ int parse_ir_from_string(const char *ir_text, koopa_raw_program_builder_t *out_b
 // 遍历 raw program，打印每个函数名到 stderr
 void dump_functions_to_stderr(koopa_raw_program_t raw);
 
+// 为每个有函数体的函数记录 Koopa 指令数（koopa_insts）与基本块数（basic_blocks），并标记为已生成
+void koopa_ir_record_stats(koopa_raw_program_t raw, CompileStats *stats);
+
 #ifdef __cplusplus
 }
 #endif
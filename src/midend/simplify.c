@@ -0,0 +1,701 @@
+#include "simplify.h"
+#include <assert.h>
+#include <limits.h>
+#include <stdlib.h>
+#include <string.h>
+
+// ========================================
+// 表达式性质
+// ========================================
+
+static bool number_value(const BaseAST *expr, int *value) {
+    if (expr->type != AST_NUMBER) return false;
+    *value = ((const NumberAST *)expr)->value;
+    return true;
+}
+
+static bool is_number(const BaseAST *expr, int value) {
+    int v;
+    return number_value(expr, &v) && v == value;
+}
+
+// 不含调用：丢弃这样的操作数不会改变调用图
+static bool is_pure(const BaseAST *expr) {
+    switch (expr->type) {
+        case AST_UNARY:
+            return is_pure(((const UnaryAST *)expr)->operand);
+        case AST_BINARY:
+            return is_pure(((const BinaryAST *)expr)->left) && is_pure(((const BinaryAST *)expr)->right);
+        case AST_CALL:
+            return false;
+        default:
+            return true;
+    }
+}
+
+static bool is_relational(char op) {
+    return op == '<' || op == '>' || op == 'l' || op == 'g' || op == 'e' || op == 'n';
+}
+
+// 结果必为 0/1
+static bool is_bool(const BaseAST *expr) {
+    int v;
+    if (number_value(expr, &v)) return v == 0 || v == 1;
+    if (expr->type == AST_UNARY) return ((const UnaryAST *)expr)->op == '!';
+    if (expr->type == AST_BINARY) {
+        char op = ((const BinaryAST *)expr)->op;
+        return is_relational(op) || op == '&' || op == '|';
+    }
+    return false;
+}
+
+// 结构相同（调用不视为相同，它们本来也不能被丢弃）
+static bool ast_equal(const BaseAST *a, const BaseAST *b) {
+    if (a->type != b->type) return false;
+    switch (a->type) {
+        case AST_NUMBER:
+            return ((const NumberAST *)a)->value == ((const NumberAST *)b)->value;
+        case AST_LVAL:
+            return strcmp(((const LValAST *)a)->ident, ((const LValAST *)b)->ident) == 0;
+        case AST_UNARY: {
+            const UnaryAST *ua = (const UnaryAST *)a, *ub = (const UnaryAST *)b;
+            return ua->op == ub->op && ast_equal(ua->operand, ub->operand);
+        }
+        case AST_BINARY: {
+            const BinaryAST *ba = (const BinaryAST *)a, *bb = (const BinaryAST *)b;
+            return ba->op == bb->op && ast_equal(ba->left, bb->left) && ast_equal(ba->right, bb->right);
+        }
+        default:
+            return false;
+    }
+}
+
+/**
+ * 按 32 位补码回绕计算二元运算（与生成的代码一致）
+ * @return 除以零或 INT_MIN / -1 等未定义行为时返回 false
+ */
+static bool apply_binary(char op, int l, int r, int *out) {
+    unsigned ul = (unsigned)l, ur = (unsigned)r;
+    switch (op) {
+        case '+': *out = (int)(ul + ur); return true;
+        case '-': *out = (int)(ul - ur); return true;
+        case '*': *out = (int)(ul * ur); return true;
+        case '/':
+        case '%':
+            if (r == 0 || (l == INT_MIN && r == -1)) return false;
+            *out = op == '/' ? l / r : l % r;
+            return true;
+        case '<': *out = l < r; return true;
+        case '>': *out = l > r; return true;
+        case 'l': *out = l <= r; return true;
+        case 'g': *out = l >= r; return true;
+        case 'e': *out = l == r; return true;
+        case 'n': *out = l != r; return true;
+        case '&': *out = l && r; return true;
+        case '|': *out = l || r; return true;
+        default: return false;
+    }
+}
+
+// ========================================
+// 重写辅助：规则消耗原节点并返回替换它的节点
+// ========================================
+
+// 以子节点 *child 替换 expr
+static BaseAST *keep(BaseAST *expr, BaseAST **child) {
+    BaseAST *kept = *child;
+    *child = NULL;
+    destroy_ast(expr);
+    return kept;
+}
+
+static BaseAST *to_number(BaseAST *expr, int value) {
+    destroy_ast(expr);
+    return create_number_ast(value);
+}
+
+// 以 -(*child) 替换 expr
+static BaseAST *keep_negated(BaseAST *expr, BaseAST **child) {
+    return create_unary_ast('-', keep(expr, child));
+}
+
+// ========================================
+// 规则：不匹配时返回 NULL 且不修改 expr
+// ========================================
+
+static BaseAST *rule_fold_unary(BaseAST *expr) {
+    if (expr->type != AST_UNARY) return NULL;
+    const UnaryAST *u = (const UnaryAST *)expr;
+    int v;
+    if (!number_value(u->operand, &v)) return NULL;
+    switch (u->op) {
+        case '-': return to_number(expr, (int)(0u - (unsigned)v));
+        case '!': return to_number(expr, v == 0);
+        case '+': return to_number(expr, v);
+        default: return NULL;
+    }
+}
+
+static BaseAST *rule_fold_binary(BaseAST *expr) {
+    if (expr->type != AST_BINARY) return NULL;
+    const BinaryAST *b = (const BinaryAST *)expr;
+    int l, r, v;
+    if (!number_value(b->left, &l) || !number_value(b->right, &r)) return NULL;
+    if (!apply_binary(b->op, l, r, &v)) return NULL;
+    return to_number(expr, v);
+}
+
+static BaseAST *rule_add_zero(BaseAST *expr) {
+    if (expr->type != AST_BINARY) return NULL;
+    BinaryAST *b = (BinaryAST *)expr;
+    if (b->op != '+') return NULL;
+    if (is_number(b->right, 0)) return keep(expr, &b->left);
+    if (is_number(b->left, 0)) return keep(expr, &b->right);
+    return NULL;
+}
+
+static BaseAST *rule_sub_zero(BaseAST *expr) {
+    if (expr->type != AST_BINARY) return NULL;
+    BinaryAST *b = (BinaryAST *)expr;
+    if (b->op != '-' || !is_number(b->right, 0)) return NULL;
+    return keep(expr, &b->left);
+}
+
+static BaseAST *rule_sub_from_zero(BaseAST *expr) {
+    if (expr->type != AST_BINARY) return NULL;
+    BinaryAST *b = (BinaryAST *)expr;
+    if (b->op != '-' || !is_number(b->left, 0)) return NULL;
+    return keep_negated(expr, &b->right);
+}
+
+static BaseAST *rule_mul_one(BaseAST *expr) {
+    if (expr->type != AST_BINARY) return NULL;
+    BinaryAST *b = (BinaryAST *)expr;
+    if ((b->op == '*' || b->op == '/') && is_number(b->right, 1)) return keep(expr, &b->left);
+    if (b->op == '*' && is_number(b->left, 1)) return keep(expr, &b->right);
+    return NULL;
+}
+
+static BaseAST *rule_mul_zero(BaseAST *expr) {
+    if (expr->type != AST_BINARY) return NULL;
+    const BinaryAST *b = (const BinaryAST *)expr;
+    if (b->op != '*') return NULL;
+    if ((is_number(b->right, 0) && is_pure(b->left)) || (is_number(b->left, 0) && is_pure(b->right))) {
+        return to_number(expr, 0);
+    }
+    return NULL;
+}
+
+static BaseAST *rule_mul_minus_one(BaseAST *expr) {
+    if (expr->type != AST_BINARY) return NULL;
+    BinaryAST *b = (BinaryAST *)expr;
+    if ((b->op == '*' || b->op == '/') && is_number(b->right, -1)) return keep_negated(expr, &b->left);
+    if (b->op == '*' && is_number(b->left, -1)) return keep_negated(expr, &b->right);
+    return NULL;
+}
+
+static BaseAST *rule_mod_one(BaseAST *expr) {
+    if (expr->type != AST_BINARY) return NULL;
+    const BinaryAST *b = (const BinaryAST *)expr;
+    if (b->op != '%' || !(is_number(b->right, 1) || is_number(b->right, -1)) || !is_pure(b->left)) return NULL;
+    return to_number(expr, 0);
+}
+
+// x - x、x / x、x % x：x 为零时除法本就未定义
+static BaseAST *rule_self_arith(BaseAST *expr) {
+    if (expr->type != AST_BINARY) return NULL;
+    const BinaryAST *b = (const BinaryAST *)expr;
+    if (b->op != '-' && b->op != '/' && b->op != '%') return NULL;
+    if (!ast_equal(b->left, b->right) || !is_pure(b->left)) return NULL;
+    return to_number(expr, b->op == '/');
+}
+
+static BaseAST *rule_self_compare(BaseAST *expr) {
+    if (expr->type != AST_BINARY) return NULL;
+    const BinaryAST *b = (const BinaryAST *)expr;
+    if (!is_relational(b->op) || !ast_equal(b->left, b->right) || !is_pure(b->left)) return NULL;
+    return to_number(expr, b->op == 'l' || b->op == 'g' || b->op == 'e');
+}
+
+static BaseAST *rule_double_neg(BaseAST *expr) {
+    if (expr->type != AST_UNARY) return NULL;
+    UnaryAST *u = (UnaryAST *)expr;
+    if (u->op != '-' || u->operand->type != AST_UNARY) return NULL;
+    UnaryAST *inner = (UnaryAST *)u->operand;
+    if (inner->op != '-') return NULL;
+    return keep(expr, &inner->operand);
+}
+
+static BaseAST *rule_double_not(BaseAST *expr) {
+    if (expr->type != AST_UNARY) return NULL;
+    UnaryAST *u = (UnaryAST *)expr;
+    if (u->op != '!' || u->operand->type != AST_UNARY) return NULL;
+    UnaryAST *inner = (UnaryAST *)u->operand;
+    if (inner->op != '!' || !is_bool(inner->operand)) return NULL;
+    return keep(expr, &inner->operand);
+}
+
+// x + (-y)、(-y) + x => x - y；x - (-y) => x + y
+static BaseAST *rule_add_neg(BaseAST *expr) {
+    if (expr->type != AST_BINARY) return NULL;
+    BinaryAST *b = (BinaryAST *)expr;
+    BaseAST **neg = NULL;
+    if ((b->op == '+' || b->op == '-') && b->right->type == AST_UNARY && ((UnaryAST *)b->right)->op == '-') {
+        neg = &b->right;
+    } else if (b->op == '+' && b->left->type == AST_UNARY && ((UnaryAST *)b->left)->op == '-') {
+        // 交换两侧，让取负的一侧在右边
+        BaseAST *t = b->left;
+        b->left = b->right;
+        b->right = t;
+        neg = &b->right;
+    } else {
+        return NULL;
+    }
+    UnaryAST *u = (UnaryAST *)*neg;
+    *neg = u->operand;
+    u->operand = NULL;
+    destroy_ast((BaseAST *)u);
+    b->op = b->op == '+' ? '-' : '+';
+    return expr;
+}
+
+// (x ± c1) ± c2 => x + c，c 为负时写成 x - (-c)
+static BaseAST *rule_const_chain(BaseAST *expr) {
+    if (expr->type != AST_BINARY) return NULL;
+    BinaryAST *outer = (BinaryAST *)expr;
+    int c2, c1;
+    if ((outer->op != '+' && outer->op != '-') || !number_value(outer->right, &c2)) return NULL;
+    if (outer->left->type != AST_BINARY) return NULL;
+    BinaryAST *inner = (BinaryAST *)outer->left;
+    if ((inner->op != '+' && inner->op != '-') || !number_value(inner->right, &c1)) return NULL;
+
+    unsigned c = (inner->op == '+' ? (unsigned)c1 : 0u - (unsigned)c1);
+    c = outer->op == '+' ? c + (unsigned)c2 : c - (unsigned)c2;
+    int value = (int)c;
+    BaseAST *x = inner->left;
+    inner->left = NULL;
+    destroy_ast(expr);
+    if (value < 0 && value != INT_MIN) return create_binary_ast('-', x, create_number_ast(-value));
+    return create_binary_ast('+', x, create_number_ast(value));
+}
+
+// 逻辑运算的一侧为常量：x && 0 => 0，b && 非零 => b，x || 非零 => 1，b || 0 => b
+static BaseAST *rule_logic_const(BaseAST *expr) {
+    if (expr->type != AST_BINARY) return NULL;
+    BinaryAST *b = (BinaryAST *)expr;
+    if (b->op != '&' && b->op != '|') return NULL;
+    for (int side = 0; side < 2; side++) {
+        BaseAST **constant = side == 0 ? &b->right : &b->left;
+        BaseAST **other = side == 0 ? &b->left : &b->right;
+        int v;
+        if (!number_value(*constant, &v)) continue;
+        bool absorbing = b->op == '&' ? v == 0 : v != 0;
+        if (absorbing && is_pure(*other)) return to_number(expr, b->op == '|');
+        if (!absorbing && is_bool(*other)) return keep(expr, other);
+    }
+    return NULL;
+}
+
+/**
+ * 规则表
+ * pattern 是规则左侧的 S 表达式，供报告与随机化自检生成实例：
+ * X、Y 为任意表达式（重复出现表示同一表达式），B 为结果为 0/1 的表达式，C1、C2 为任意常量，
+ * OP、UOP 为任意二元、一元运算符，多个模式以 ; 分隔
+ * 每条规则都使节点数严格减少，因此反复应用必然终止
+ */
+typedef struct {
+    const char *name;
+    const char *pattern;
+    BaseAST *(*apply)(BaseAST *expr);
+} SimplifyRule;
+
+static const SimplifyRule rules[] = {
+    {"fold-unary",     "(UOP C1)",                                           rule_fold_unary},
+    {"fold-binary",    "(OP C1 C2)",                                         rule_fold_binary},
+    {"add-zero",       "(+ X 0); (+ 0 X)",                                   rule_add_zero},
+    {"sub-zero",       "(- X 0)",                                            rule_sub_zero},
+    {"sub-from-zero",  "(- 0 X)",                                            rule_sub_from_zero},
+    {"mul-one",        "(* X 1); (* 1 X); (/ X 1)",                          rule_mul_one},
+    {"mul-zero",       "(* X 0); (* 0 X)",                                   rule_mul_zero},
+    {"mul-minus-one",  "(* X -1); (* -1 X); (/ X -1)",                       rule_mul_minus_one},
+    {"mod-one",        "(% X 1); (% X -1)",                                  rule_mod_one},
+    {"self-arith",     "(- X X); (/ X X); (% X X)",                          rule_self_arith},
+    {"self-compare",   "(== X X); (!= X X); (< X X); (> X X); (<= X X); (>= X X)", rule_self_compare},
+    {"double-neg",     "(- (- X))",                                          rule_double_neg},
+    {"double-not",     "(! (! B))",                                          rule_double_not},
+    {"add-neg",        "(+ X (- Y)); (+ (- Y) X); (- X (- Y))",              rule_add_neg},
+    {"const-chain",    "(+ (+ X C1) C2); (+ (- X C1) C2); (- (+ X C1) C2); (- (- X C1) C2)", rule_const_chain},
+    {"logic-const",    "(&& X 0); (&& 0 X); (&& B 1); (&& 1 B); (|| X 1); (|| 1 X); (|| B 0); (|| 0 B)",
+                       rule_logic_const},
+};
+
+#define RULE_COUNT ((int)(sizeof(rules) / sizeof(rules[0])))
+_Static_assert(sizeof(rules) / sizeof(rules[0]) <= SIMPLIFY_MAX_RULES, "too many simplify rules");
+
+// ========================================
+// 驱动
+// ========================================
+
+void simplify_stats_init(SimplifyStats *stats) {
+    memset(stats, 0, sizeof(*stats));
+}
+
+// 在根上反复应用规则直到不再匹配
+static BaseAST *rewrite_root(BaseAST *expr, SimplifyStats *stats, bool *changed) {
+    for (int i = 0; i < RULE_COUNT; i++) {
+        BaseAST *result = rules[i].apply(expr);
+        if (!result) continue;
+        if (stats) stats->counts[i]++;
+        *changed = true;
+        expr = result;
+        i = -1;
+    }
+    return expr;
+}
+
+// 自底向上重写一遍
+static BaseAST *rewrite_tree(BaseAST *expr, SimplifyStats *stats, bool *changed) {
+    switch (expr->type) {
+        case AST_UNARY: {
+            UnaryAST *u = (UnaryAST *)expr;
+            u->operand = rewrite_tree(u->operand, stats, changed);
+            break;
+        }
+        case AST_BINARY: {
+            BinaryAST *b = (BinaryAST *)expr;
+            b->left = rewrite_tree(b->left, stats, changed);
+            b->right = rewrite_tree(b->right, stats, changed);
+            break;
+        }
+        case AST_CALL: {
+            CallAST *call = (CallAST *)expr;
+            for (int i = 0; i < call->args.count; i++) {
+                call->args.items[i] = rewrite_tree(call->args.items[i], stats, changed);
+            }
+            break;
+        }
+        default:
+            break;
+    }
+    return rewrite_root(expr, stats, changed);
+}
+
+BaseAST *simplify_expr(BaseAST *expr, SimplifyStats *stats) {
+    assert(expr);
+    bool changed;
+    do {
+        changed = false;
+        expr = rewrite_tree(expr, stats, &changed);
+    } while (changed);
+    return expr;
+}
+
+void simplify_func_def(FuncDefAST *def, SimplifyStats *stats) {
+    assert(def && def->block && def->block->type == AST_BLOCK);
+    StmtAST *stmt = (StmtAST *)((BlockAST *)def->block)->stmt;
+    stmt->expr = simplify_expr(stmt->expr, stats);
+}
+
+const char *simplify_rule_name(int rule) {
+    return rule >= 0 && rule < RULE_COUNT ? rules[rule].name : NULL;
+}
+
+void simplify_report(FILE *out, const SimplifyStats *stats) {
+    for (int i = 0; i < RULE_COUNT; i++) {
+        if (stats->counts[i] > 0) fprintf(out, "[simplify] %s: %d\n", rules[i].name, stats->counts[i]);
+    }
+}
+
+// ========================================
+// 随机化自检
+// ========================================
+
+// 自检中表达式可引用的形参
+static const char *const check_vars[] = {"x", "y", "z"};
+#define CHECK_VAR_COUNT 3
+// 常量池：偏向规则关心的 0、±1 与回绕边界
+static const int check_consts[] = {0, 1, -1, 2, 3, 7, 100, INT_MIN, INT_MAX};
+#define CHECK_CONST_COUNT ((int)(sizeof(check_consts) / sizeof(check_consts[0])))
+// 每个实例比较的形参取值组数
+#define CHECK_SAMPLES 16
+
+typedef struct {
+    unsigned state;
+} Rng;
+
+static unsigned rng_next(Rng *rng) {
+    // xorshift32
+    unsigned x = rng->state;
+    x ^= x << 13;
+    x ^= x >> 17;
+    x ^= x << 5;
+    return rng->state = x;
+}
+
+static int rng_below(Rng *rng, int n) {
+    return (int)(rng_next(rng) % (unsigned)n);
+}
+
+static BaseAST *make_lval(const char *name) {
+    char *ident = malloc(strlen(name) + 1);
+    assert(ident);
+    strcpy(ident, name);
+    return create_lval_ast(ident);
+}
+
+static BaseAST *clone_expr(const BaseAST *expr) {
+    switch (expr->type) {
+        case AST_NUMBER:
+            return create_number_ast(((const NumberAST *)expr)->value);
+        case AST_LVAL:
+            return make_lval(((const LValAST *)expr)->ident);
+        case AST_UNARY: {
+            const UnaryAST *u = (const UnaryAST *)expr;
+            return create_unary_ast(u->op, clone_expr(u->operand));
+        }
+        case AST_BINARY: {
+            const BinaryAST *b = (const BinaryAST *)expr;
+            return create_binary_ast(b->op, clone_expr(b->left), clone_expr(b->right));
+        }
+        default:
+            assert(0 && "Unexpected expression in simplify check");
+            return NULL;
+    }
+}
+
+static int count_nodes(const BaseAST *expr) {
+    switch (expr->type) {
+        case AST_UNARY:
+            return 1 + count_nodes(((const UnaryAST *)expr)->operand);
+        case AST_BINARY:
+            return 1 + count_nodes(((const BinaryAST *)expr)->left) + count_nodes(((const BinaryAST *)expr)->right);
+        default:
+            return 1;
+    }
+}
+
+// 按 C 语义求值（&&、|| 短路，整数运算回绕），遇到未定义行为返回 false
+static bool eval_expr(const BaseAST *expr, const int *vars, int *out) {
+    switch (expr->type) {
+        case AST_NUMBER:
+            *out = ((const NumberAST *)expr)->value;
+            return true;
+        case AST_LVAL: {
+            const char *ident = ((const LValAST *)expr)->ident;
+            for (int i = 0; i < CHECK_VAR_COUNT; i++) {
+                if (strcmp(ident, check_vars[i]) == 0) {
+                    *out = vars[i];
+                    return true;
+                }
+            }
+            assert(0 && "Unknown variable in simplify check");
+            return false;
+        }
+        case AST_UNARY: {
+            const UnaryAST *u = (const UnaryAST *)expr;
+            int v;
+            if (!eval_expr(u->operand, vars, &v)) return false;
+            *out = u->op == '-' ? (int)(0u - (unsigned)v) : u->op == '!' ? v == 0 : v;
+            return true;
+        }
+        case AST_BINARY: {
+            const BinaryAST *b = (const BinaryAST *)expr;
+            int l, r;
+            if (!eval_expr(b->left, vars, &l)) return false;
+            if (b->op == '&' && l == 0) { *out = 0; return true; }
+            if (b->op == '|' && l != 0) { *out = 1; return true; }
+            if (!eval_expr(b->right, vars, &r)) return false;
+            return apply_binary(b->op, l, r, out);
+        }
+        default:
+            assert(0 && "Unexpected expression in simplify check");
+            return false;
+    }
+}
+
+static const char check_binary_ops[] = "+-*/%<>lgen&|";
+
+static BaseAST *random_leaf(Rng *rng) {
+    if (rng_below(rng, 2)) return make_lval(check_vars[rng_below(rng, CHECK_VAR_COUNT)]);
+    return create_number_ast(check_consts[rng_below(rng, CHECK_CONST_COUNT)]);
+}
+
+// 随机表达式，有一定概率让两个操作数相同以产生 x - x 之类的模式
+static BaseAST *random_expr(Rng *rng, int depth) {
+    if (depth <= 0 || rng_below(rng, 4) == 0) return random_leaf(rng);
+    int kind = rng_below(rng, 8);
+    if (kind == 0) return create_unary_ast(rng_below(rng, 2) ? '-' : '!', random_expr(rng, depth - 1));
+    char op = check_binary_ops[rng_below(rng, (int)sizeof(check_binary_ops) - 1)];
+    BaseAST *left = random_expr(rng, depth - 1);
+    BaseAST *right = kind == 1 ? clone_expr(left) : random_expr(rng, depth - 1);
+    return create_binary_ast(op, left, right);
+}
+
+static BaseAST *random_bool(Rng *rng, int depth) {
+    static const char bool_ops[] = "<>lgen&|";
+    if (rng_below(rng, 4) == 0) return create_unary_ast('!', random_expr(rng, depth));
+    char op = bool_ops[rng_below(rng, (int)sizeof(bool_ops) - 1)];
+    return create_binary_ast(op, random_expr(rng, depth), random_expr(rng, depth));
+}
+
+// 模式实例化时元变量的绑定，同名元变量取同一表达式
+typedef struct {
+    Rng *rng;
+    BaseAST *exprs[3];      // X、Y、B
+    int consts[2];          // C1、C2
+    bool const_bound[2];
+} Bindings;
+
+static void skip_spaces(const char **p) {
+    while (**p == ' ') (*p)++;
+}
+
+// 读取一个记号：括号或一串非空白字符
+static void read_token(const char **p, char *buf, size_t size) {
+    skip_spaces(p);
+    size_t n = 0;
+    if (**p == '(' || **p == ')') {
+        buf[n++] = *(*p)++;
+    } else {
+        while (**p && **p != ' ' && **p != '(' && **p != ')' && **p != ';' && n + 1 < size) buf[n++] = *(*p)++;
+    }
+    buf[n] = '\0';
+}
+
+static char pattern_op(const char *token, int arity, Rng *rng) {
+    static const struct { const char *token; char op; } ops[] = {
+        {"+", '+'}, {"-", '-'}, {"*", '*'}, {"/", '/'}, {"%", '%'}, {"!", '!'},
+        {"<", '<'}, {">", '>'}, {"<=", 'l'}, {">=", 'g'}, {"==", 'e'}, {"!=", 'n'},
+        {"&&", '&'}, {"||", '|'},
+    };
+    if (strcmp(token, "OP") == 0) return check_binary_ops[rng_below(rng, (int)sizeof(check_binary_ops) - 1)];
+    if (strcmp(token, "UOP") == 0) return rng_below(rng, 2) ? '-' : '!';
+    for (size_t i = 0; i < sizeof(ops) / sizeof(ops[0]); i++) {
+        if (strcmp(token, ops[i].token) == 0) {
+            assert(arity == 2 || ops[i].op == '-' || ops[i].op == '!');
+            return ops[i].op;
+        }
+    }
+    assert(0 && "Unknown operator in simplify pattern");
+    return 0;
+}
+
+static BaseAST *instantiate(const char **p, Bindings *b) {
+    char token[8];
+    read_token(p, token, sizeof(token));
+    if (strcmp(token, "(") == 0) {
+        char op_token[8];
+        read_token(p, op_token, sizeof(op_token));
+        BaseAST *operands[2];
+        int arity = 0;
+        for (;;) {
+            skip_spaces(p);
+            if (**p == ')') {
+                (*p)++;
+                break;
+            }
+            assert(arity < 2);
+            operands[arity++] = instantiate(p, b);
+        }
+        char op = pattern_op(op_token, arity, b->rng);
+        if (arity == 1) return create_unary_ast(op, operands[0]);
+        return create_binary_ast(op, operands[0], operands[1]);
+    }
+
+    static const char metavars[] = "XYB";
+    const char *meta = token[0] ? strchr(metavars, token[0]) : NULL;
+    if (meta && token[1] == '\0') {
+        int slot = (int)(meta - metavars);
+        if (!b->exprs[slot]) b->exprs[slot] = slot == 2 ? random_bool(b->rng, 2) : random_expr(b->rng, 2);
+        return clone_expr(b->exprs[slot]);
+    }
+    if (token[0] == 'C') {
+        int slot = token[1] - '1';
+        assert(slot == 0 || slot == 1);
+        if (!b->const_bound[slot]) {
+            b->consts[slot] = check_consts[rng_below(b->rng, CHECK_CONST_COUNT)];
+            b->const_bound[slot] = true;
+        }
+        return create_number_ast(b->consts[slot]);
+    }
+    return create_number_ast((int)strtol(token, NULL, 10));
+}
+
+// 随机选取 pattern 中的一个模式并实例化
+static BaseAST *instantiate_pattern(const char *pattern, Rng *rng) {
+    int alternatives = 1;
+    for (const char *c = pattern; *c; c++) alternatives += *c == ';';
+    int chosen = rng_below(rng, alternatives);
+    const char *p = pattern;
+    for (int i = 0; i < chosen; i++) p = strchr(p, ';') + 1;
+
+    Bindings b;
+    memset(&b, 0, sizeof(b));
+    b.rng = rng;
+    BaseAST *expr = instantiate(&p, &b);
+    for (int i = 0; i < 3; i++) destroy_ast(b.exprs[i]);
+    return expr;
+}
+
+static void random_vars(Rng *rng, int *vars) {
+    for (int i = 0; i < CHECK_VAR_COUNT; i++) {
+        vars[i] = rng_below(rng, 2) ? check_consts[rng_below(rng, CHECK_CONST_COUNT)] : (int)rng_next(rng);
+    }
+}
+
+// 在随机取值下比较，原表达式有定义时重写后的表达式必须有定义且值相同
+static bool same_semantics(const BaseAST *before, const BaseAST *after, Rng *rng) {
+    for (int s = 0; s < CHECK_SAMPLES; s++) {
+        int vars[CHECK_VAR_COUNT], expected, actual;
+        random_vars(rng, vars);
+        if (!eval_expr(before, vars, &expected)) continue;
+        if (!eval_expr(after, vars, &actual) || actual != expected) return false;
+    }
+    return true;
+}
+
+int simplify_self_check(int iterations, unsigned seed, FILE *report) {
+    Rng rng = {seed ? seed : 1};
+    int failures = 0;
+
+    for (int i = 0; i < RULE_COUNT; i++) {
+        int fired = 0, mismatches = 0;
+        for (int it = 0; it < iterations; it++) {
+            BaseAST *expr = instantiate_pattern(rules[i].pattern, &rng);
+            BaseAST *copy = clone_expr(expr);
+            BaseAST *result = rules[i].apply(copy);
+            if (result) {
+                fired++;
+                if (count_nodes(result) >= count_nodes(expr) || !same_semantics(expr, result, &rng)) mismatches++;
+                destroy_ast(result);
+            } else {
+                destroy_ast(copy);
+            }
+            destroy_ast(expr);
+        }
+        bool ok = fired > 0 && mismatches == 0;
+        failures += !ok;
+        fprintf(report, "%-14s %6d/%d matched, %d mismatch(es)%s   %s\n", rules[i].name, fired, iterations,
+                mismatches, ok ? "" : "  FAILED", rules[i].pattern);
+    }
+
+    // 整体：随机表达式化简后语义不变、节点不增，且再重写一遍没有变化
+    int changed_count = 0, mismatches = 0;
+    for (int it = 0; it < iterations; it++) {
+        BaseAST *expr = random_expr(&rng, 5);
+        BaseAST *simplified = simplify_expr(clone_expr(expr), NULL);
+        bool changed = false;
+        simplified = rewrite_tree(simplified, NULL, &changed);
+        if (changed || count_nodes(simplified) > count_nodes(expr) || !same_semantics(expr, simplified, &rng)) {
+            mismatches++;
+        }
+        changed_count += count_nodes(simplified) < count_nodes(expr);
+        destroy_ast(simplified);
+        destroy_ast(expr);
+    }
+    bool ok = mismatches == 0;
+    failures += !ok;
+    fprintf(report, "%-14s %6d/%d simplified, %d mismatch(es)%s\n", "fixed-point", changed_count, iterations,
+            mismatches, ok ? "" : "  FAILED");
+    return failures;
+}
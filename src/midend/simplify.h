@@ -0,0 +1,52 @@
+#pragma once
+
+#include <stdbool.h>
+#include <stdio.h>
+#include "ast.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// 规则表的容量上限
+#define SIMPLIFY_MAX_RULES 32
+
+// 代数化简统计：每条规则的触发次数（按规则表下标）
+typedef struct {
+    int counts[SIMPLIFY_MAX_RULES];
+} SimplifyStats;
+
+void simplify_stats_init(SimplifyStats *stats);
+
+/**
+ * 按规则表重写表达式树，直到没有规则可以应用（不动点）
+ * 每条规则都严格减少节点数，因此必然终止；被丢弃的操作数须不含调用，调用点不会因化简而消失
+ * @param expr 表达式，所有权转移，可能被释放
+ * @param stats 统计，可为 NULL
+ * @return 化简后的表达式
+ */
+BaseAST *simplify_expr(BaseAST *expr, SimplifyStats *stats);
+
+// 化简函数体中的返回表达式
+void simplify_func_def(FuncDefAST *def, SimplifyStats *stats);
+
+// 规则名（与 SimplifyStats 的下标对应），超出规则表时返回 NULL
+const char *simplify_rule_name(int rule);
+
+// 按规则输出触发次数，未触发的规则不输出
+void simplify_report(FILE *out, const SimplifyStats *stats);
+
+/**
+ * 随机化自检：按每条规则声明的模式随机生成实例，检查规则确实匹配，
+ * 并在随机取值的形参下比较重写前后的值（原表达式有未定义行为的取值不参与比较）；
+ * 之后对随机表达式树检查整个化简过程保持语义且结果为不动点
+ * @param iterations 每条规则生成的实例数
+ * @param seed 随机种子
+ * @param report 每条规则一行结果
+ * @return 失败的规则数（含整体检查），0 表示全部通过
+ */
+int simplify_self_check(int iterations, unsigned seed, FILE *report);
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,538 @@
+#include "ssa.h"
+#include <assert.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "diag.h"
+static char *copy_string(const char *s) {
+    char *copy = malloc(strlen(s) + 1);
+    assert(copy);
+    return strcpy(copy, s);
+}
+
+// 容量不足时按倍数扩大数组
+static void *grow(void *array, uint32_t *cap, uint32_t need, size_t elem_size) {
+    if (need <= *cap) return array;
+    uint32_t new_cap = *cap ? *cap : 16;
+    while (new_cap < need) new_cap *= 2;
+    array = realloc(array, (size_t)new_cap * elem_size);
+    assert(array);
+    *cap = new_cap;
+    return array;
+}
+
+static SsaValueId new_value(SsaFunction *func, SsaOp op, bool has_result) {
+    func->values = grow(func->values, &func->value_cap, func->value_count + 1, sizeof(SsaValue));
+    SsaValue *value = &func->values[func->value_count];
+    memset(value, 0, sizeof(*value));
+    value->op = (uint8_t)op;
+    value->has_result = has_result;
+    value->operand_start = func->operand_count;
+    return func->value_count++;
+}
+
+static void push_operand(SsaFunction *func, SsaValueId operand) {
+    func->operands = grow(func->operands, &func->operand_cap, func->operand_count + 1, sizeof(SsaValueId));
+    func->operands[func->operand_count++] = operand;
+}
+
+// ========================================
+// 常量去重
+// ========================================
+
+static size_t hash_int(uint32_t x) {
+    x ^= x >> 16;
+    x *= 0x45d9f3b;
+    x ^= x >> 16;
+    return x;
+}
+
+static SsaValueId *const_slot(SsaValueId *table, uint32_t cap, const SsaValue *values, int32_t value) {
+    size_t i = hash_int((uint32_t)value) & (cap - 1);
+    while (table[i] != SSA_NONE && values[table[i]].imm != value) i = (i + 1) & (cap - 1);
+    return &table[i];
+}
+
+SsaValueId ssa_const(SsaFunction *func, int32_t value) {
+    if ((func->const_count + 1) * 2 > func->const_cap) {
+        uint32_t new_cap = func->const_cap ? func->const_cap * 2 : 64;
+        SsaValueId *table = malloc(new_cap * sizeof(SsaValueId));
+        assert(table);
+        memset(table, 0xff, new_cap * sizeof(SsaValueId));
+        for (uint32_t i = 0; i < func->const_cap; i++) {
+            SsaValueId id = func->const_table[i];
+            if (id != SSA_NONE) *const_slot(table, new_cap, func->values, func->values[id].imm) = id;
+        }
+        free(func->const_table);
+        func->const_table = table;
+        func->const_cap = new_cap;
+    }
+    SsaValueId *slot = const_slot(func->const_table, func->const_cap, func->values, value);
+    if (*slot == SSA_NONE) {
+        *slot = new_value(func, SSA_CONST, true);
+        func->values[*slot].imm = value;
+        func->const_count++;
+    }
+    return *slot;
+}
+
+// ========================================
+// 导入：指针 → 编号的哈希表
+// ========================================
+
+typedef struct {
+    const void **keys;
+    uint32_t *vals;
+    size_t cap;
+    size_t len;
+} PtrMap;
+
+static size_t hash_ptr(const void *p) {
+    uintptr_t x = (uintptr_t)p;
+    x ^= x >> 16;
+    x *= 0x45d9f3b;
+    x ^= x >> 16;
+    return (size_t)x;
+}
+
+static size_t ptr_map_find(const PtrMap *map, const void *key) {
+    size_t i = hash_ptr(key) & (map->cap - 1);
+    while (map->keys[i] && map->keys[i] != key) i = (i + 1) & (map->cap - 1);
+    return i;
+}
+
+static void ptr_map_put(PtrMap *map, const void *key, uint32_t val) {
+    if ((map->len + 1) * 2 > map->cap) {
+        PtrMap old = *map;
+        map->cap = old.cap ? old.cap * 2 : 64;
+        map->keys = calloc(map->cap, sizeof(void *));
+        map->vals = malloc(map->cap * sizeof(uint32_t));
+        assert(map->keys && map->vals);
+        for (size_t i = 0; i < old.cap; i++) {
+            if (!old.keys[i]) continue;
+            size_t j = ptr_map_find(map, old.keys[i]);
+            map->keys[j] = old.keys[i];
+            map->vals[j] = old.vals[i];
+        }
+        free(old.keys);
+        free(old.vals);
+    }
+    size_t i = ptr_map_find(map, key);
+    if (!map->keys[i]) {
+        map->keys[i] = key;
+        map->len++;
+    }
+    map->vals[i] = val;
+}
+
+static uint32_t ptr_map_get(const PtrMap *map, const void *key) {
+    if (map->cap == 0) return SSA_NONE;
+    size_t i = ptr_map_find(map, key);
+    return map->keys[i] ? map->vals[i] : SSA_NONE;
+}
+
+static void ptr_map_clear(PtrMap *map) {
+    if (map->keys) memset(map->keys, 0, map->cap * sizeof(void *));
+    map->len = 0;
+}
+
+static void ptr_map_free(PtrMap *map) {
+    free(map->keys);
+    free(map->vals);
+}
+
+// ========================================
+// 导入
+// ========================================
+
+typedef struct {
+    PtrMap funcs;       // 函数 → 下标
+    PtrMap blocks;      // 当前函数的基本块 → 下标
+    PtrMap values;      // 当前函数的参数、块参数与指令 → 编号
+} ImportState;
+
+static const SsaOp binary_ops[] = {
+    [KOOPA_RBO_NOT_EQ] = SSA_NE, [KOOPA_RBO_EQ] = SSA_EQ, [KOOPA_RBO_GT] = SSA_GT, [KOOPA_RBO_LT] = SSA_LT,
+    [KOOPA_RBO_GE] = SSA_GE, [KOOPA_RBO_LE] = SSA_LE, [KOOPA_RBO_ADD] = SSA_ADD, [KOOPA_RBO_SUB] = SSA_SUB,
+    [KOOPA_RBO_MUL] = SSA_MUL, [KOOPA_RBO_DIV] = SSA_DIV, [KOOPA_RBO_MOD] = SSA_MOD, [KOOPA_RBO_AND] = SSA_AND,
+    [KOOPA_RBO_OR] = SSA_OR, [KOOPA_RBO_XOR] = SSA_XOR, [KOOPA_RBO_SHL] = SSA_SHL, [KOOPA_RBO_SHR] = SSA_SHR,
+    [KOOPA_RBO_SAR] = SSA_SAR,
+};
+
+static const char *const op_names[SSA_BINARY_COUNT] = {
+    "ne", "eq", "gt", "lt", "ge", "le", "add", "sub", "mul", "div", "mod", "and", "or", "xor", "shl", "shr", "sar",
+};
+
+// 操作数的编号：常量去重，其余须为已登记的参数、块参数或指令
+static int import_operand(SsaFunction *func, ImportState *st, koopa_raw_value_t value) {
+    if (value->kind.tag == KOOPA_RVT_INTEGER) {
+        push_operand(func, ssa_const(func, value->kind.data.integer.value));
+        return 0;
+    }
+    SsaValueId id = ptr_map_get(&st->values, value);
+    if (id == SSA_NONE) {
+        fprintf(diag_err(), "Unsupported Koopa operand (kind %d) in @%s\n", (int)value->kind.tag, func->name);
+        return -1;
+    }
+    push_operand(func, id);
+    return 0;
+}
+
+static int import_operands(SsaFunction *func, ImportState *st, koopa_raw_slice_t slice) {
+    for (uint32_t i = 0; i < slice.len; i++) {
+        if (import_operand(func, st, (koopa_raw_value_t)slice.buffer[i]) != 0) return -1;
+    }
+    return 0;
+}
+
+// 填写指令的运算与操作数，id 已在第一遍登记
+static int import_inst(SsaFunction *func, ImportState *st, SsaValueId id, koopa_raw_value_t inst) {
+    const koopa_raw_value_kind_t *kind = &inst->kind;
+    SsaOp op;
+    int32_t imm = 0;
+    uint32_t aux = 0;
+    uint32_t start = func->operand_count;
+    int ret = 0;
+    switch (kind->tag) {
+        case KOOPA_RVT_BINARY:
+            op = binary_ops[kind->data.binary.op];
+            ret = import_operand(func, st, kind->data.binary.lhs);
+            if (!ret) ret = import_operand(func, st, kind->data.binary.rhs);
+            break;
+        case KOOPA_RVT_CALL:
+            op = SSA_CALL;
+            imm = (int32_t)ptr_map_get(&st->funcs, kind->data.call.callee);
+            ret = import_operands(func, st, kind->data.call.args);
+            break;
+        case KOOPA_RVT_RETURN:
+            op = SSA_RET;
+            if (kind->data.ret.value) ret = import_operand(func, st, kind->data.ret.value);
+            break;
+        case KOOPA_RVT_BRANCH:
+            op = SSA_BR;
+            imm = (int32_t)ptr_map_get(&st->blocks, kind->data.branch.true_bb);
+            aux = ptr_map_get(&st->blocks, kind->data.branch.false_bb);
+            ret = import_operand(func, st, kind->data.branch.cond);
+            if (!ret) ret = import_operands(func, st, kind->data.branch.true_args);
+            if (!ret) ret = import_operands(func, st, kind->data.branch.false_args);
+            break;
+        case KOOPA_RVT_JUMP:
+            op = SSA_JUMP;
+            imm = (int32_t)ptr_map_get(&st->blocks, kind->data.jump.target);
+            ret = import_operands(func, st, kind->data.jump.args);
+            break;
+        default:
+            fprintf(diag_err(), "Unsupported Koopa instruction (kind %d) in @%s\n", (int)kind->tag, func->name);
+            return -1;
+    }
+    SsaValue *value = &func->values[id];
+    value->op = (uint8_t)op;
+    value->imm = imm;
+    value->aux = aux;
+    value->operand_start = start;
+    value->operand_count = (uint16_t)(func->operand_count - start);
+    return ret;
+}
+
+/**
+ * 导入一个有函数体的函数
+ * 第一遍为参数、块参数与全部指令编号，第二遍填写指令，因此操作数可以引用排在后面的块中定义的值
+ */
+static int import_body(SsaFunction *func, ImportState *st, koopa_raw_function_t f) {
+    ptr_map_clear(&st->blocks);
+    ptr_map_clear(&st->values);
+
+    func->param_names = malloc((func->param_count ? func->param_count : 1) * sizeof(char *));
+    assert(func->param_names);
+    for (uint32_t i = 0; i < func->param_count; i++) {
+        koopa_raw_value_t param = (koopa_raw_value_t)f->params.buffer[i];
+        func->param_names[i] = copy_string(param->name);
+        SsaValueId id = new_value(func, SSA_PARAM, true);
+        func->values[id].imm = (int32_t)i;
+        ptr_map_put(&st->values, param, id);
+    }
+
+    func->block_count = f->bbs.len;
+    func->blocks = calloc(func->block_count, sizeof(SsaBlock));
+    assert(func->blocks);
+    for (uint32_t b = 0; b < func->block_count; b++) {
+        koopa_raw_basic_block_t bb = (koopa_raw_basic_block_t)f->bbs.buffer[b];
+        ptr_map_put(&st->blocks, bb, b);
+    }
+    for (uint32_t b = 0; b < func->block_count; b++) {
+        koopa_raw_basic_block_t bb = (koopa_raw_basic_block_t)f->bbs.buffer[b];
+        SsaBlock *block = &func->blocks[b];
+        char label[32];
+        snprintf(label, sizeof(label), "%%bb%u", b);
+        block->name = copy_string(bb->name ? bb->name : label);
+        block->param_start = func->value_count;
+        block->param_count = bb->params.len;
+        for (uint32_t i = 0; i < bb->params.len; i++) {
+            SsaValueId id = new_value(func, SSA_BLOCK_PARAM, true);
+            func->values[id].imm = (int32_t)b;
+            func->values[id].aux = i;
+            ptr_map_put(&st->values, bb->params.buffer[i], id);
+        }
+        block->inst_start = func->inst_count;
+        block->inst_count = bb->insts.len;
+        func->insts = grow(func->insts, &func->inst_cap, func->inst_count + bb->insts.len, sizeof(SsaValueId));
+        for (uint32_t i = 0; i < bb->insts.len; i++) {
+            koopa_raw_value_t inst = (koopa_raw_value_t)bb->insts.buffer[i];
+            SsaValueId id = new_value(func, SSA_NOP, inst->ty->tag != KOOPA_RTT_UNIT);
+            ptr_map_put(&st->values, inst, id);
+            func->insts[func->inst_count++] = id;
+        }
+    }
+
+    for (uint32_t b = 0; b < func->block_count; b++) {
+        koopa_raw_basic_block_t bb = (koopa_raw_basic_block_t)f->bbs.buffer[b];
+        for (uint32_t i = 0; i < bb->insts.len; i++) {
+            if (import_inst(func, st, ssa_block_inst(func, b, i), (koopa_raw_value_t)bb->insts.buffer[i]) != 0) {
+                return -1;
+            }
+        }
+    }
+    return 0;
+}
+
+int ssa_import_koopa(SsaProgram *prog, koopa_raw_program_t raw) {
+    prog->func_count = raw.funcs.len;
+    prog->funcs = calloc(prog->func_count ? prog->func_count : 1, sizeof(SsaFunction));
+    assert(prog->funcs);
+
+    ImportState st;
+    memset(&st, 0, sizeof(st));
+    for (uint32_t i = 0; i < raw.funcs.len; i++) {
+        koopa_raw_function_t f = (koopa_raw_function_t)raw.funcs.buffer[i];
+        SsaFunction *func = &prog->funcs[i];
+        func->name = copy_string(f->name + 1);
+        func->returns_value = f->ty->data.function.ret->tag != KOOPA_RTT_UNIT;
+        func->param_count = f->ty->data.function.params.len;
+        ptr_map_put(&st.funcs, f, i);
+    }
+
+    int ret = 0;
+    for (uint32_t i = 0; i < raw.funcs.len && ret == 0; i++) {
+        koopa_raw_function_t f = (koopa_raw_function_t)raw.funcs.buffer[i];
+        if (f->bbs.len > 0) ret = import_body(&prog->funcs[i], &st, f);
+    }
+    ptr_map_free(&st.funcs);
+    ptr_map_free(&st.blocks);
+    ptr_map_free(&st.values);
+    if (ret) ssa_program_free(prog);
+    return ret;
+}
+
+static void function_free(SsaFunction *func) {
+    free(func->name);
+    if (func->param_names) {
+        for (uint32_t i = 0; i < func->param_count; i++) free(func->param_names[i]);
+    }
+    free(func->param_names);
+    for (uint32_t b = 0; b < func->block_count; b++) free(func->blocks[b].name);
+    free(func->blocks);
+    free(func->values);
+    free(func->operands);
+    free(func->insts);
+    free(func->user_start);
+    free(func->users);
+    free(func->const_table);
+}
+
+void ssa_program_free(SsaProgram *prog) {
+    for (uint32_t i = 0; i < prog->func_count; i++) function_free(&prog->funcs[i]);
+    free(prog->funcs);
+    prog->funcs = NULL;
+    prog->func_count = 0;
+}
+
+// ========================================
+// 改写
+// ========================================
+
+void ssa_rewrite(SsaFunction *func, SsaValueId inst, SsaOp op, const SsaValueId *operands, uint32_t count) {
+    SsaValue *value = &func->values[inst];
+    if (count > value->operand_count) {
+        // 新操作数可能取自 operands 数组本身，扩大数组前记下其位置
+        bool aliased = operands >= func->operands && operands < func->operands + func->operand_count;
+        size_t offset = aliased ? (size_t)(operands - func->operands) : 0;
+        func->operands = grow(func->operands, &func->operand_cap, func->operand_count + count, sizeof(SsaValueId));
+        if (aliased) operands = func->operands + offset;
+        value->operand_start = func->operand_count;
+        func->operand_count += count;
+    }
+    memmove(func->operands + value->operand_start, operands, count * sizeof(SsaValueId));
+    value->op = (uint8_t)op;
+    value->operand_count = (uint16_t)count;
+}
+
+void ssa_remove(SsaFunction *func, SsaValueId inst) {
+    func->values[inst].op = SSA_NOP;
+    func->values[inst].operand_count = 0;
+}
+
+void ssa_compact(SsaFunction *func) {
+    uint32_t pos = 0;
+    for (uint32_t b = 0; b < func->block_count; b++) {
+        SsaBlock *block = &func->blocks[b];
+        uint32_t start = pos;
+        for (uint32_t i = 0; i < block->inst_count; i++) {
+            SsaValueId inst = func->insts[block->inst_start + i];
+            if (func->values[inst].op != SSA_NOP) func->insts[pos++] = inst;
+        }
+        block->inst_start = start;
+        block->inst_count = pos - start;
+    }
+    func->inst_count = pos;
+}
+
+void ssa_build_users(SsaFunction *func) {
+    free(func->user_start);
+    free(func->users);
+    uint32_t n = func->value_count;
+    func->user_start = calloc(n + 1, sizeof(uint32_t));
+    assert(func->user_start);
+
+    // 计数后前缀和，再按指令顺序填入
+    for (uint32_t i = 0; i < func->inst_count; i++) {
+        SsaValueId inst = func->insts[i];
+        const SsaValueId *ops = ssa_operands(func, inst);
+        for (uint32_t k = 0; k < func->values[inst].operand_count; k++) func->user_start[ops[k] + 1]++;
+    }
+    for (uint32_t v = 0; v < n; v++) func->user_start[v + 1] += func->user_start[v];
+    func->users = malloc((func->user_start[n] ? func->user_start[n] : 1) * sizeof(SsaValueId));
+    uint32_t *fill = malloc((n ? n : 1) * sizeof(uint32_t));
+    assert(func->users && fill);
+    memcpy(fill, func->user_start, n * sizeof(uint32_t));
+    for (uint32_t i = 0; i < func->inst_count; i++) {
+        SsaValueId inst = func->insts[i];
+        const SsaValueId *ops = ssa_operands(func, inst);
+        for (uint32_t k = 0; k < func->values[inst].operand_count; k++) func->users[fill[ops[k]]++] = inst;
+    }
+    free(fill);
+}
+
+int ssa_successors(const SsaFunction *func, SsaValueId term, uint32_t succs[2]) {
+    const SsaValue *value = &func->values[term];
+    switch (value->op) {
+        case SSA_BR:
+            succs[0] = (uint32_t)value->imm;
+            succs[1] = value->aux;
+            return 2;
+        case SSA_JUMP:
+            succs[0] = (uint32_t)value->imm;
+            return 1;
+        default:
+            return 0;
+    }
+}
+
+// ========================================
+// 导出为 Koopa IR 文本
+// ========================================
+
+static void emit_operand(FILE *out, const SsaFunction *func, const uint32_t *temps, SsaValueId id) {
+    const SsaValue *value = &func->values[id];
+    if (value->op == SSA_CONST) fprintf(out, "%d", value->imm);
+    else if (value->op == SSA_PARAM) fputs(func->param_names[value->imm], out);
+    else fprintf(out, "%%%u", temps[id]);
+}
+
+// 输出 ops[0 .. count)，以逗号分隔
+static void emit_operand_list(FILE *out, const SsaFunction *func, const uint32_t *temps, const SsaValueId *ops,
+                              uint32_t count) {
+    for (uint32_t i = 0; i < count; i++) {
+        if (i > 0) fputs(", ", out);
+        emit_operand(out, func, temps, ops[i]);
+    }
+}
+
+// 跳转目标，有实参时带上实参列表
+static void emit_target(FILE *out, const SsaFunction *func, const uint32_t *temps, uint32_t block,
+                        const SsaValueId *args) {
+    const SsaBlock *target = &func->blocks[block];
+    fputs(target->name, out);
+    if (target->param_count == 0) return;
+    fputc('(', out);
+    emit_operand_list(out, func, temps, args, target->param_count);
+    fputc(')', out);
+}
+
+static void emit_inst(FILE *out, const SsaProgram *prog, const SsaFunction *func, const uint32_t *temps,
+                      SsaValueId id) {
+    const SsaValue *value = &func->values[id];
+    const SsaValueId *ops = ssa_operands(func, id);
+    fputs("  ", out);
+    if (value->has_result) fprintf(out, "%%%u = ", temps[id]);
+    if (ssa_is_binary(value)) {
+        fprintf(out, "%s ", op_names[value->op]);
+        emit_operand_list(out, func, temps, ops, 2);
+    } else if (value->op == SSA_CALL) {
+        fprintf(out, "call @%s(", prog->funcs[value->imm].name);
+        emit_operand_list(out, func, temps, ops, value->operand_count);
+        fputc(')', out);
+    } else if (value->op == SSA_RET) {
+        fputs("ret", out);
+        if (value->operand_count) {
+            fputc(' ', out);
+            emit_operand(out, func, temps, ops[0]);
+        }
+    } else if (value->op == SSA_BR) {
+        fputs("br ", out);
+        emit_operand(out, func, temps, ops[0]);
+        fputs(", ", out);
+        emit_target(out, func, temps, (uint32_t)value->imm, ops + 1);
+        fputs(", ", out);
+        emit_target(out, func, temps, value->aux, ops + 1 + func->blocks[value->imm].param_count);
+    } else if (value->op == SSA_JUMP) {
+        fputs("jump ", out);
+        emit_target(out, func, temps, (uint32_t)value->imm, ops);
+    }
+    fputc('\n', out);
+}
+
+static void emit_function(FILE *out, const SsaProgram *prog, const SsaFunction *func) {
+    const char *ret_type = func->returns_value ? ": i32" : "";
+    if (func->block_count == 0) {
+        fprintf(out, "decl @%s(", func->name);
+        for (uint32_t i = 0; i < func->param_count; i++) fputs(i ? ", i32" : "i32", out);
+        fprintf(out, ")%s\n", ret_type);
+        return;
+    }
+
+    // 块参数与有结果的指令按出现顺序编号为 %0, %1, ...
+    uint32_t *temps = malloc((func->value_count ? func->value_count : 1) * sizeof(uint32_t));
+    assert(temps);
+    uint32_t next = 0;
+    for (uint32_t b = 0; b < func->block_count; b++) {
+        const SsaBlock *block = &func->blocks[b];
+        for (uint32_t i = 0; i < block->param_count; i++) temps[block->param_start + i] = next++;
+        for (uint32_t i = 0; i < block->inst_count; i++) {
+            SsaValueId id = ssa_block_inst(func, b, i);
+            if (func->values[id].has_result) temps[id] = next++;
+        }
+    }
+
+    fprintf(out, "fun @%s(", func->name);
+    for (uint32_t i = 0; i < func->param_count; i++) fprintf(out, "%s%s: i32", i ? ", " : "", func->param_names[i]);
+    fprintf(out, ")%s {\n", ret_type);
+    for (uint32_t b = 0; b < func->block_count; b++) {
+        const SsaBlock *block = &func->blocks[b];
+        fputs(block->name, out);
+        if (block->param_count > 0) {
+            fputc('(', out);
+            for (uint32_t i = 0; i < block->param_count; i++) {
+                fprintf(out, "%s%%%u: i32", i ? ", " : "", temps[block->param_start + i]);
+            }
+            fputc(')', out);
+        }
+        fputs(":\n", out);
+        for (uint32_t i = 0; i < block->inst_count; i++) emit_inst(out, prog, func, temps, ssa_block_inst(func, b, i));
+    }
+    fputs("}\n", out);
+    free(temps);
+}
+
+void ssa_emit_koopa(FILE *output, const SsaProgram *prog) {
+    for (uint32_t i = 0; i < prog->func_count; i++) emit_function(output, prog, &prog->funcs[i]);
+}
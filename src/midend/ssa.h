@@ -0,0 +1,147 @@
+#pragma once
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include "koopa.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * 紧凑的 SSA IR，后端的工作表示
+ * 由 libkoopa 的 raw program 导入，也可以导出为 Koopa IR 文本
+ *
+ * 一个函数的所有值（常量、参数、块参数与指令）存放在同一个数组中，以 32 位编号互相引用：
+ *   编号 0 ~ param_count-1 为函数参数，同一函数中相同的整数常量只有一个值
+ *   指令的操作数、各基本块的指令序列、值的使用者（按需建立）分别是 operands、insts、users 数组中连续的一段
+ * 指令可以就地改写运算与操作数；删除的指令改为 SSA_NOP，由 ssa_compact 移出所在的块
+ */
+
+typedef uint32_t SsaValueId;
+#define SSA_NONE UINT32_MAX
+
+typedef enum {
+    // 二元运算，与 Koopa 的二元运算一一对应
+    SSA_NE, SSA_EQ, SSA_GT, SSA_LT, SSA_GE, SSA_LE,
+    SSA_ADD, SSA_SUB, SSA_MUL, SSA_DIV, SSA_MOD,
+    SSA_AND, SSA_OR, SSA_XOR, SSA_SHL, SSA_SHR, SSA_SAR,
+    SSA_CONST,          // 整数常量，值为 imm
+    SSA_PARAM,          // 函数参数，imm 为下标
+    SSA_BLOCK_PARAM,    // 基本块参数，imm 为块下标，aux 为参数下标
+    SSA_CALL,           // 调用 imm 号函数，操作数为实参
+    SSA_RET,            // 返回，操作数为返回值，可以没有
+    SSA_BR,             // 条件为真跳到 imm 号块，否则跳到 aux 号块；操作数为条件、真分支实参、假分支实参
+    SSA_JUMP,           // 跳到 imm 号块，操作数为实参
+    SSA_NOP,            // 已删除的指令
+    SSA_OP_COUNT
+} SsaOp;
+
+#define SSA_BINARY_COUNT (SSA_SAR + 1)
+
+// 一个值，16 字节
+typedef struct {
+    uint8_t op;                 // SsaOp
+    uint8_t has_result;         // 产生可被引用的结果
+    uint16_t operand_count;
+    uint32_t operand_start;     // 操作数在 SsaFunction.operands 中的起始下标
+    int32_t imm;
+    uint32_t aux;
+} SsaValue;
+
+typedef struct {
+    char *name;                 // 块标号，含 % 前缀
+    uint32_t inst_start;        // 指令在 SsaFunction.insts 中的起始下标
+    uint32_t inst_count;
+    SsaValueId param_start;     // 块参数为连续编号的值
+    uint32_t param_count;
+} SsaBlock;
+
+typedef struct {
+    char *name;                 // 函数名，不含 @ 前缀
+    bool returns_value;         // 返回 i32，否则返回 unit
+    uint32_t param_count;
+    char **param_names;         // 参数名，含 @ 或 % 前缀；函数声明为 NULL
+
+    SsaValue *values;
+    uint32_t value_count;
+    uint32_t value_cap;
+
+    SsaValueId *operands;
+    uint32_t operand_count;
+    uint32_t operand_cap;
+
+    SsaValueId *insts;          // 各块的指令依次排列
+    uint32_t inst_count;
+    uint32_t inst_cap;
+
+    SsaBlock *blocks;           // 函数声明没有基本块
+    uint32_t block_count;
+
+    // 使用者：值 v 的使用者为 users[user_start[v] .. user_start[v + 1])，同一指令使用多次时出现多次
+    // 导入时不建立，由需要的遍调用 ssa_build_users；改写指令后须重新建立
+    uint32_t *user_start;
+    SsaValueId *users;
+
+    // 整数常量 → 值的开放寻址哈希表，供 ssa_const 去重
+    SsaValueId *const_table;
+    uint32_t const_cap;
+    uint32_t const_count;
+} SsaFunction;
+
+typedef struct {
+    SsaFunction *funcs;
+    uint32_t func_count;
+} SsaProgram;
+
+/**
+ * 由 raw program 导入，函数与基本块保持原顺序
+ * 目前只支持后端能生成代码的值：整数常量、参数、二元运算、调用、返回与控制流
+ * @return 成功返回 0；遇到不支持的值时在 stderr 报告并返回 -1
+ */
+int ssa_import_koopa(SsaProgram *prog, koopa_raw_program_t raw);
+
+void ssa_program_free(SsaProgram *prog);
+
+// 以 Koopa IR 文本输出，临时变量按定义顺序重新编号
+void ssa_emit_koopa(FILE *output, const SsaProgram *prog);
+
+// 值的操作数
+static inline const SsaValueId *ssa_operands(const SsaFunction *func, SsaValueId value) {
+    return func->operands + func->values[value].operand_start;
+}
+
+// 块 block 的第 index 条指令
+static inline SsaValueId ssa_block_inst(const SsaFunction *func, uint32_t block, uint32_t index) {
+    return func->insts[func->blocks[block].inst_start + index];
+}
+
+static inline bool ssa_is_binary(const SsaValue *value) {
+    return value->op < SSA_BINARY_COUNT;
+}
+
+// 新建整数常量（已存在相同的常量时返回它）
+SsaValueId ssa_const(SsaFunction *func, int32_t value);
+
+/**
+ * 就地改写指令的运算与操作数
+ * 操作数个数不超过原有个数时原地覆盖，否则追加到 operands 末尾
+ */
+void ssa_rewrite(SsaFunction *func, SsaValueId inst, SsaOp op, const SsaValueId *operands, uint32_t count);
+
+// 删除指令（改为 SSA_NOP），其结果须已没有使用者
+void ssa_remove(SsaFunction *func, SsaValueId inst);
+
+// 把块中的 SSA_NOP 移出指令序列
+void ssa_compact(SsaFunction *func);
+
+// 建立使用者列表
+void ssa_build_users(SsaFunction *func);
+
+// 终结指令的后继块，返回个数
+int ssa_successors(const SsaFunction *func, SsaValueId term, uint32_t succs[2]);
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,147 @@
+#include "ssa_check.h"
+#include "dataflow.h"
+#include "koopa_ir.h"
+#include "ssa.h"
+#include <stdbool.h>
+#include <stdlib.h>
+#include <string.h>
+
+/* ---------------------------- 用例 ---------------------------- */
+
+// 死代码删除：无人使用的运算链整条删除，调用与被 ret 使用的运算保留
+static const char dce_input[] =
+    "decl @g(i32): i32\n"
+    "fun @main(@x: i32): i32 {\n"
+    "%entry:\n"
+    "  %0 = mul @x, 3\n"
+    "  %1 = div @x, 5\n"
+    "  %2 = add %1, %1\n"
+    "  %3 = sub %2, 4\n"
+    "  %4 = call @g(%0)\n"
+    "  %5 = add %4, 1\n"
+    "  ret %0\n"
+    "}\n";
+
+static const char dce_expected[] =
+    "decl @g(i32): i32\n"
+    "fun @main(@x: i32): i32 {\n"
+    "%entry:\n"
+    "  %0 = mul @x, 3\n"
+    "  %1 = call @g(%0)\n"
+    "  ret %0\n"
+    "}\n";
+
+// 改写：mul %0, 2 改为 sub @b, 7，add 因此无人使用而删除；调用改为三个实参（追加操作数）
+static const char rewrite_input[] =
+    "decl @g(i32, i32, i32): i32\n"
+    "fun @f(@a: i32, @b: i32): i32 {\n"
+    "%entry:\n"
+    "  %0 = add @a, @b\n"
+    "  %1 = mul %0, 2\n"
+    "  %2 = call @g(%1, %1, %1)\n"
+    "  ret %2\n"
+    "}\n";
+
+static const char rewrite_expected[] =
+    "decl @g(i32, i32, i32): i32\n"
+    "fun @f(@a: i32, @b: i32): i32 {\n"
+    "%entry:\n"
+    "  %0 = sub @b, 7\n"
+    "  %1 = call @g(%0, @a, 7)\n"
+    "  ret %1\n"
+    "}\n";
+
+/* ---------------------------- 检查 ---------------------------- */
+
+static int import_text(const char *text, SsaProgram *prog) {
+    koopa_raw_program_builder_t builder;
+    koopa_raw_program_t raw;
+    if (parse_ir_from_string(text, &builder, &raw) != 0) return -1;
+    int ret = ssa_import_koopa(prog, raw);
+    koopa_delete_raw_program_builder(builder);
+    return ret;
+}
+
+static uint32_t user_count(const SsaFunction *func, SsaValueId value) {
+    return func->user_start[value + 1] - func->user_start[value];
+}
+
+static SsaFunction *find_function(SsaProgram *prog, const char *name) {
+    for (uint32_t i = 0; i < prog->func_count; i++) {
+        if (strcmp(prog->funcs[i].name, name) == 0) return &prog->funcs[i];
+    }
+    return NULL;
+}
+
+static bool edit_dce(SsaProgram *prog) {
+    SsaFunction *func = find_function(prog, "main");
+    return func && dataflow_eliminate_dead(func) == 4;
+}
+
+static bool edit_rewrite(SsaProgram *prog) {
+    SsaFunction *func = find_function(prog, "f");
+    if (!func || func->block_count != 1 || func->blocks[0].inst_count != 4) return false;
+    SsaValueId add = ssa_block_inst(func, 0, 0);
+    SsaValueId mul = ssa_block_inst(func, 0, 1);
+    SsaValueId call = ssa_block_inst(func, 0, 2);
+
+    ssa_build_users(func);
+    if (user_count(func, add) != 1 || user_count(func, mul) != 3) return false;
+
+    SsaValueId seven = ssa_const(func, 7);
+    if (ssa_const(func, 7) != seven) return false;
+    const SsaValueId *add_ops = ssa_operands(func, add);
+    SsaValueId a = add_ops[0], b = add_ops[1];
+    SsaValueId sub_ops[2] = {b, seven};
+    ssa_rewrite(func, mul, SSA_SUB, sub_ops, 2);
+    SsaValueId call_ops[3] = {mul, a, seven};
+    ssa_rewrite(func, call, SSA_CALL, call_ops, 3);
+
+    ssa_build_users(func);
+    if (user_count(func, add) != 0 || user_count(func, mul) != 1 || user_count(func, seven) != 2) return false;
+    ssa_remove(func, add);
+    ssa_compact(func);
+    ssa_build_users(func);
+    return func->blocks[0].inst_count == 3 && user_count(func, b) == 1;
+}
+
+typedef struct {
+    const char *name;
+    const char *input;
+    const char *expected;
+    bool (*edit)(SsaProgram *prog);
+} Case;
+
+static const Case cases[] = {
+    {"dce", dce_input, dce_expected, edit_dce},
+    {"rewrite", rewrite_input, rewrite_expected, edit_rewrite},
+};
+
+int ssa_self_check(FILE *report) {
+    int failures = 0;
+    for (size_t i = 0; i < sizeof(cases) / sizeof(cases[0]); i++) {
+        SsaProgram prog;
+        if (import_text(cases[i].input, &prog) != 0) {
+            fprintf(report, "%-10s import failed  FAILED\n", cases[i].name);
+            failures++;
+            continue;
+        }
+        bool edited = cases[i].edit(&prog);
+
+        char *text = NULL;
+        size_t size = 0;
+        FILE *stream = open_memstream(&text, &size);
+        ssa_emit_koopa(stream, &prog);
+        fclose(stream);
+        bool same = strcmp(text, cases[i].expected) == 0;
+
+        bool ok = edited && same;
+        failures += !ok;
+        fprintf(report, "%-10s edit %s, text %s%s\n", cases[i].name, edited ? "ok" : "mismatch",
+                same ? "matches" : "differs", ok ? "" : "  FAILED");
+        if (!same) fputs(text, report);
+        free(text);
+        ssa_program_free(&prog);
+    }
+    return failures;
+}
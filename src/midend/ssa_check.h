@@ -0,0 +1,20 @@
+#pragma once
+
+#include <stdio.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * SSA 编辑接口的自检
+ * 由固定的 Koopa IR 文本导入，经死代码删除或手工改写（ssa_rewrite / ssa_remove / ssa_compact）后
+ * 重新导出，与预期的文本逐字比较，并检查删除数与使用者列表
+ * @param report 每个用例一行结果，失败时附上实际导出的文本
+ * @return 失败的用例数，0 表示全部通过
+ */
+int ssa_self_check(FILE *report);
+
+#ifdef __cplusplus
+}
+#endif
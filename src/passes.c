@@ -0,0 +1,61 @@
+#include "passes.h"
+#include <string.h>
+#include "diag.h"
+
+// 遍表，按执行顺序排列
+static const PassInfo passes[PASS_COUNT] = {
+    [PASS_SIMPLIFY] = {"simplify", PASS_STAGE_AST,   1, "rule-table algebraic simplification of expressions"},
+    [PASS_INLINE]   = {"inline",   PASS_STAGE_AST,   2, "inline small non-recursive callees"},
+    [PASS_ORDER]    = {"order",    PASS_STAGE_AST,   1, "evaluate the operand needing more temporaries first"},
+    [PASS_DCE]      = {"dce",      PASS_STAGE_RISCV, 1, "skip operations whose results are never used"},
+    [PASS_FOLD]     = {"fold",     PASS_STAGE_RISCV, 1, "fold single-use operations into immediate forms"},
+    [PASS_SUPEROPT] = {"superopt", PASS_STAGE_RISCV, 1, "lower constant-operand operations with superoptimized sequences"},
+    [PASS_SCHED]    = {"sched",    PASS_STAGE_RISCV, 2, "list scheduling within basic blocks"},
+};
+
+static const char *const stage_names[] = {"ast", "koopa", "riscv"};
+
+const PassInfo *pass_info(PassId pass) {
+    return &passes[pass];
+}
+
+int pass_lookup(const char *name) {
+    for (int i = 0; i < PASS_COUNT; i++) {
+        if (strcmp(passes[i].name, name) == 0) return i;
+    }
+    return -1;
+}
+
+void pass_pipeline_init(PassPipeline *pipeline, int level) {
+    if (level < 0) level = 0;
+    if (level > PASS_MAX_LEVEL) level = PASS_MAX_LEVEL;
+    pipeline->level = level;
+    for (int i = 0; i < PASS_COUNT; i++) pipeline->enabled[i] = passes[i].level <= level;
+}
+
+int pass_pipeline_set(PassPipeline *pipeline, const char *names, bool enable) {
+    const char *p = names;
+    for (;;) {
+        const char *end = strchr(p, ',');
+        size_t len = end ? (size_t)(end - p) : strlen(p);
+        int found = -1;
+        for (int i = 0; i < PASS_COUNT && found < 0; i++) {
+            if (strlen(passes[i].name) == len && strncmp(passes[i].name, p, len) == 0) found = i;
+        }
+        if (found < 0) {
+            fprintf(diag_err(), "Unknown pass: %.*s\n", (int)len, p);
+            return -1;
+        }
+        pipeline->enabled[found] = enable;
+        if (!end) return 0;
+        p = end + 1;
+    }
+}
+
+void pass_pipeline_list(FILE *out, const PassPipeline *pipeline) {
+    fprintf(out, "%-10s %-6s %-6s %-8s %s\n", "pass", "stage", "level", "enabled", "description");
+    for (int i = 0; i < PASS_COUNT; i++) {
+        fprintf(out, "%-10s %-6s -O%-4d %-8s %s\n", passes[i].name, stage_names[passes[i].stage], passes[i].level,
+                pipeline->enabled[i] ? "yes" : "no", passes[i].description);
+    }
+}
@@ -0,0 +1,71 @@
+#pragma once
+
+#include <stdbool.h>
+#include <stdio.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * 优化流水线
+ * 各优化遍按所在阶段（AST、Koopa IR、RISC-V）登记在遍表中，并注明自哪个优化级别起默认启用：
+ *   -O0  不做优化，编译最快
+ *   -O1  加入代价低的局部清理：代数化简、求值顺序、死代码删除、指令选择时吸收子运算与查超优化表
+ *   -O2  全部优化，另加内联与指令调度（默认）
+ * 选定级别后还可逐个启用或禁用
+ */
+
+typedef enum {
+    PASS_SIMPLIFY,      // AST：代数化简
+    PASS_INLINE,        // AST：内联
+    PASS_ORDER,         // AST：按 Sethi–Ullman 标号先求值需要临时变量较多的一侧
+    PASS_DCE,           // RISC-V：生成汇编时跳过结果无人使用的运算，输出的 Koopa IR 不变
+    PASS_FOLD,          // RISC-V：指令选择时把单次使用的子运算并入使用者的立即数形式
+    PASS_SUPEROPT,      // RISC-V：常量右操作数的运算改用超优化表中更短的指令序列
+    PASS_SCHED,         // RISC-V：基本块内指令调度
+    PASS_COUNT
+} PassId;
+
+typedef enum {
+    PASS_STAGE_AST,
+    PASS_STAGE_KOOPA,
+    PASS_STAGE_RISCV,
+} PassStage;
+
+typedef struct {
+    const char *name;
+    PassStage stage;
+    int level;              // 自此优化级别起默认启用
+    const char *description;
+} PassInfo;
+
+#define PASS_MAX_LEVEL 2
+#define PASS_DEFAULT_LEVEL 2
+
+// 各遍是否启用
+typedef struct {
+    int level;
+    bool enabled[PASS_COUNT];
+} PassPipeline;
+
+const PassInfo *pass_info(PassId pass);
+
+// 按名字查找遍，不存在返回 -1
+int pass_lookup(const char *name);
+
+// 按优化级别初始化，level 超出范围时取最近的级别
+void pass_pipeline_init(PassPipeline *pipeline, int level);
+
+/**
+ * 启用或禁用以逗号分隔的若干遍
+ * @return 成功返回 0，有未知的遍名时报错并返回 -1
+ */
+int pass_pipeline_set(PassPipeline *pipeline, const char *names, bool enable);
+
+// 按阶段列出所有遍，标明默认级别与在当前流水线中是否启用
+void pass_pipeline_list(FILE *out, const PassPipeline *pipeline);
+
+#ifdef __cplusplus
+}
+#endif
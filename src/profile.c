@@ -0,0 +1,159 @@
+#include "profile.h"
+#include <assert.h>
+#include <inttypes.h>
+#include <stdlib.h>
+#include <string.h>
+#include "diag.h"
+
+static uint32_t read_le32(const unsigned char *p) {
+    return (uint32_t)p[0] | (uint32_t)p[1] << 8 | (uint32_t)p[2] << 16 | (uint32_t)p[3] << 24;
+}
+
+static char *copy_string(const char *s, size_t len) {
+    char *copy = malloc(len + 1);
+    assert(copy);
+    memcpy(copy, s, len);
+    copy[len] = '\0';
+    return copy;
+}
+
+static void profile_init(Profile *profile) {
+    profile->counters = NULL;
+    profile->counter_count = 0;
+    profile->functions = NULL;
+    profile->function_count = 0;
+    profile->hot_count = 0;
+}
+
+// 由 "block <函数> <块标号>" 计数器得到各函数的进入次数：每个函数的第一个块计数器为入口块
+static void collect_functions(Profile *profile) {
+    profile->functions = malloc((profile->counter_count ? profile->counter_count : 1) * sizeof(ProfileFunction));
+    assert(profile->functions);
+    for (int i = 0; i < profile->counter_count; i++) {
+        const char *name = profile->counters[i].name;
+        if (strncmp(name, "block ", 6) != 0) continue;
+        const char *func = name + 6;
+        const char *end = strchr(func, ' ');
+        size_t len = end ? (size_t)(end - func) : strlen(func);
+        bool seen = false;
+        for (int j = 0; j < profile->function_count && !seen; j++) {
+            seen = strlen(profile->functions[j].name) == len && strncmp(profile->functions[j].name, func, len) == 0;
+        }
+        if (seen) continue;
+        ProfileFunction *f = &profile->functions[profile->function_count++];
+        f->name = copy_string(func, len);
+        f->entries = profile->counters[i].count;
+    }
+}
+
+static int compare_desc(const void *a, const void *b) {
+    uint64_t x = *(const uint64_t *)a, y = *(const uint64_t *)b;
+    return (x < y) - (x > y);
+}
+
+// 热度阈值：按进入次数从高到低累加，达到总数的 PROFILE_HOT_PERCENT 时的那个函数的进入次数
+static void compute_hot_count(Profile *profile) {
+    int n = profile->function_count;
+    uint64_t *entries = malloc((n ? n : 1) * sizeof(uint64_t));
+    assert(entries);
+    uint64_t total = 0;
+    for (int i = 0; i < n; i++) {
+        entries[i] = profile->functions[i].entries;
+        total += entries[i];
+    }
+    qsort(entries, n, sizeof(uint64_t), compare_desc);
+    profile->hot_count = UINT64_MAX;
+    uint64_t covered = 0;
+    for (int i = 0; i < n && entries[i] > 0; i++) {
+        covered += entries[i];
+        profile->hot_count = entries[i];
+        if (covered * 100 >= total * PROFILE_HOT_PERCENT) break;
+    }
+    free(entries);
+}
+
+int profile_load(Profile *profile, const char *path) {
+    profile_init(profile);
+    FILE *f = fopen(path, "rb");
+    if (!f) {
+        fprintf(diag_err(), "Failed to open profile: %s\n", path);
+        return -1;
+    }
+    unsigned char *data = NULL;
+    size_t size = 0, cap = 0, n;
+    do {
+        if (size == cap) {
+            cap = cap ? cap * 2 : 4096;
+            data = realloc(data, cap);
+            assert(data);
+        }
+        n = fread(data + size, 1, cap - size, f);
+        size += n;
+    } while (n > 0);
+    fclose(f);
+
+    const size_t header = PROFILE_HEADER_WORDS * 4;
+    uint32_t count = size >= header ? read_le32(data + 8) : 0;
+    uint32_t names_size = size >= header ? read_le32(data + 12) : 0;
+    bool valid = size >= header && read_le32(data) == PROFILE_MAGIC && read_le32(data + 4) == PROFILE_VERSION &&
+                 count <= (size - header) / 4 && size - header - (size_t)count * 4 == names_size;
+
+    const char *names = (const char *)data + header + (size_t)count * 4;
+    const char *names_end = names + names_size;
+    if (valid) {
+        profile->counters = malloc((count ? count : 1) * sizeof(ProfileCounter));
+        assert(profile->counters);
+    }
+    const char *p = names;
+    for (uint32_t i = 0; valid && i < count; i++) {
+        const char *end = memchr(p, '\0', names_end - p);
+        if (!end) {
+            valid = false;
+            break;
+        }
+        ProfileCounter *counter = &profile->counters[profile->counter_count++];
+        counter->name = copy_string(p, end - p);
+        counter->count = read_le32(data + header + i * 4);
+        p = end + 1;
+    }
+    free(data);
+    if (!valid) {
+        fprintf(diag_err(), "Invalid profile: %s\n", path);
+        profile_free(profile);
+        return -1;
+    }
+
+    collect_functions(profile);
+    compute_hot_count(profile);
+    return 0;
+}
+
+void profile_free(Profile *profile) {
+    for (int i = 0; i < profile->counter_count; i++) free(profile->counters[i].name);
+    for (int i = 0; i < profile->function_count; i++) free(profile->functions[i].name);
+    free(profile->counters);
+    free(profile->functions);
+    profile_init(profile);
+}
+
+const ProfileFunction *profile_find_function(const Profile *profile, const char *name) {
+    for (int i = 0; i < profile->function_count; i++) {
+        if (strcmp(profile->functions[i].name, name) == 0) return &profile->functions[i];
+    }
+    return NULL;
+}
+
+bool profile_is_hot(const Profile *profile, uint64_t entries) {
+    return entries > 0 && entries >= profile->hot_count;
+}
+
+void profile_dump(FILE *out, const Profile *profile) {
+    for (int i = 0; i < profile->counter_count; i++) {
+        fprintf(out, "%12" PRIu64 "  %s\n", profile->counters[i].count, profile->counters[i].name);
+    }
+    fprintf(out, "\n%-24s %12s  %s\n", "function", "entries", "hot");
+    for (int i = 0; i < profile->function_count; i++) {
+        const ProfileFunction *f = &profile->functions[i];
+        fprintf(out, "%-24s %12" PRIu64 "  %s\n", f->name, f->entries, profile_is_hot(profile, f->entries) ? "yes" : "no");
+    }
+}
@@ -0,0 +1,68 @@
+#pragma once
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * 剖析数据
+ * 以 -profile-gen 生成的程序在每个基本块入口与每个调用点前累加一个 32 位计数器，
+ * main 返回前把计数器连同其名字写入文件，-profile-use 读入后用于内联与函数布局
+ *
+ * 文件为小端序，依次为：
+ *   4 个 32 位字的头部：PROFILE_MAGIC、PROFILE_VERSION、计数器个数 n、名字区字节数
+ *   n 个 32 位计数器
+ *   n 个以 NUL 结尾的名字：
+ *     "block <函数> <块标号>"            基本块的执行次数，每个函数的第一个为入口块，即函数的进入次数
+ *     "call <调用者> <块标号> <序号> <被调用者>"  调用点的执行次数（调用边），序号为调用点在块中的次序
+ */
+
+#define PROFILE_MAGIC 0x464f5250u   // "PROF"
+#define PROFILE_VERSION 1
+#define PROFILE_HEADER_WORDS 4
+
+// 热函数的进入次数合计至少占全部函数进入次数的百分比
+#define PROFILE_HOT_PERCENT 99
+
+typedef struct {
+    char *name;
+    uint64_t count;
+} ProfileCounter;
+
+typedef struct {
+    char *name;
+    uint64_t entries;           // 入口块的执行次数
+} ProfileFunction;
+
+typedef struct {
+    ProfileCounter *counters;   // 按文件中的顺序
+    int counter_count;
+    ProfileFunction *functions; // 按首次出现的顺序
+    int function_count;
+    uint64_t hot_count;         // 进入次数不低于此值（且非零）的函数为热函数
+} Profile;
+
+/**
+ * 读入剖析数据文件
+ * @return 成功返回 0；文件不存在或格式不符时在 stderr 报告并返回 -1
+ */
+int profile_load(Profile *profile, const char *path);
+
+void profile_free(Profile *profile);
+
+// 按名字查找函数，不在剖析数据中（如剖析时已内联到所有调用点）返回 NULL
+const ProfileFunction *profile_find_function(const Profile *profile, const char *name);
+
+// 进入次数为 entries 的函数是否为热函数
+bool profile_is_hot(const Profile *profile, uint64_t entries);
+
+// 以文本输出所有计数器及各函数的进入次数
+void profile_dump(FILE *out, const Profile *profile);
+
+#ifdef __cplusplus
+}
+#endif
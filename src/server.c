@@ -0,0 +1,280 @@
+#include "server.h"
+#include <errno.h>
+#include <pthread.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+// 单个请求的参数个数与字段长度上限，防止异常请求导致巨大的分配
+#define MAX_REQUEST_ARGS 256
+#define MAX_FIELD_LEN (256u << 20)
+
+// ========================================
+// 报文读写
+// ========================================
+
+static int write_all(int fd, const void *buf, size_t len) {
+    const char *p = buf;
+    while (len > 0) {
+        // 对端已关闭时返回错误而不是触发 SIGPIPE
+        ssize_t n = send(fd, p, len, MSG_NOSIGNAL);
+        if (n < 0 && errno == EINTR) continue;
+        if (n <= 0) return -1;
+        p += n;
+        len -= (size_t)n;
+    }
+    return 0;
+}
+
+static int read_all(int fd, void *buf, size_t len) {
+    char *p = buf;
+    while (len > 0) {
+        ssize_t n = read(fd, p, len);
+        if (n < 0 && errno == EINTR) continue;
+        if (n <= 0) return -1;
+        p += n;
+        len -= (size_t)n;
+    }
+    return 0;
+}
+
+static int write_u32(int fd, uint32_t value) {
+    return write_all(fd, &value, sizeof(value));
+}
+
+static int read_u32(int fd, uint32_t *value) {
+    return read_all(fd, value, sizeof(*value));
+}
+
+static int write_field(int fd, const char *data, size_t len) {
+    if (len > MAX_FIELD_LEN || write_u32(fd, (uint32_t)len) != 0) return -1;
+    return write_all(fd, data, len);
+}
+
+// 读取一个字段，结果以 '\0' 结尾
+static char *read_field(int fd, uint32_t *len) {
+    if (read_u32(fd, len) != 0 || *len > MAX_FIELD_LEN) return NULL;
+    char *data = malloc((size_t)*len + 1);
+    if (!data) return NULL;
+    if (read_all(fd, data, *len) != 0) {
+        free(data);
+        return NULL;
+    }
+    data[*len] = '\0';
+    return data;
+}
+
+static void request_free(CompileRequest *request) {
+    for (int i = 0; i < request->argc; i++) free(request->argv[i]);
+    free(request->argv);
+    free(request->source);
+    memset(request, 0, sizeof(*request));
+}
+
+/**
+ * 读取一个请求
+ * @return 'C'（request 已填写，由调用者释放）、'Q'，连接关闭或报文错误时返回 0
+ */
+static int read_request(int fd, CompileRequest *request) {
+    memset(request, 0, sizeof(*request));
+    uint8_t type;
+    if (read_all(fd, &type, 1) != 0) return 0;
+    if (type == 'Q') return 'Q';
+    if (type != 'C') return 0;
+
+    uint32_t argc, len;
+    if (read_u32(fd, &argc) != 0 || argc > MAX_REQUEST_ARGS) return 0;
+    request->argv = calloc(argc + 1, sizeof(char *));
+    if (!request->argv) return 0;
+    for (uint32_t i = 0; i < argc; i++) {
+        request->argv[i] = read_field(fd, &len);
+        if (!request->argv[i]) {
+            request_free(request);
+            return 0;
+        }
+        request->argc++;
+    }
+    char *source = read_field(fd, &len);
+    if (!source) {
+        request_free(request);
+        return 0;
+    }
+    if (len > 0) {
+        request->source = source;
+        request->source_len = len;
+    } else {
+        free(source);
+    }
+    return 'C';
+}
+
+// ========================================
+// 服务端
+// ========================================
+
+typedef struct {
+    int listen_fd;
+    CompileHandler handler;
+    pthread_mutex_t lock;
+    bool stopping;
+} Server;
+
+// 处理一个编译请求：输出先收集在内存中，编译结束后随退出状态整体发回，并发的请求互不交错
+static void serve_compile(Server *server, int fd, const CompileRequest *request) {
+    char *out_buf = NULL, *err_buf = NULL;
+    size_t out_len = 0, err_len = 0;
+    FILE *out = open_memstream(&out_buf, &out_len);
+    FILE *err = open_memstream(&err_buf, &err_len);
+    int32_t status = out && err ? server->handler(request, out, err) : 1;
+    if (out) fclose(out);
+    if (err) fclose(err);
+    if (write_all(fd, &status, sizeof(status)) == 0 && write_field(fd, out_buf ? out_buf : "", out_len) == 0) {
+        write_field(fd, err_buf ? err_buf : "", err_len);
+    }
+    free(out_buf);
+    free(err_buf);
+}
+
+// 处理一个连接上的请求；每个连接只处理一个请求，避免长连接占住工作线程而让其他客户端饿死
+static void serve_connection(Server *server, int fd) {
+    CompileRequest request;
+    int type = read_request(fd, &request);
+    if (type == 'C') {
+        serve_compile(server, fd, &request);
+        request_free(&request);
+    } else if (type == 'Q') {
+        pthread_mutex_lock(&server->lock);
+        server->stopping = true;
+        pthread_mutex_unlock(&server->lock);
+        // 唤醒阻塞在 accept 上的其他工作线程
+        shutdown(server->listen_fd, SHUT_RDWR);
+        int32_t status = 0;
+        write_all(fd, &status, sizeof(status));
+    }
+}
+
+// 工作线程：启动后常驻，各自在同一个监听套接字上 accept
+static void *worker_main(void *arg) {
+    Server *server = arg;
+    for (;;) {
+        int fd = accept(server->listen_fd, NULL, NULL);
+        if (fd < 0) {
+            pthread_mutex_lock(&server->lock);
+            bool stopping = server->stopping;
+            pthread_mutex_unlock(&server->lock);
+            if (stopping || (errno != EINTR && errno != ECONNABORTED)) break;
+            continue;
+        }
+        serve_connection(server, fd);
+        close(fd);
+    }
+    return NULL;
+}
+
+static int fill_address(struct sockaddr_un *addr, const char *socket_path) {
+    memset(addr, 0, sizeof(*addr));
+    addr->sun_family = AF_UNIX;
+    if (strlen(socket_path) >= sizeof(addr->sun_path)) {
+        fprintf(stderr, "Socket path too long: %s\n", socket_path);
+        return -1;
+    }
+    strcpy(addr->sun_path, socket_path);
+    return 0;
+}
+
+int server_run(const char *socket_path, int workers, CompileHandler handler) {
+    struct sockaddr_un addr;
+    if (fill_address(&addr, socket_path) != 0) return 1;
+    if (workers < 1) workers = 1;
+
+    Server server;
+    server.handler = handler;
+    server.stopping = false;
+    pthread_mutex_init(&server.lock, NULL);
+    server.listen_fd = socket(AF_UNIX, SOCK_STREAM, 0);
+    if (server.listen_fd < 0) {
+        perror("socket");
+        return 1;
+    }
+    unlink(socket_path);
+    if (bind(server.listen_fd, (struct sockaddr *)&addr, sizeof(addr)) != 0 ||
+        listen(server.listen_fd, 128) != 0) {
+        perror(socket_path);
+        close(server.listen_fd);
+        return 1;
+    }
+
+    pthread_t *threads = malloc(workers * sizeof(pthread_t));
+    int started = 0;
+    for (; threads && started < workers; started++) {
+        if (pthread_create(&threads[started], NULL, worker_main, &server) != 0) break;
+    }
+    fprintf(stderr, "compile server: listening on %s with %d worker(s)\n", socket_path, started);
+    for (int i = 0; i < started; i++) pthread_join(threads[i], NULL);
+
+    free(threads);
+    close(server.listen_fd);
+    unlink(socket_path);
+    pthread_mutex_destroy(&server.lock);
+    return started > 0 ? 0 : 1;
+}
+
+// ========================================
+// 客户端
+// ========================================
+
+int client_connect(const char *socket_path) {
+    struct sockaddr_un addr;
+    if (fill_address(&addr, socket_path) != 0) return -1;
+    int fd = socket(AF_UNIX, SOCK_STREAM, 0);
+    if (fd < 0) return -1;
+    if (connect(fd, (struct sockaddr *)&addr, sizeof(addr)) != 0) {
+        close(fd);
+        return -1;
+    }
+    return fd;
+}
+
+static int read_status(int fd, int *status) {
+    int32_t value;
+    if (read_all(fd, &value, sizeof(value)) != 0) return -1;
+    *status = value;
+    return 0;
+}
+
+// 读取一个输出字段，写入 stream（为 NULL 时丢弃）
+static int read_output(int fd, FILE *stream) {
+    uint32_t len;
+    char *data = read_field(fd, &len);
+    if (!data) return -1;
+    if (stream) {
+        fwrite(data, 1, len, stream);
+        fflush(stream);
+    }
+    free(data);
+    return 0;
+}
+
+int client_compile(int fd, const CompileRequest *request, int *status, FILE *out, FILE *err) {
+    uint8_t type = 'C';
+    if (write_all(fd, &type, 1) != 0 || write_u32(fd, (uint32_t)request->argc) != 0) return -1;
+    for (int i = 0; i < request->argc; i++) {
+        if (write_field(fd, request->argv[i], strlen(request->argv[i])) != 0) return -1;
+    }
+    const char *source = request->source ? request->source : "";
+    size_t source_len = request->source ? request->source_len : 0;
+    if (write_field(fd, source, source_len) != 0 || read_status(fd, status) != 0) return -1;
+    if (read_output(fd, out) != 0) return -1;
+    return read_output(fd, err);
+}
+
+int client_shutdown(int fd) {
+    uint8_t type = 'Q';
+    int status;
+    if (write_all(fd, &type, 1) != 0) return -1;
+    return read_status(fd, &status);
+}
@@ -0,0 +1,68 @@
+#pragma once
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdio.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * 编译服务
+ * 常驻进程在本地 Unix 域套接字上接受编译请求，由预先启动的工作线程处理，
+ * 省去每次编译时的进程启动、动态库加载与初始化开销
+ *
+ * 协议（本机字节序，只在本机使用）：
+ *   请求  u8 类型（'C' 编译，'Q' 关闭服务）
+ *         u32 参数个数，每个参数为 u32 长度 + 内容
+ *         u32 源码长度 + 内容，长度为 0 表示从参数中的输入路径读取
+ *   响应  i32 退出状态；编译请求之后还有 u32 长度 + 标准输出内容、u32 长度 + 标准错误内容
+ * 每个连接只发送一个请求
+ */
+
+#define SERVER_DEFAULT_WORKERS 4
+
+/**
+ * 一个编译请求
+ * argv 与命令行中程序名之后的部分相同：mode input -o output [options]
+ * 路径按服务进程的工作目录解析，客户端应传绝对路径
+ */
+typedef struct {
+    int argc;
+    char **argv;
+    char *source;           // 非 NULL 时以此为输入源码，忽略 argv 中的输入路径
+    size_t source_len;
+} CompileRequest;
+
+/**
+ * 处理一个请求，返回退出状态；会被多个工作线程并发调用
+ * 本次编译的标准输出与诊断信息写入 out / err（每个请求各自的内存流），随响应发回客户端
+ */
+typedef int (*CompileHandler)(const CompileRequest *request, FILE *out, FILE *err);
+
+/**
+ * 运行编译服务直到收到关闭请求
+ * @param socket_path 套接字路径，已存在的旧套接字文件会被替换
+ * @param workers 工作线程数
+ * @return 0 表示正常关闭
+ */
+int server_run(const char *socket_path, int workers, CompileHandler handler);
+
+// 连接编译服务，失败返回 -1
+int client_connect(const char *socket_path);
+
+/**
+ * 在新连接上发送一个编译请求并等待结果，之后由调用者关闭连接
+ * @param status 输出：编译的退出状态
+ * @param out, err 写入服务端编译时的标准输出与标准错误内容，为 NULL 时丢弃
+ * @return 0 表示通信成功
+ */
+int client_compile(int fd, const CompileRequest *request, int *status, FILE *out, FILE *err);
+
+// 在新连接上请求服务关闭
+int client_shutdown(int fd);
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,145 @@
+#include "stats.h"
+#include <assert.h>
+#include <stdlib.h>
+#include <string.h>
+
+static char *copy_string(const char *s) {
+    char *copy = malloc(strlen(s) + 1);
+    assert(copy);
+    return strcpy(copy, s);
+}
+
+void compile_stats_init(CompileStats *stats) {
+    stats->funcs = NULL;
+    stats->count = 0;
+    stats->cap = 0;
+}
+
+void compile_stats_free(CompileStats *stats) {
+    for (int i = 0; i < stats->count; i++) {
+        FuncStats *func = &stats->funcs[i];
+        for (int j = 0; j < func->count; j++) free(func->counters[j].key);
+        free(func->counters);
+        free(func->function);
+    }
+    free(stats->funcs);
+    compile_stats_init(stats);
+}
+
+FuncStats *compile_stats_function(CompileStats *stats, const char *function) {
+    for (int i = 0; i < stats->count; i++) {
+        if (strcmp(stats->funcs[i].function, function) == 0) return &stats->funcs[i];
+    }
+    if (stats->count == stats->cap) {
+        stats->cap = stats->cap ? stats->cap * 2 : 8;
+        stats->funcs = realloc(stats->funcs, stats->cap * sizeof(FuncStats));
+        assert(stats->funcs);
+    }
+    FuncStats *func = &stats->funcs[stats->count++];
+    func->function = copy_string(function);
+    func->generated = false;
+    func->counters = NULL;
+    func->count = 0;
+    func->cap = 0;
+    return func;
+}
+
+static StatsCounter *find_counter(FuncStats *func, const char *key) {
+    for (int i = 0; i < func->count; i++) {
+        if (strcmp(func->counters[i].key, key) == 0) return &func->counters[i];
+    }
+    if (func->count == func->cap) {
+        func->cap = func->cap ? func->cap * 2 : 16;
+        func->counters = realloc(func->counters, func->cap * sizeof(StatsCounter));
+        assert(func->counters);
+    }
+    StatsCounter *counter = &func->counters[func->count++];
+    counter->key = copy_string(key);
+    counter->value = 0;
+    return counter;
+}
+
+void func_stats_set(FuncStats *func, const char *key, long value) {
+    find_counter(func, key)->value = value;
+}
+
+void func_stats_add(FuncStats *func, const char *key, long delta) {
+    find_counter(func, key)->value += delta;
+}
+
+long func_stats_get(const FuncStats *func, const char *key) {
+    for (int i = 0; i < func->count; i++) {
+        if (strcmp(func->counters[i].key, key) == 0) return func->counters[i].value;
+    }
+    return 0;
+}
+
+// ========================================
+// JSON 输出
+// ========================================
+
+static void write_json_string(FILE *out, const char *s, size_t len) {
+    fputc('"', out);
+    for (size_t i = 0; i < len; i++) {
+        unsigned char c = (unsigned char)s[i];
+        if (c == '"' || c == '\\') fprintf(out, "\\%c", c);
+        else if (c < 0x20) fprintf(out, "\\u%04x", c);
+        else fputc(c, out);
+    }
+    fputc('"', out);
+}
+
+// 键在 prefix 之后的下一层名字的长度；没有更深的层级时返回 0
+static size_t group_length(const char *rest) {
+    const char *dot = strchr(rest, '.');
+    return dot ? (size_t)(dot - rest) : 0;
+}
+
+/**
+ * 输出以 prefix（长度 prefix_len，以 . 结尾或为空）开头的计数器组成的对象的成员
+ * @param first 输入输出：是否尚未输出任何成员
+ */
+static void write_members(FILE *out, const FuncStats *func, const char *prefix, size_t prefix_len, bool *first) {
+    // 先输出本层的计数器
+    for (int i = 0; i < func->count; i++) {
+        const char *key = func->counters[i].key;
+        if (strncmp(key, prefix, prefix_len) != 0 || group_length(key + prefix_len) != 0) continue;
+        fputs(*first ? "" : ", ", out);
+        *first = false;
+        write_json_string(out, key + prefix_len, strlen(key + prefix_len));
+        fprintf(out, ": %ld", func->counters[i].value);
+    }
+
+    // 再按首次出现的顺序输出下一层的各组
+    for (int i = 0; i < func->count; i++) {
+        const char *key = func->counters[i].key;
+        if (strncmp(key, prefix, prefix_len) != 0) continue;
+        size_t len = group_length(key + prefix_len);
+        if (len == 0) continue;
+        bool seen = false;
+        for (int j = 0; j < i && !seen; j++) {
+            seen = strncmp(func->counters[j].key, key, prefix_len + len + 1) == 0;
+        }
+        if (seen) continue;
+
+        fputs(*first ? "" : ", ", out);
+        *first = false;
+        write_json_string(out, key + prefix_len, len);
+        fputs(": {", out);
+        bool group_first = true;
+        write_members(out, func, key, prefix_len + len + 1, &group_first);
+        fputc('}', out);
+    }
+}
+
+void compile_stats_write_json(FILE *out, const CompileStats *stats) {
+    for (int i = 0; i < stats->count; i++) {
+        const FuncStats *func = &stats->funcs[i];
+        if (!func->generated) continue;
+        fputs("{\"function\": ", out);
+        write_json_string(out, func->function, strlen(func->function));
+        bool first = false;
+        write_members(out, func, "", 0, &first);
+        fputs("}\n", out);
+    }
+}
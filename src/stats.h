@@ -0,0 +1,57 @@
+#pragma once
+
+#include <stdbool.h>
+#include <stdio.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * 代码质量统计
+ * 编译各阶段按函数记录计数器，最后以 JSON 输出，每个函数一行（JSON Lines），便于跨版本、跨语料比较
+ * 计数器名以 . 分隔层级，如 "machine_insts.alu"、"passes.simplify.add-zero"，输出时展开为嵌套对象
+ */
+
+typedef struct {
+    char *key;
+    long value;
+} StatsCounter;
+
+// 一个函数的统计，计数器按首次记录的顺序保存
+typedef struct {
+    char *function;
+    bool generated;             // 函数体出现在生成的 Koopa IR 中；只输出生成了的函数
+    StatsCounter *counters;
+    int count;
+    int cap;
+} FuncStats;
+
+typedef struct {
+    FuncStats *funcs;           // 按首次记录的顺序
+    int count;
+    int cap;
+} CompileStats;
+
+void compile_stats_init(CompileStats *stats);
+void compile_stats_free(CompileStats *stats);
+
+// 查找函数的统计，不存在时新建
+FuncStats *compile_stats_function(CompileStats *stats, const char *function);
+
+// 设置 / 累加计数器，不存在时新建
+void func_stats_set(FuncStats *func, const char *key, long value);
+void func_stats_add(FuncStats *func, const char *key, long delta);
+
+// 读取计数器，不存在时返回 0
+long func_stats_get(const FuncStats *func, const char *key);
+
+/**
+ * 输出生成了的函数的统计，每个函数一个 JSON 对象占一行
+ * 对象中先输出 "function" 与不分层的计数器，再按首次出现的顺序输出各层级
+ */
+void compile_stats_write_json(FILE *out, const CompileStats *stats);
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,606 @@
+// 超优化器：为常量右操作数的二元运算 x op k（mul / div / mod 与各比较）穷举搜索最短的 RV32IM 指令序列，
+// 生成后端指令选择查用的表 src/backend/riscv_superopt_table.h
+//
+// 搜索空间：长度不超过 SUPEROPT_MAX_LENGTH 的序列，寄存器只有 x、一个临时寄存器、结果与 x0，
+// 立即数取自由 k 导出的候选值（k、k ± 1、-k、-k ± 1、其低 12 位、lui 的高 20 位等）与全部移位量；
+// 对每个 (op, k) 按长度从小到大枚举，在边界输入与固定种子的随机输入上与参考语义比较，
+// 同长度中取默认延迟模型下关键路径最短、其次枚举顺序最先者，只收录比指令选择的模式表给出的更短的序列
+//
+// 用法：superopt [-o FILE]       生成查找表，默认写到标准输出
+//       superopt -verify FILE    以更多输入复核编进本程序的表，并检查重新生成的结果与 FILE 逐字节一致
+// 生成结果只取决于本文件，可重复生成
+#include <inttypes.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "riscv_superopt.h"
+
+// 默认延迟模型（riscv_latency_default）
+#define LATENCY_ALU 1
+#define LATENCY_MUL 3
+#define LATENCY_DIV 16
+
+typedef enum { FMT_RRR, FMT_RRI, FMT_SHIFT, FMT_RI, FMT_LUI, FMT_RR } OpFormat;
+
+// 搜索使用的指令：均有 RV64 下对符号扩展的 32 位值结果相同的形式（riscv_target_op 换成 *w 或本身即可）
+typedef struct {
+    RiscvOpcode op;
+    const char *ident;      // 表中的枚举名
+    const char *name;       // 助记符，用于注释
+    OpFormat format;
+    int latency;
+    bool commutative;
+} SearchOp;
+
+static const SearchOp search_ops[] = {
+    {RV_OP_LI,   "RV_OP_LI",   "li",   FMT_RI,    LATENCY_ALU, false},
+    {RV_OP_LUI,  "RV_OP_LUI",  "lui",  FMT_LUI,   LATENCY_ALU, false},
+    {RV_OP_MV,   "RV_OP_MV",   "mv",   FMT_RR,    LATENCY_ALU, false},
+    {RV_OP_SEQZ, "RV_OP_SEQZ", "seqz", FMT_RR,    LATENCY_ALU, false},
+    {RV_OP_SNEZ, "RV_OP_SNEZ", "snez", FMT_RR,    LATENCY_ALU, false},
+    {RV_OP_ADDI, "RV_OP_ADDI", "addi", FMT_RRI,   LATENCY_ALU, false},
+    {RV_OP_SLTI, "RV_OP_SLTI", "slti", FMT_RRI,   LATENCY_ALU, false},
+    {RV_OP_XORI, "RV_OP_XORI", "xori", FMT_RRI,   LATENCY_ALU, false},
+    {RV_OP_ANDI, "RV_OP_ANDI", "andi", FMT_RRI,   LATENCY_ALU, false},
+    {RV_OP_ORI,  "RV_OP_ORI",  "ori",  FMT_RRI,   LATENCY_ALU, false},
+    {RV_OP_SLLI, "RV_OP_SLLI", "slli", FMT_SHIFT, LATENCY_ALU, false},
+    {RV_OP_SRLI, "RV_OP_SRLI", "srli", FMT_SHIFT, LATENCY_ALU, false},
+    {RV_OP_SRAI, "RV_OP_SRAI", "srai", FMT_SHIFT, LATENCY_ALU, false},
+    {RV_OP_ADD,  "RV_OP_ADD",  "add",  FMT_RRR,   LATENCY_ALU, true},
+    {RV_OP_SUB,  "RV_OP_SUB",  "sub",  FMT_RRR,   LATENCY_ALU, false},
+    {RV_OP_MUL,  "RV_OP_MUL",  "mul",  FMT_RRR,   LATENCY_MUL, true},
+    {RV_OP_DIV,  "RV_OP_DIV",  "div",  FMT_RRR,   LATENCY_DIV, false},
+    {RV_OP_REM,  "RV_OP_REM",  "rem",  FMT_RRR,   LATENCY_DIV, false},
+    {RV_OP_SLT,  "RV_OP_SLT",  "slt",  FMT_RRR,   LATENCY_ALU, false},
+    {RV_OP_SGT,  "RV_OP_SGT",  "sgt",  FMT_RRR,   LATENCY_ALU, false},
+    {RV_OP_XOR,  "RV_OP_XOR",  "xor",  FMT_RRR,   LATENCY_ALU, true},
+    {RV_OP_AND,  "RV_OP_AND",  "and",  FMT_RRR,   LATENCY_ALU, true},
+    {RV_OP_OR,   "RV_OP_OR",   "or",   FMT_RRR,   LATENCY_ALU, true},
+    {RV_OP_SLL,  "RV_OP_SLL",  "sll",  FMT_RRR,   LATENCY_ALU, false},
+    {RV_OP_SRL,  "RV_OP_SRL",  "srl",  FMT_RRR,   LATENCY_ALU, false},
+    {RV_OP_SRA,  "RV_OP_SRA",  "sra",  FMT_RRR,   LATENCY_ALU, false},
+};
+#define SEARCH_OP_COUNT ((int)(sizeof(search_ops) / sizeof(search_ops[0])))
+
+// 搜索的运算，按 SsaOp 升序排列，生成的表因此按 (op, k) 有序
+typedef struct {
+    SsaOp op;
+    const char *ident;
+    const char *koopa;
+} TargetOp;
+
+static const TargetOp target_ops[] = {
+    {SSA_NE,  "SSA_NE",  "ne"},
+    {SSA_EQ,  "SSA_EQ",  "eq"},
+    {SSA_GT,  "SSA_GT",  "gt"},
+    {SSA_LT,  "SSA_LT",  "lt"},
+    {SSA_GE,  "SSA_GE",  "ge"},
+    {SSA_LE,  "SSA_LE",  "le"},
+    {SSA_MUL, "SSA_MUL", "mul"},
+    {SSA_DIV, "SSA_DIV", "div"},
+    {SSA_MOD, "SSA_MOD", "mod"},
+};
+#define TARGET_OP_COUNT ((int)(sizeof(target_ops) / sizeof(target_ops[0])))
+
+static const char *const reg_names[] = {"x", "t", "r", "zero"};
+
+typedef struct {
+    const SearchOp *info;
+    int rs1, rs2;           // SuperoptReg，不使用时为 -1
+    int32_t imm;
+} Candidate;
+
+typedef struct {
+    Candidate *items;
+    int count;
+    int cap;
+} CandidateList;
+
+typedef struct {
+    int32_t *items;
+    int count;
+    int cap;
+} ValueList;
+
+static bool imm12_fits(int32_t v) {
+    return v >= -2048 && v <= 2047;
+}
+
+static int32_t wrap(int64_t v) {
+    return (int32_t)(uint32_t)(uint64_t)v;
+}
+
+static int32_t low12(int32_t v) {
+    return (int32_t)((uint32_t)v << 20) >> 20;
+}
+
+static void value_add(ValueList *list, int32_t v) {
+    for (int i = 0; i < list->count; i++) {
+        if (list->items[i] == v) return;
+    }
+    if (list->count == list->cap) {
+        list->cap = list->cap ? list->cap * 2 : 64;
+        list->items = realloc(list->items, list->cap * sizeof(int32_t));
+        if (!list->items) abort();
+    }
+    list->items[list->count++] = v;
+}
+
+// 不去重地追加，用于大的输入集合
+static void value_push(ValueList *list, int32_t v) {
+    if (list->count == list->cap) {
+        list->cap = list->cap ? list->cap * 2 : 64;
+        list->items = realloc(list->items, list->cap * sizeof(int32_t));
+        if (!list->items) abort();
+    }
+    list->items[list->count++] = v;
+}
+
+static void candidate_add(CandidateList *list, const SearchOp *info, int rs1, int rs2, int32_t imm) {
+    if (list->count == list->cap) {
+        list->cap = list->cap ? list->cap * 2 : 256;
+        list->items = realloc(list->items, list->cap * sizeof(Candidate));
+        if (!list->items) abort();
+    }
+    list->items[list->count++] = (Candidate){info, rs1, rs2, imm};
+}
+
+// RISC-V 的 div / rem：除以 0 得 -1 / 被除数，INT32_MIN / -1 得 INT32_MIN / 0
+static int32_t rv_div(int32_t a, int32_t b) {
+    if (b == 0) return -1;
+    if (a == INT32_MIN && b == -1) return INT32_MIN;
+    return a / b;
+}
+
+static int32_t rv_rem(int32_t a, int32_t b) {
+    if (b == 0) return a;
+    if (a == INT32_MIN && b == -1) return 0;
+    return a % b;
+}
+
+// 参考语义：后端以寄存器形式生成 x op k 的结果
+static int32_t reference(SsaOp op, int32_t x, int32_t k) {
+    switch (op) {
+        case SSA_NE:  return x != k;
+        case SSA_EQ:  return x == k;
+        case SSA_GT:  return x > k;
+        case SSA_LT:  return x < k;
+        case SSA_GE:  return x >= k;
+        case SSA_LE:  return x <= k;
+        case SSA_MUL: return wrap((int64_t)x * k);
+        case SSA_DIV: return rv_div(x, k);
+        case SSA_MOD: return rv_rem(x, k);
+        default: abort();
+    }
+}
+
+static int32_t execute(const Candidate *c, const int32_t regs[4]) {
+    int32_t a = c->rs1 >= 0 ? regs[c->rs1] : 0;
+    int32_t b = c->rs2 >= 0 ? regs[c->rs2] : 0;
+    uint32_t ua = (uint32_t)a;
+    switch (c->info->op) {
+        case RV_OP_LI:   return c->imm;
+        case RV_OP_LUI:  return (int32_t)((uint32_t)c->imm << 12);
+        case RV_OP_MV:   return a;
+        case RV_OP_SEQZ: return a == 0;
+        case RV_OP_SNEZ: return a != 0;
+        case RV_OP_ADDI: return wrap((int64_t)a + c->imm);
+        case RV_OP_SLTI: return a < c->imm;
+        case RV_OP_XORI: return a ^ c->imm;
+        case RV_OP_ANDI: return a & c->imm;
+        case RV_OP_ORI:  return a | c->imm;
+        case RV_OP_SLLI: return (int32_t)(ua << c->imm);
+        case RV_OP_SRLI: return (int32_t)(ua >> c->imm);
+        case RV_OP_SRAI: return a >> c->imm;
+        case RV_OP_ADD:  return wrap((int64_t)a + b);
+        case RV_OP_SUB:  return wrap((int64_t)a - b);
+        case RV_OP_MUL:  return wrap((int64_t)a * b);
+        case RV_OP_DIV:  return rv_div(a, b);
+        case RV_OP_REM:  return rv_rem(a, b);
+        case RV_OP_SLT:  return a < b;
+        case RV_OP_SGT:  return a > b;
+        case RV_OP_XOR:  return a ^ b;
+        case RV_OP_AND:  return a & b;
+        case RV_OP_OR:   return a | b;
+        case RV_OP_SLL:  return (int32_t)(ua << (b & 31));
+        case RV_OP_SRL:  return (int32_t)(ua >> (b & 31));
+        case RV_OP_SRA:  return a >> (b & 31);
+        default: abort();
+    }
+}
+
+// 在输入 x 上运行序列：前面的指令写临时寄存器，最后一条写结果
+static int32_t run(const Candidate *const *seq, int length, int32_t x) {
+    int32_t regs[4] = {x, 0, 0, 0};
+    for (int i = 0; i < length; i++) {
+        regs[i + 1 == length ? SUPEROPT_R : SUPEROPT_T] = execute(seq[i], regs);
+    }
+    return regs[SUPEROPT_R];
+}
+
+static bool equivalent(const Candidate *const *seq, int length, SsaOp op, int32_t k, const ValueList *inputs) {
+    for (int i = 0; i < inputs->count; i++) {
+        int32_t x = inputs->items[i];
+        if (run(seq, length, x) != reference(op, x, k)) return false;
+    }
+    return true;
+}
+
+static uint32_t xorshift32(uint32_t *state) {
+    uint32_t s = *state;
+    s ^= s << 13;
+    s ^= s >> 17;
+    s ^= s << 5;
+    return *state = s;
+}
+
+/**
+ * 比较用的输入：quick 为先行筛选的少量输入，full 另含 2 的幂附近、k 附近与随机输入
+ * random_count 为随机输入的个数，随机数种子固定，结果可重复
+ */
+static void build_inputs(int32_t k, int random_count, int window, ValueList *quick, ValueList *full) {
+    const int32_t specials[] = {0, 1, -1, k, wrap((int64_t)k - 1), wrap((int64_t)k + 1), INT32_MIN, INT32_MAX,
+                                wrap(-(int64_t)k), 2, -2, 3, 7, -7, 12345, -54321};
+    for (size_t i = 0; i < sizeof(specials) / sizeof(specials[0]); i++) {
+        value_add(quick, specials[i]);
+        value_push(full, specials[i]);
+    }
+    value_push(full, INT32_MIN + 1);
+    value_push(full, INT32_MAX - 1);
+    for (int n = 1; n < 31; n++) {
+        int32_t p = (int32_t)1 << n;
+        const int32_t near[] = {p, p - 1, p + 1, -p, -p - 1, -p + 1};
+        for (size_t i = 0; i < sizeof(near) / sizeof(near[0]); i++) value_push(full, near[i]);
+    }
+    for (int d = -window; d <= window; d++) {
+        value_push(full, wrap((int64_t)k + d));
+        value_push(full, wrap(-(int64_t)k + d));
+    }
+    uint32_t state = 0x9e3779b9u ^ (uint32_t)k;
+    for (int i = 0; i < random_count; i++) {
+        uint32_t r = xorshift32(&state);
+        value_push(full, (int32_t)r);
+        value_push(full, (int32_t)(r % 8193) - 4096);
+    }
+}
+
+// 由 k 导出的立即数候选值
+static void build_immediates(int32_t k, ValueList *imm12, ValueList *upper) {
+    const int64_t bases[] = {0, 1, -1, 2, -2, k, (int64_t)k - 1, (int64_t)k + 1, -(int64_t)k, -(int64_t)k - 1,
+                             -(int64_t)k + 1};
+    for (size_t i = 0; i < sizeof(bases) / sizeof(bases[0]); i++) {
+        int32_t v = wrap(bases[i]);
+        if (imm12_fits(v)) value_add(imm12, v);
+        else value_add(imm12, low12(v));
+        int32_t hi = (int32_t)((((uint32_t)v - (uint32_t)low12(v)) >> 12) & 0xfffff);
+        if (hi != 0) value_add(upper, hi);
+        if (((uint32_t)v >> 12) != 0) value_add(upper, (int32_t)((uint32_t)v >> 12));
+    }
+}
+
+/**
+ * 可以放在序列某个位置的全部指令
+ * sources 为可读的寄存器；must_read 不为 -1 时指令须读取该寄存器（否则前一条指令的结果无人使用）
+ */
+static void build_slot(CandidateList *list, const int *sources, int source_count, int must_read,
+                       const ValueList *imm12, const ValueList *upper) {
+    for (int o = 0; o < SEARCH_OP_COUNT; o++) {
+        const SearchOp *info = &search_ops[o];
+        switch (info->format) {
+            case FMT_RI:
+                if (must_read >= 0) break;
+                for (int i = 0; i < imm12->count; i++) candidate_add(list, info, -1, -1, imm12->items[i]);
+                break;
+            case FMT_LUI:
+                if (must_read >= 0) break;
+                for (int i = 0; i < upper->count; i++) candidate_add(list, info, -1, -1, upper->items[i]);
+                break;
+            case FMT_RR:
+            case FMT_RRI:
+            case FMT_SHIFT:
+                for (int s = 0; s < source_count; s++) {
+                    int rs1 = sources[s];
+                    if (rs1 == SUPEROPT_ZERO || (must_read >= 0 && rs1 != must_read)) continue;
+                    if (info->format == FMT_RR) {
+                        candidate_add(list, info, rs1, -1, 0);
+                    } else if (info->format == FMT_SHIFT) {
+                        for (int sh = 1; sh < 32; sh++) candidate_add(list, info, rs1, -1, sh);
+                    } else {
+                        for (int i = 0; i < imm12->count; i++) candidate_add(list, info, rs1, -1, imm12->items[i]);
+                    }
+                }
+                break;
+            case FMT_RRR:
+                for (int s1 = 0; s1 < source_count; s1++) {
+                    for (int s2 = 0; s2 < source_count; s2++) {
+                        int rs1 = sources[s1], rs2 = sources[s2];
+                        if (rs1 == SUPEROPT_ZERO && rs2 == SUPEROPT_ZERO) continue;
+                        if (info->commutative && s2 < s1) continue;
+                        if (must_read >= 0 && rs1 != must_read && rs2 != must_read) continue;
+                        candidate_add(list, info, rs1, rs2, 0);
+                    }
+                }
+                break;
+        }
+    }
+}
+
+// 将常量装入寄存器所需的指令数，与 riscv_const_cost 相同
+static int const_cost(int32_t k) {
+    if (k == 0) return 0;
+    if (imm12_fits(k)) return 1;
+    return (k & 0xfff) == 0 ? 1 : 2;
+}
+
+/**
+ * 指令选择不查表时 x op k 的代价，与 riscv_isel.c 中模式表给出的相同：
+ * 装入 k 后以寄存器形式运算（eq / ne / le / ge 另加 seqz / snez），或 k（k + 1）可作 12 位立即数时的立即数形式
+ * 只用于省去不会被选用的表项，与模式表不一致时指令选择仍按代价取较小者
+ */
+static int pattern_cost(SsaOp op, int32_t k) {
+    bool post = op == SSA_EQ || op == SSA_NE || op == SSA_LE || op == SSA_GE;
+    int cost = const_cost(k) + 1 + post;
+    bool fits = imm12_fits(k), plus1_fits = k != INT32_MAX && imm12_fits(k + 1);
+    int imm_cost = cost;
+    switch (op) {
+        case SSA_MUL: if (k > 0 && (k & (k - 1)) == 0) imm_cost = 1; break;
+        case SSA_LT:  if (fits) imm_cost = 1; break;
+        case SSA_GT:  if (plus1_fits) imm_cost = 2; break;
+        case SSA_LE:  if (plus1_fits) imm_cost = 1; break;
+        case SSA_GE:  if (fits) imm_cost = 2; break;
+        case SSA_EQ:
+        case SSA_NE:  if (k == 0) imm_cost = 1; else if (fits) imm_cost = 2; break;
+        default: break;
+    }
+    return imm_cost < cost ? imm_cost : cost;
+}
+
+typedef struct {
+    const Candidate *seq[SUPEROPT_MAX_LENGTH];
+    int length;
+    int latency;
+} Solution;
+
+static int sequence_latency(const Candidate *const *seq, int length) {
+    int latency = 0;
+    for (int i = 0; i < length; i++) latency += seq[i]->info->latency;
+    return latency;
+}
+
+static void consider(Solution *best, const Candidate *const *seq, int length, SsaOp op, int32_t k,
+                     const ValueList *quick, const ValueList *full) {
+    int latency = sequence_latency(seq, length);
+    if (best->length && latency >= best->latency) return;
+    if (!equivalent(seq, length, op, k, quick) || !equivalent(seq, length, op, k, full)) return;
+    for (int i = 0; i < length; i++) best->seq[i] = seq[i];
+    best->length = length;
+    best->latency = latency;
+}
+
+/**
+ * 为 x op k 搜索比模式表更短的序列
+ * @return 找到时返回 true；候选指令表存放在 slots 中，best 指向其中的元素
+ */
+static bool search(SsaOp op, int32_t k, CandidateList slots[2], Solution *best) {
+    int max_length = pattern_cost(op, k) - 1;
+    if (max_length > SUPEROPT_MAX_LENGTH) max_length = SUPEROPT_MAX_LENGTH;
+    best->length = 0;
+    if (max_length < 1) return false;
+
+    ValueList quick = {0}, full = {0}, imm12 = {0}, upper = {0};
+    build_inputs(k, 512, 64, &quick, &full);
+    build_immediates(k, &imm12, &upper);
+
+    // 长度 1：读 x 或 x0 写结果；长度 2：第一条写临时寄存器，第二条须读取它
+    static const int first_sources[] = {SUPEROPT_X, SUPEROPT_ZERO};
+    static const int last_sources[] = {SUPEROPT_X, SUPEROPT_T, SUPEROPT_ZERO};
+    slots[0].count = slots[1].count = 0;
+    build_slot(&slots[0], first_sources, 2, -1, &imm12, &upper);
+    build_slot(&slots[1], last_sources, 3, SUPEROPT_T, &imm12, &upper);
+
+    for (int i = 0; i < slots[0].count; i++) {
+        const Candidate *seq[1] = {&slots[0].items[i]};
+        consider(best, seq, 1, op, k, &quick, &full);
+    }
+    if (best->length == 0 && max_length >= 2) {
+        for (int i = 0; i < slots[0].count; i++) {
+            for (int j = 0; j < slots[1].count; j++) {
+                const Candidate *seq[2] = {&slots[0].items[i], &slots[1].items[j]};
+                consider(best, seq, 2, op, k, &quick, &full);
+            }
+        }
+    }
+    free(quick.items);
+    free(full.items);
+    free(imm12.items);
+    free(upper.items);
+    return best->length > 0;
+}
+
+// 表中收录的常量：-64 ~ 64、2 的幂及其 ± 1 与相反数、12 位立即数与 int 的边界
+static void build_constants(ValueList *constants) {
+    for (int k = -64; k <= 64; k++) value_add(constants, k);
+    for (int n = 1; n < 32; n++) {
+        int64_t p = (int64_t)1 << n;
+        const int64_t near[] = {p, p - 1, p + 1, -p, -p - 1, -p + 1};
+        for (size_t i = 0; i < sizeof(near) / sizeof(near[0]); i++) {
+            if (near[i] >= INT32_MIN && near[i] <= INT32_MAX) value_add(constants, (int32_t)near[i]);
+        }
+    }
+    const int32_t bounds[] = {2047, 2048, 2049, -2048, -2049, -2050, 4095, 4096, 4097, -4096, -4097};
+    for (size_t i = 0; i < sizeof(bounds) / sizeof(bounds[0]); i++) value_add(constants, bounds[i]);
+}
+
+static int compare_int32(const void *a, const void *b) {
+    int32_t x = *(const int32_t *)a, y = *(const int32_t *)b;
+    return (x > y) - (x < y);
+}
+
+static void print_reg(FILE *out, int reg) {
+    static const char *const idents[] = {"SUPEROPT_X", "SUPEROPT_T", "SUPEROPT_R", "SUPEROPT_ZERO"};
+    fprintf(out, "%s", reg >= 0 ? idents[reg] : "-1");
+}
+
+// 序列的汇编形式，用作表项的注释
+static void print_asm(FILE *out, const Solution *s) {
+    for (int i = 0; i < s->length; i++) {
+        const Candidate *c = s->seq[i];
+        const char *rd = reg_names[i + 1 == s->length ? SUPEROPT_R : SUPEROPT_T];
+        fprintf(out, "%s%s %s", i ? "; " : "", c->info->name, rd);
+        switch (c->info->format) {
+            case FMT_RI: case FMT_LUI:
+                fprintf(out, ", %" PRId32, c->imm);
+                break;
+            case FMT_RR:
+                fprintf(out, ", %s", reg_names[c->rs1]);
+                break;
+            case FMT_RRI: case FMT_SHIFT:
+                fprintf(out, ", %s, %" PRId32, reg_names[c->rs1], c->imm);
+                break;
+            case FMT_RRR:
+                fprintf(out, ", %s, %s", reg_names[c->rs1], reg_names[c->rs2]);
+                break;
+        }
+    }
+}
+
+static void print_entry(FILE *out, const TargetOp *target, int32_t k, const Solution *s) {
+    fprintf(out, "    // %s x, %" PRId32 ": ", target->koopa, k);
+    print_asm(out, s);
+    // -2147483648 在 C 中是对 long 常量取负，写成 INT32_MIN
+    if (k == INT32_MIN) fprintf(out, "\n    {%s, INT32_MIN, %d, %d, {", target->ident, s->length, s->latency);
+    else fprintf(out, "\n    {%s, %" PRId32 ", %d, %d, {", target->ident, k, s->length, s->latency);
+    for (int i = 0; i < s->length; i++) {
+        const Candidate *c = s->seq[i];
+        fprintf(out, "%s{%s, ", i ? ", " : "", c->info->ident);
+        print_reg(out, i + 1 == s->length ? SUPEROPT_R : SUPEROPT_T);
+        fprintf(out, ", ");
+        print_reg(out, c->rs1);
+        fprintf(out, ", ");
+        print_reg(out, c->rs2);
+        fprintf(out, ", %" PRId32 "}", c->imm);
+    }
+    fprintf(out, "}},\n");
+}
+
+// 生成整张表，返回收录的序列数
+static int generate(FILE *out) {
+    ValueList constants = {0};
+    build_constants(&constants);
+    qsort(constants.items, constants.count, sizeof(int32_t), compare_int32);
+
+    fprintf(out, "// 由 tools/superopt.c 生成，不要手工修改；重新生成：cmake --build build --target superopt-gen\n");
+    fprintf(out, "// x op k 的最短指令序列，寄存器 x 为被运算的值，t 为临时寄存器，r 为结果\n");
+    fprintf(out, "// 每项为 {运算, k, 长度, 关键路径延迟, {指令 {操作码, rd, rs1, rs2, 立即数}...}}\n\n");
+    fprintf(out, "static const SuperoptEntry superopt_entries[] = {\n");
+    CandidateList slots[2] = {{0}, {0}};
+    int entries = 0;
+    for (int t = 0; t < TARGET_OP_COUNT; t++) {
+        for (int i = 0; i < constants.count; i++) {
+            Solution best;
+            if (!search(target_ops[t].op, constants.items[i], slots, &best)) continue;
+            print_entry(out, &target_ops[t], constants.items[i], &best);
+            entries++;
+        }
+    }
+    fprintf(out, "};\n");
+    free(slots[0].items);
+    free(slots[1].items);
+    free(constants.items);
+    return entries;
+}
+
+// 把表项还原成候选指令，复用搜索时的解释执行
+static bool entry_equivalent(const SuperoptEntry *e, const ValueList *inputs) {
+    Candidate insts[SUPEROPT_MAX_LENGTH];
+    const Candidate *seq[SUPEROPT_MAX_LENGTH];
+    for (int i = 0; i < e->length; i++) {
+        const SearchOp *info = NULL;
+        for (int o = 0; o < SEARCH_OP_COUNT && !info; o++) {
+            if (search_ops[o].op == e->insts[i].op) info = &search_ops[o];
+        }
+        int rd = i + 1 == e->length ? SUPEROPT_R : SUPEROPT_T;
+        if (!info || e->insts[i].rd != rd) return false;
+        insts[i] = (Candidate){info, e->insts[i].rs1, e->insts[i].rs2, e->insts[i].imm};
+        seq[i] = &insts[i];
+    }
+    return equivalent(seq, e->length, e->op, e->k, inputs);
+}
+
+/**
+ * 复核编进本程序的表：每个序列在更大的输入集合上与参考语义比较，
+ * 再重新生成一遍，与 path 的内容逐字节比较
+ */
+static int verify(const char *path) {
+    int count, failures = 0;
+    const SuperoptEntry *table = riscv_superopt_table(&count);
+    for (int i = 0; i < count; i++) {
+        ValueList quick = {0}, full = {0};
+        build_inputs(table[i].k, 1 << 16, 4096, &quick, &full);
+        if (!entry_equivalent(&table[i], &full)) {
+            const char *name = "?";
+            for (int t = 0; t < TARGET_OP_COUNT; t++) {
+                if (target_ops[t].op == table[i].op) name = target_ops[t].koopa;
+            }
+            fprintf(stderr, "superopt: %s x, %" PRId32 " is not equivalent\n", name, table[i].k);
+            failures++;
+        }
+        free(quick.items);
+        free(full.items);
+    }
+
+    char *generated = NULL;
+    size_t generated_size = 0;
+    FILE *mem = open_memstream(&generated, &generated_size);
+    if (!mem) {
+        perror("open_memstream");
+        return 1;
+    }
+    generate(mem);
+    fclose(mem);
+
+    FILE *f = fopen(path, "rb");
+    if (!f) {
+        fprintf(stderr, "superopt: cannot open %s\n", path);
+        free(generated);
+        return 1;
+    }
+    char *existing = malloc(generated_size + 1);
+    if (!existing) abort();
+    size_t n = fread(existing, 1, generated_size + 1, f);
+    fclose(f);
+    if (n != generated_size || memcmp(existing, generated, generated_size) != 0) {
+        fprintf(stderr, "superopt: %s is out of date, regenerate it with the superopt-gen target\n", path);
+        failures++;
+    }
+    free(existing);
+    free(generated);
+
+    printf("superopt: %d entries checked, %s\n", count, failures ? "FAILED" : "ok");
+    return failures ? 1 : 0;
+}
+
+static void usage(void) {
+    fprintf(stderr, "usage: superopt [-o FILE] | superopt -verify FILE\n");
+}
+
+int main(int argc, char *argv[]) {
+    if (argc == 3 && strcmp(argv[1], "-verify") == 0) return verify(argv[2]);
+    FILE *out = stdout;
+    if (argc == 3 && strcmp(argv[1], "-o") == 0) {
+        out = fopen(argv[2], "w");
+        if (!out) {
+            fprintf(stderr, "superopt: cannot open %s\n", argv[2]);
+            return 1;
+        }
+    } else if (argc != 1) {
+        usage();
+        return 2;
+    }
+    int entries = generate(out);
+    if (out != stdout) fclose(out);
+    fprintf(stderr, "superopt: %d sequences\n", entries);
+    return 0;
+}